@@ -0,0 +1,142 @@
+#include <EglContext.hpp>
+
+// Keep the X11 headers out, the context needs no display server.
+#define EGL_NO_X11
+#define MESA_EGL_NO_X11_HEADERS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <cstring>
+#include <vector>
+
+namespace Ra {
+
+namespace {
+bool hasExtension( const char* extensions, const char* name ) {
+    if ( extensions == nullptr )
+    {
+        return false;
+    }
+    const size_t length = std::strlen( name );
+    for ( const char* p = std::strstr( extensions, name ); p != nullptr;
+          p = std::strstr( p + length, name ) )
+    {
+        if ( ( p == extensions || p[-1] == ' ' ) && ( p[length] == ' ' || p[length] == '\0' ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+EglContext::EglContext() : m_display( EGL_NO_DISPLAY ), m_context( EGL_NO_CONTEXT ) {}
+
+EglContext::~EglContext() {
+    if ( m_context != EGL_NO_CONTEXT )
+    {
+        doneCurrent();
+        eglDestroyContext( m_display, m_context );
+    }
+    if ( m_display != EGL_NO_DISPLAY )
+    {
+        eglTerminate( m_display );
+    }
+}
+
+bool EglContext::create( int majorVersion, int minorVersion ) {
+    // The platform extensions are listed by the client extensions, which need EGL 1.5 or
+    // EGL_EXT_client_extensions.
+    const char* clientExtensions = eglQueryString( EGL_NO_DISPLAY, EGL_EXTENSIONS );
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress( "eglGetPlatformDisplayEXT" ) );
+
+    if ( getPlatformDisplay != nullptr )
+    {
+        if ( hasExtension( clientExtensions, "EGL_MESA_platform_surfaceless" ) )
+        {
+            m_platformName = "surfaceless";
+            if ( createOnDisplay( getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA,
+                                                      EGL_DEFAULT_DISPLAY, nullptr ),
+                                  majorVersion, minorVersion ) )
+            {
+                return true;
+            }
+        }
+
+        auto queryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(
+            eglGetProcAddress( "eglQueryDevicesEXT" ) );
+        if ( hasExtension( clientExtensions, "EGL_EXT_platform_device" ) &&
+             queryDevices != nullptr )
+        {
+            EGLint numDevices = 0;
+            if ( queryDevices( 0, nullptr, &numDevices ) && numDevices > 0 )
+            {
+                std::vector<EGLDeviceEXT> devices( numDevices );
+                queryDevices( numDevices, devices.data(), &numDevices );
+                m_platformName = "device";
+                if ( createOnDisplay(
+                         getPlatformDisplay( EGL_PLATFORM_DEVICE_EXT, devices[0], nullptr ),
+                         majorVersion, minorVersion ) )
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    m_platformName = "default display";
+    return createOnDisplay( eglGetDisplay( EGL_DEFAULT_DISPLAY ), majorVersion, minorVersion );
+}
+
+bool EglContext::createOnDisplay( void* display, int majorVersion, int minorVersion ) {
+    if ( display == EGL_NO_DISPLAY || !eglInitialize( display, nullptr, nullptr ) )
+    {
+        return false;
+    }
+    // clang-format off
+    const EGLint configAttribs[] = {EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                                    EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8,
+                                    EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+                                    EGL_NONE};
+    const EGLint contextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION, majorVersion,
+                                     EGL_CONTEXT_MINOR_VERSION, minorVersion,
+                                     EGL_CONTEXT_OPENGL_PROFILE_MASK,
+                                     EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                                     EGL_NONE};
+    // clang-format on
+
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if ( hasExtension( eglQueryString( display, EGL_EXTENSIONS ),
+                       "EGL_KHR_surfaceless_context" ) &&
+         eglBindAPI( EGL_OPENGL_API ) &&
+         eglChooseConfig( display, configAttribs, &config, 1, &numConfigs ) && numConfigs > 0 )
+    {
+        m_context = eglCreateContext( display, config, EGL_NO_CONTEXT, contextAttribs );
+    }
+    if ( m_context == EGL_NO_CONTEXT )
+    {
+        eglTerminate( display );
+        return false;
+    }
+
+    m_display = display;
+    m_platformName += std::string( ", " ) + eglQueryString( display, EGL_VENDOR );
+    return true;
+}
+
+bool EglContext::makeCurrent() {
+    return m_context != EGL_NO_CONTEXT &&
+           eglMakeCurrent( m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_context );
+}
+
+void EglContext::doneCurrent() {
+    if ( m_display != EGL_NO_DISPLAY )
+    {
+        eglMakeCurrent( m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+    }
+}
+
+} // namespace Ra
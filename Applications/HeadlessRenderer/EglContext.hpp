@@ -0,0 +1,45 @@
+#ifndef RADIUMENGINE_EGLCONTEXT_HPP
+#define RADIUMENGINE_EGLCONTEXT_HPP
+
+#include <string>
+
+namespace Ra {
+
+/**
+ * OpenGL context created through EGL without any surface ( EGL_KHR_surfaceless_context ), so
+ * that it needs no display server. The frames must be rendered into framebuffer objects.
+ * The display is taken, in this order, from Mesa's surfaceless platform, from the first EGL
+ * device ( e.g. with the NVidia driver ), or is the default EGL display.
+ * glbinding resolves the OpenGL functions through its GLX loader, which reaches the EGL
+ * context with libglvnd, as on current Linux distributions.
+ */
+class EglContext {
+  public:
+    EglContext();
+    ~EglContext();
+
+    EglContext( const EglContext& ) = delete;
+    EglContext& operator=( const EglContext& ) = delete;
+
+    /// Create a core profile context of at least the given version. Returns false on failure.
+    bool create( int majorVersion, int minorVersion );
+
+    bool makeCurrent();
+    void doneCurrent();
+
+    /// Name of the EGL platform and vendor of the context, for the logs.
+    const std::string& getPlatformName() const { return m_platformName; }
+
+  private:
+    /// Create the context on an initialized display, which is terminated on failure.
+    bool createOnDisplay( void* display, int majorVersion, int minorVersion );
+
+  private:
+    void* m_display; ///< EGLDisplay.
+    void* m_context; ///< EGLContext.
+    std::string m_platformName;
+};
+
+} // namespace Ra
+
+#endif // RADIUMENGINE_EGLCONTEXT_HPP
@@ -0,0 +1,514 @@
+#include <glbinding/ContextInfo.h>
+#include <glbinding/Version.h>
+// Do not import namespace to prevent glbinding/QTOpenGL collision
+#include <glbinding/gl/gl.h>
+
+#include <globjects/Framebuffer.h>
+#include <globjects/Renderbuffer.h>
+#include <globjects/globjects.h>
+
+#include <HeadlessRenderer.hpp>
+
+#include <EglContext.hpp>
+
+#include <Core/Math/Math.hpp>
+#include <Core/Utils/Log.hpp>
+#include <Core/Utils/Profiler.hpp>
+#include <Core/Utils/StringUtils.hpp>
+#include <Core/Utils/TaskQueue.hpp>
+
+#include <Engine/Managers/SystemDisplay/SystemDisplay.hpp>
+#include <Engine/RadiumEngine.hpp>
+#include <Engine/Renderer/Camera/Camera.hpp>
+#include <Engine/Renderer/Light/DirLight.hpp>
+#include <Engine/Renderer/RenderObject/RenderObjectManager.hpp>
+#include <Engine/Renderer/RenderTechnique/ShaderProgramManager.hpp>
+#include <Engine/Renderer/Renderers/ForwardRenderer.hpp>
+
+#include <GuiBase/BaseApplication.hpp>
+#include <GuiBase/Viewer/FrameRecorder.hpp>
+#include <PluginBase/RadiumPluginInterface.hpp>
+
+#ifdef IO_USE_TINYPLY
+#    include <IO/TinyPlyLoader/TinyPlyFileLoader.hpp>
+#endif
+#ifdef IO_USE_ASSIMP
+#    include <IO/AssimpLoader/AssimpFileLoader.hpp>
+#endif
+
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFileInfo>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QPluginLoader>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <fstream>
+
+namespace Ra {
+
+HeadlessRenderer::HeadlessRenderer( int& argc, char** argv ) :
+    QApplication( argc, argv ),
+    m_light( nullptr ),
+    m_width( 1280 ),
+    m_height( 720 ),
+    m_numFrames( 1 ),
+    m_maxThreads( RA_MAX_THREAD ),
+    m_initialized( false ),
+    m_outputFolder( "." ),
+    m_format( "png" ) {
+    QCoreApplication::setOrganizationName( "STORM-IRIT" );
+    QCoreApplication::setApplicationName( "Radium Headless Renderer" );
+
+    std::string pluginsPath = "Plugins";
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Render scene files to images without any window." );
+    parser.addHelpOption();
+
+    QCommandLineOption fileOpt( QStringList{"f", "file", "scene"},
+                                "Scene file to load, can be given several times.", "file name" );
+    QCommandLineOption numFramesOpt( QStringList{"n", "numframes"},
+                                     "Number of frames, the camera turns around the scene once.",
+                                     "number", "1" );
+    QCommandLineOption sizeOpt( QStringList{"s", "size"}, "Size of the images.", "WxH",
+                                "1280x720" );
+    QCommandLineOption outputOpt( QStringList{"o", "output"},
+                                  "Folder of the images, nothing is written if empty.", "folder",
+                                  "." );
+    QCommandLineOption formatOpt( QStringList{"format"},
+                                  "Format of the images : png, bmp, tga, jpg, hdr or raw (RGBA8 "
+                                  "pixels).",
+                                  "format", "png" );
+    QCommandLineOption timingsOpt( QStringList{"t", "timings"},
+                                   "Write the timings of the frames to the given file, as JSON.",
+                                   "file" );
+    QCommandLineOption maxThreadsOpt(
+        QStringList{"m", "maxthreads", "max-threads"},
+        "Control the maximum number of threads. 0 will set to the number of cores available",
+        "number", "0" );
+    QCommandLineOption pluginOpt( QStringList{"p", "plugins", "pluginsPath"},
+                                  "Set the path to the plugin dlls.", "folder", "Plugins" );
+    QCommandLineOption pluginLoadOpt(
+        QStringList{"l", "load", "loadPlugin"},
+        "Only load plugin with the given name (filename without the extension).", "name" );
+    QCommandLineOption pluginIgnoreOpt( QStringList{"i", "ignore", "ignorePlugin"},
+                                        "Ignore plugins with the given name.", "name" );
+
+    parser.addOptions( {fileOpt, numFramesOpt, sizeOpt, outputOpt, formatOpt, timingsOpt,
+                        maxThreadsOpt, pluginOpt, pluginLoadOpt, pluginIgnoreOpt} );
+    parser.process( *this );
+
+    for ( const auto& file : parser.values( fileOpt ) )
+    {
+        m_files.push_back( file.toLocal8Bit().data() );
+    }
+    if ( parser.isSet( numFramesOpt ) )
+        m_numFrames = std::max( parser.value( numFramesOpt ).toUInt(), 1u );
+    if ( parser.isSet( sizeOpt ) )
+    {
+        const QStringList size = parser.value( sizeOpt ).split( 'x' );
+        if ( size.size() == 2 && size[0].toUInt() > 0 && size[1].toUInt() > 0 )
+        {
+            m_width = size[0].toUInt();
+            m_height = size[1].toUInt();
+        } else
+        {
+            LOG( Core::Utils::logWARNING ) << "Invalid image size "
+                                           << parser.value( sizeOpt ).toStdString()
+                                           << ", using " << m_width << "x" << m_height;
+        }
+    }
+    if ( parser.isSet( outputOpt ) )
+        m_outputFolder = parser.value( outputOpt ).toStdString();
+    if ( parser.isSet( formatOpt ) )
+        m_format = parser.value( formatOpt ).toStdString();
+    if ( parser.isSet( timingsOpt ) )
+        m_timingsFile = parser.value( timingsOpt ).toStdString();
+    if ( parser.isSet( maxThreadsOpt ) )
+        m_maxThreads = parser.value( maxThreadsOpt ).toUInt();
+    if ( parser.isSet( pluginOpt ) )
+        pluginsPath = parser.value( pluginOpt ).toStdString();
+
+    if ( !m_outputFolder.empty() && !QDir().mkpath( m_outputFolder.c_str() ) )
+    {
+        LOG( Core::Utils::logERROR ) << "Cannot create output folder " << m_outputFolder;
+        return;
+    }
+
+    // Create engine
+    m_engine.reset( Engine::RadiumEngine::createInstance() );
+    m_engine->initialize();
+    GuiBase::BaseApplication::addBasicShaders();
+
+    if ( !initializeGL() )
+    {
+        return;
+    }
+
+    if ( !loadPlugins( pluginsPath, parser.values( pluginLoadOpt ),
+                       parser.values( pluginIgnoreOpt ) ) )
+    {
+        LOG( Core::Utils::logERROR ) << "An error occurred while trying to load plugins.";
+    }
+
+    // Make builtin loaders the fallback if no plugins can load some file format
+#ifdef IO_USE_TINYPLY
+    m_engine->registerFileLoader(
+        std::shared_ptr<Core::Asset::FileLoaderInterface>( new IO::TinyPlyFileLoader() ) );
+#endif
+#ifdef IO_USE_ASSIMP
+    m_engine->registerFileLoader(
+        std::shared_ptr<Core::Asset::FileLoaderInterface>( new IO::AssimpFileLoader() ) );
+#endif
+
+    uint numThreads =
+        std::max( m_maxThreads == 0 ? RA_MAX_THREAD : std::min( m_maxThreads, RA_MAX_THREAD ), 1u );
+    m_taskQueue.reset( new Core::Utils::TaskQueue( numThreads ) );
+
+    m_initialized = true;
+}
+
+HeadlessRenderer::~HeadlessRenderer() {
+    const bool hasContext = makeCurrent();
+    if ( hasContext )
+    {
+        if ( m_recorder )
+        {
+            m_recorder->releaseGL();
+        }
+        m_fbo.reset();
+        m_colorBuffer.reset();
+        m_depthBuffer.reset();
+        m_renderer.reset();
+    }
+    if ( m_engine )
+    {
+        m_engine->cleanup();
+    }
+    if ( hasContext )
+    {
+        doneCurrent();
+    }
+}
+
+bool HeadlessRenderer::initializeGL() {
+    QSurfaceFormat format;
+    format.setVersion( 4, 4 );
+    format.setProfile( QSurfaceFormat::CoreProfile );
+    format.setDepthBufferSize( 24 );
+    format.setStencilBufferSize( 8 );
+    QSurfaceFormat::setDefaultFormat( format );
+
+    if ( !createContext( format ) )
+    {
+        LOG( Core::Utils::logERROR ) << "Cannot create an OpenGL " << format.majorVersion() << "."
+                                     << format.minorVersion() << " context on platform "
+                                     << m_contextPlatform;
+        return false;
+    }
+    // no need to initalize glbinding. globjects (magically) do this internally.
+    globjects::init( globjects::Shader::IncludeImplementation::Fallback );
+
+    LOG( Core::Utils::logINFO ) << "*** Radium Engine Headless Renderer ***";
+    LOG( Core::Utils::logINFO ) << "Platform : " << m_contextPlatform;
+    LOG( Core::Utils::logINFO ) << "Renderer (glbinding) : " << glbinding::ContextInfo::renderer();
+    LOG( Core::Utils::logINFO ) << "OpenGL   (glbinding) : "
+                                << glbinding::ContextInfo::version().toString();
+
+    // Linked programs are cached in the user cache directory, as in the viewer.
+    QString programCache =
+        QStandardPaths::writableLocation( QStandardPaths::CacheLocation ) + "/Shaders";
+    if ( !QDir().mkpath( programCache ) )
+    {
+        programCache.clear();
+    }
+    Engine::ShaderProgramManager::createInstance(
+        "Shaders/Default.vert.glsl", "Shaders/Default.frag.glsl", programCache.toStdString() );
+
+    // The final image is drawn into the framebuffer bound when the rendering starts.
+    m_colorBuffer.reset( new globjects::Renderbuffer() );
+    m_colorBuffer->storage( gl::GL_RGBA8, m_width, m_height );
+    m_depthBuffer.reset( new globjects::Renderbuffer() );
+    m_depthBuffer->storage( gl::GL_DEPTH24_STENCIL8, m_width, m_height );
+    m_fbo.reset( new globjects::Framebuffer() );
+    m_fbo->attachRenderBuffer( gl::GL_COLOR_ATTACHMENT0, m_colorBuffer.get() );
+    m_fbo->attachRenderBuffer( gl::GL_DEPTH_STENCIL_ATTACHMENT, m_depthBuffer.get() );
+    if ( m_fbo->checkStatus() != gl::GL_FRAMEBUFFER_COMPLETE )
+    {
+        LOG( Core::Utils::logERROR ) << "Incomplete offscreen framebuffer.";
+        return false;
+    }
+    globjects::Framebuffer::unbind();
+
+    m_camera.reset( new Engine::Camera( Scalar( m_height ), Scalar( m_width ) ) );
+    m_camera->resize( Scalar( m_width ), Scalar( m_height ) );
+
+    // Lights are components. So they must be attached to an entity. Attach headlight to system Entity
+    m_light = new Engine::DirectionalLight( Engine::SystemEntity::getInstance(), "headlight" );
+
+    m_renderer.reset( new Engine::ForwardRenderer() );
+    gl::glViewport( 0, 0, m_width, m_height );
+    m_renderer->initialize( m_width, m_height );
+    m_renderer->addLight( m_light );
+
+    m_recorder.reset( new Gui::FrameRecorder() );
+
+    doneCurrent();
+    return true;
+}
+
+bool HeadlessRenderer::createContext( const QSurfaceFormat& format ) {
+#ifdef HEADLESS_USE_EGL
+    m_eglContext.reset( new EglContext() );
+    if ( m_eglContext->create( format.majorVersion(), format.minorVersion() ) &&
+         m_eglContext->makeCurrent() )
+    {
+        m_contextPlatform = "EGL ( " + m_eglContext->getPlatformName() + " )";
+        return true;
+    }
+    LOG( Core::Utils::logWARNING ) << "Cannot create an OpenGL context through EGL, "
+                                   << "trying the Qt platform.";
+    m_eglContext.reset();
+#endif
+
+    m_contextPlatform = platformName().toStdString();
+    m_surface.reset( new QOffscreenSurface() );
+    m_surface->setFormat( format );
+    m_surface->create();
+
+    m_context.reset( new QOpenGLContext() );
+    m_context->setFormat( format );
+    return m_surface->isValid() && m_context->create() &&
+           m_context->makeCurrent( m_surface.get() );
+}
+
+bool HeadlessRenderer::makeCurrent() {
+    if ( m_eglContext )
+    {
+        return m_eglContext->makeCurrent();
+    }
+    return m_context && m_context->makeCurrent( m_surface.get() );
+}
+
+void HeadlessRenderer::doneCurrent() {
+    if ( m_eglContext )
+    {
+        m_eglContext->doneCurrent();
+    } else if ( m_context )
+    {
+        m_context->doneCurrent();
+    }
+}
+
+bool HeadlessRenderer::loadPlugins( const std::string& pluginsPath, const QStringList& loadList,
+                                    const QStringList& ignoreList ) {
+    QDir pluginsDir( qApp->applicationDirPath() );
+    if ( !pluginsDir.cd( pluginsPath.c_str() ) )
+    {
+        LOG( Core::Utils::logDEBUG ) << "No plugins directory " << pluginsPath;
+        return true;
+    }
+
+    // There is no GUI : the plugins only get the engine.
+    PluginContext context;
+    context.m_engine = m_engine.get();
+    context.m_selectionManager = nullptr;
+    context.m_pickingManager = nullptr;
+    context.m_viewer = nullptr;
+
+    bool res = true;
+    for ( const auto& filename : pluginsDir.entryList( QDir::Files ) )
+    {
+        if ( !QLibrary::isLibrary( filename ) )
+        {
+            continue;
+        }
+        const QString basename = QFileInfo( filename ).completeBaseName();
+        if ( ( !loadList.empty() && !loadList.contains( basename ) ) ||
+             ignoreList.contains( basename ) )
+        {
+            continue;
+        }
+
+        QPluginLoader pluginLoader( pluginsDir.absoluteFilePath( filename ) );
+        pluginLoader.setLoadHints( QLibrary::ResolveAllSymbolsHint );
+        auto plugin = qobject_cast<Plugins::RadiumPluginInterface*>( pluginLoader.instance() );
+        if ( plugin == nullptr )
+        {
+            LOG( Core::Utils::logERROR ) << "Something went wrong while trying to load plugin "
+                                         << filename.toStdString() << " : "
+                                         << pluginLoader.errorString().toStdString();
+            res = false;
+            continue;
+        }
+
+        LOG( Core::Utils::logINFO ) << "Loaded plugin " << filename.toStdString();
+        plugin->registerPlugin( context );
+        if ( plugin->doAddFileLoader() )
+        {
+            std::vector<std::shared_ptr<Core::Asset::FileLoaderInterface>> loaders;
+            plugin->addFileLoaders( &loaders );
+            for ( const auto& loader : loaders )
+            {
+                m_engine->registerFileLoader( loader );
+            }
+        }
+        if ( plugin->doAddROpenGLInitializer() )
+        {
+            makeCurrent();
+            plugin->openGlInitialize( context );
+            doneCurrent();
+        }
+    }
+    return res;
+}
+
+int HeadlessRenderer::run() {
+    if ( !m_initialized )
+    {
+        return 1;
+    }
+
+    for ( const auto& file : m_files )
+    {
+        LOG( Core::Utils::logINFO ) << "Loading file " << file << "...";
+        if ( !m_engine->loadFile( file ) )
+        {
+            LOG( Core::Utils::logERROR ) << "Cannot load " << file;
+            return 1;
+        }
+        m_engine->releaseFile();
+    }
+    // The first frame is placed before any end of frame updates the scene box.
+    m_engine->getRenderObjectManager()->updateSceneAabb();
+
+    m_timings.reserve( m_numFrames );
+    const Scalar dt = 1.f / 60.f;
+    for ( uint i = 0; i < m_numFrames; ++i )
+    {
+        renderFrame( i, dt );
+    }
+
+    makeCurrent();
+    m_recorder->flush();
+    doneCurrent();
+
+    LOG( Core::Utils::logINFO ) << "Rendered " << m_numFrames << " frames.";
+    if ( !m_timingsFile.empty() && !writeTimings( m_timingsFile ) )
+    {
+        LOG( Core::Utils::logERROR ) << "Cannot write timings to " << m_timingsFile;
+        return 1;
+    }
+    return 0;
+}
+
+void HeadlessRenderer::placeCamera( uint i ) {
+    using Core::Math::Vector3;
+
+    Core::Math::Aabb aabb = m_engine->getRenderObjectManager()->getSceneAabb();
+    if ( aabb.isEmpty() )
+    {
+        aabb.extend( Vector3( -1, -1, -1 ) );
+        aabb.extend( Vector3( 1, 1, 1 ) );
+    }
+
+    // Fit the scene as TrackballCamera::fitScene(), then turn around the vertical axis.
+    const Scalar f = m_camera->getFOV();
+    const Scalar a = m_camera->getAspect();
+    const Scalar r = ( aabb.max() - aabb.min() ).norm() / 2.0;
+    const Scalar d =
+        std::max( std::max( r / std::sin( f / 2.0 ), r / std::sin( f * a / 2.0 ) ), Scalar( 0.001 ) );
+    const Scalar angle = Core::Math::PiMul2 * Scalar( i ) / Scalar( m_numFrames );
+
+    const Vector3 eye = aabb.center() + d * Vector3( std::sin( angle ), 0, std::cos( angle ) );
+    const Vector3 z = ( eye - aabb.center() ).normalized();
+    const Vector3 x = Vector3::UnitY().cross( z ).normalized();
+    Core::Math::Transform frame = Core::Math::Transform::Identity();
+    frame.linear().col( 0 ) = x;
+    frame.linear().col( 1 ) = z.cross( x );
+    frame.linear().col( 2 ) = z;
+    frame.translation() = eye;
+    m_camera->setFrame( frame );
+    m_camera->setZFar( std::max( Scalar( d + 2 * r ), m_camera->getZFar() ) );
+
+    m_light->setDirection( -z );
+}
+
+void HeadlessRenderer::renderFrame( uint i, Scalar dt ) {
+    FrameTimings timings;
+    timings.frameStart = Core::Utils::Clock::now();
+
+    makeCurrent();
+    placeCamera( i );
+
+    Engine::RenderData data;
+    data.dt = dt;
+    data.projMatrix = m_camera->getProjMatrix();
+    data.viewMatrix = m_camera->getViewMatrix();
+
+    m_fbo->bind();
+    gl::glViewport( 0, 0, m_width, m_height );
+    m_renderer->render( data );
+    timings.renderEnd = Core::Utils::Clock::now();
+
+    // The tasks of frame i animate the scene rendered at frame i + 1, as in BaseApplication.
+    m_engine->getTasks( m_taskQueue.get(), dt );
+    m_taskQueue->startTasks();
+    m_taskQueue->waitForTasks();
+    m_taskQueue->flushTaskQueue();
+    timings.tasksEnd = Core::Utils::Clock::now();
+
+    m_engine->endFrameSync();
+
+    if ( !m_outputFolder.empty() )
+    {
+        std::string filename;
+        Core::Utils::stringPrintf( filename, "%s/radiumframe_%06u.%s", m_outputFolder.c_str(), i,
+                                   m_format.c_str() );
+        m_recorder->capture( m_renderer->getDisplayTexture(), filename );
+    }
+    globjects::Framebuffer::unbind();
+    doneCurrent();
+
+    timings.frameEnd = Core::Utils::Clock::now();
+    m_timings.push_back( timings );
+}
+
+bool HeadlessRenderer::writeTimings( const std::string& filename ) const {
+    using Core::Utils::getIntervalMicro;
+
+    std::ofstream out( filename );
+    if ( !out.is_open() )
+    {
+        return false;
+    }
+
+    std::vector<Core::Utils::MicroSeconds> render, tasks, frame;
+    out << "{\n  \"frames\": [\n";
+    for ( uint i = 0; i < m_timings.size(); ++i )
+    {
+        const FrameTimings& t = m_timings[i];
+        render.push_back( getIntervalMicro( t.frameStart, t.renderEnd ) );
+        tasks.push_back( getIntervalMicro( t.renderEnd, t.tasksEnd ) );
+        frame.push_back( getIntervalMicro( t.frameStart, t.frameEnd ) );
+        out << "    {\"frame\": " << i << ", \"render_us\": " << render.back()
+            << ", \"tasks_us\": " << tasks.back() << ", \"frame_us\": " << frame.back() << "}"
+            << ( i + 1 < m_timings.size() ? ",\n" : "\n" );
+    }
+    out << "  ],\n  \"summary\": {";
+    const std::pair<const char*, const std::vector<Core::Utils::MicroSeconds>*> series[] = {
+        {"render", &render}, {"tasks", &tasks}, {"frame", &frame}};
+    for ( uint s = 0; s < 3; ++s )
+    {
+        out << ( s == 0 ? "\n" : ",\n" ) << "    \"" << series[s].first << "\": {\"p50_us\": "
+            << Core::Utils::getPercentile( *series[s].second, 0.5f )
+            << ", \"p99_us\": " << Core::Utils::getPercentile( *series[s].second, 0.99f ) << "}";
+    }
+    out << "\n  }\n}\n";
+    return true;
+}
+
+} // namespace Ra
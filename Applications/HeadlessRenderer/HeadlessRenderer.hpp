@@ -0,0 +1,130 @@
+#ifndef RADIUMENGINE_HEADLESSRENDERER_HPP
+#define RADIUMENGINE_HEADLESSRENDERER_HPP
+
+#include <Core/Utils/Timer.hpp>
+
+#include <QApplication>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class QOffscreenSurface;
+class QOpenGLContext;
+class QSurfaceFormat;
+
+namespace globjects {
+class Framebuffer;
+class Renderbuffer;
+} // namespace globjects
+
+namespace Ra {
+namespace Core {
+namespace Utils {
+class TaskQueue;
+}
+} // namespace Core
+namespace Engine {
+class Camera;
+class DirectionalLight;
+class RadiumEngine;
+class Renderer;
+} // namespace Engine
+namespace Gui {
+class FrameRecorder;
+}
+class EglContext;
+} // namespace Ra
+
+namespace Ra {
+
+/**
+ * Application rendering scene files into images without any window, e.g. on a build server
+ * or a render farm. The OpenGL context is created on an offscreen surface, and the frames are
+ * rendered into a framebuffer object of the requested size.
+ * The camera turns around the loaded scene, one full turn over the rendered frames.
+ *
+ * When built with EGL ( HEADLESS_USE_EGL, on Linux ), the context is created through EGL without
+ * any surface ( see EglContext ), which works without a display server, e.g. with Mesa's llvmpipe
+ * or on a GPU of a render farm. Otherwise, or if EGL fails, the context is created by Qt on an
+ * offscreen surface. Qt's "offscreen" platform creates it through GLX, which needs an X server :
+ * without one, use an EGL based platform ( "-platform eglfs" or "-platform minimalegl" ).
+ */
+class HeadlessRenderer : public QApplication {
+  public:
+    /// Timings of one rendered frame.
+    struct FrameTimings {
+        Core::Utils::TimePoint frameStart;
+        Core::Utils::TimePoint renderEnd;
+        Core::Utils::TimePoint tasksEnd;
+        Core::Utils::TimePoint frameEnd;
+    };
+
+    /// IMPORTANT : argc must be a reference, see QApplication.
+    HeadlessRenderer( int& argc, char** argv );
+
+    ~HeadlessRenderer();
+
+    /// Render all the frames. Returns the exit code of the application.
+    int run();
+
+  private:
+    /// Create the OpenGL context and the objects depending on it. Returns false on failure.
+    bool initializeGL();
+
+    /// Create the OpenGL context through EGL if available, else through Qt, and make it
+    /// current. Returns false on failure.
+    bool createContext( const QSurfaceFormat& format );
+
+    /// Make the OpenGL context current, returns false if there is none.
+    bool makeCurrent();
+    void doneCurrent();
+
+    /// Load the plugins adding file loaders or systems, their GUI part is ignored.
+    bool loadPlugins( const std::string& pluginsPath, const QStringList& loadList,
+                      const QStringList& ignoreList );
+
+    /// Place the camera ( and the headlight ) on the orbit around the scene for frame i.
+    void placeCamera( uint i );
+
+    /// Render, run the engine tasks and capture frame i.
+    void renderFrame( uint i, Scalar dt );
+
+    /// Write the per frame timings and their percentiles as JSON.
+    bool writeTimings( const std::string& filename ) const;
+
+  private:
+    /// Context created through EGL, if any, else through Qt on the offscreen surface.
+    std::unique_ptr<EglContext> m_eglContext;
+    std::unique_ptr<QOffscreenSurface> m_surface;
+    std::unique_ptr<QOpenGLContext> m_context;
+    std::string m_contextPlatform; ///< Description of the platform of the context, for the logs.
+
+    std::unique_ptr<Engine::RadiumEngine> m_engine;
+    std::unique_ptr<Core::Utils::TaskQueue> m_taskQueue;
+    std::unique_ptr<Engine::Renderer> m_renderer;
+    std::unique_ptr<Engine::Camera> m_camera;
+    Engine::DirectionalLight* m_light; ///< Owned by the system entity.
+
+    std::unique_ptr<globjects::Framebuffer> m_fbo;
+    std::unique_ptr<globjects::Renderbuffer> m_colorBuffer;
+    std::unique_ptr<globjects::Renderbuffer> m_depthBuffer;
+    std::unique_ptr<Gui::FrameRecorder> m_recorder;
+
+    std::vector<FrameTimings> m_timings;
+
+    uint m_width;
+    uint m_height;
+    uint m_numFrames;
+    uint m_maxThreads;
+    bool m_initialized;
+
+    std::vector<std::string> m_files;
+    std::string m_outputFolder;
+    std::string m_format;
+    std::string m_timingsFile;
+};
+
+} // namespace Ra
+
+#endif // RADIUMENGINE_HEADLESSRENDERER_HPP
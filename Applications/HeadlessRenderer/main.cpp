@@ -0,0 +1,19 @@
+#include <HeadlessRenderer.hpp>
+
+#include <cstdlib>
+
+int main( int argc, char** argv ) {
+    // Without a display server, use the offscreen platform unless one was requested
+    // ( "-platform" option or QT_QPA_PLATFORM ). It is enough for the application itself, the
+    // OpenGL context is created through EGL when available ( see HeadlessRenderer ).
+#ifdef OS_LINUX
+    if ( !std::getenv( "DISPLAY" ) && !std::getenv( "WAYLAND_DISPLAY" ) &&
+         !std::getenv( "QT_QPA_PLATFORM" ) )
+    {
+        setenv( "QT_QPA_PLATFORM", "offscreen", 0 );
+    }
+#endif
+
+    Ra::HeadlessRenderer app( argc, argv );
+    return app.run();
+}
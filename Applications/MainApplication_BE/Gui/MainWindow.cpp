@@ -3,10 +3,12 @@
 
 #include <Core/Asset/FileLoaderInterface.hpp>
 #include <Core/Asset/deprecated/OBJFileManager.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Engine/Entity/Entity.hpp>
 #include <Engine/Managers/EntityManager/EntityManager.hpp>
 #include <Engine/Managers/SignalManager/SignalManager.hpp>
 #include <Engine/Renderer/Mesh/Mesh.hpp>
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
 #include <Engine/Renderer/RenderObject/RenderObject.hpp>
 #include <Engine/Renderer/RenderObject/RenderObjectManager.hpp>
 #include <Engine/Renderer/RenderTechnique/RenderTechnique.hpp>
@@ -60,7 +62,7 @@ MainWindow::MainWindow( QWidget* parent ) : MainWindowInterface( parent ) {
     m_entitiesTreeView->setModel( m_itemModel );
     m_materialEditor = new MaterialEditor();
     m_selectionManager = new GuiBase::SelectionManager( m_itemModel, this );
-    m_entitiesTreeView->setSelectionModel( m_selectionManager );
+    m_entitiesTreeView->setSelectionModel( m_selectionManager );
     m_edition = new EditionWidget(nullptr, m_selectionManager);
     this->layoutForEdition->addWidget(m_edition);
     m_lightCreator = new Gui::LightCreator(this,m_viewer);
@@ -231,19 +233,54 @@ void MainWindow::onUpdateFramestats( const std::vector<FrameTimerData>& stats )
         QString( "Rendering %1 faces and %2 vertices" ).arg( polycount ).arg( vertexcount );
     m_labelCount->setText( polyCountText );
 
+    // GPU memory, detailed by resource type in the tooltip.
+    const auto gpuUsage = Engine::GpuMemoryTracker::getUsage();
+    const Scalar MB = 1 << 20;
+    std::size_t gpuResident = 0;
+    std::size_t gpuEvicted = 0;
+    QString gpuDetails;
+    for ( uint i = 0; i < gpuUsage.size(); ++i )
+    {
+        const auto& u = gpuUsage[i];
+        gpuResident += u.m_residentSize;
+        gpuEvicted += u.m_evictedSize;
+        gpuDetails += QString( "%1%2 : %3 MB in %4 resources, %5 MB in %6 evicted" )
+                          .arg( i > 0 ? "\n" : "" )
+                          .arg( Engine::GpuMemoryTracker::getTypeName(
+                              Engine::GpuMemoryTracker::ResourceType( i ) ) )
+                          .arg( u.m_residentSize / MB, 0, 'f', 1 )
+                          .arg( u.m_numResources - u.m_numEvicted )
+                          .arg( u.m_evictedSize / MB, 0, 'f', 1 )
+                          .arg( u.m_numEvicted );
+    }
+    m_labelGpuMemory->setText( QString( "GPU memory : %1 MB (%2 MB evicted)" )
+                                   .arg( gpuResident / MB, 0, 'f', 1 )
+                                   .arg( gpuEvicted / MB, 0, 'f', 1 ) );
+    m_labelGpuMemory->setToolTip( gpuDetails );
+
     long sumEvents = 0;
     long sumRender = 0;
     long sumTasks = 0;
     long sumFrame = 0;
     long sumInterFrame = 0;
 
+    // Per frame durations, for the percentiles.
+    std::vector<Core::Utils::MicroSeconds> events( stats.size() );
+    std::vector<Core::Utils::MicroSeconds> render( stats.size() );
+    std::vector<Core::Utils::MicroSeconds> tasks( stats.size() );
+    std::vector<Core::Utils::MicroSeconds> frame( stats.size() );
+
     for ( uint i = 0; i < stats.size(); ++i )
     {
-        sumEvents += Core::Utils::getIntervalMicro( stats[i].eventsStart, stats[i].eventsEnd );
-        sumRender += Core::Utils::getIntervalMicro( stats[i].renderData.renderStart,
-                                                    stats[i].renderData.renderEnd );
-        sumTasks += Core::Utils::getIntervalMicro( stats[i].tasksStart, stats[i].tasksEnd );
-        sumFrame += Core::Utils::getIntervalMicro( stats[i].frameStart, stats[i].frameEnd );
+        events[i] = Core::Utils::getIntervalMicro( stats[i].eventsStart, stats[i].eventsEnd );
+        render[i] = Core::Utils::getIntervalMicro( stats[i].renderData.renderStart,
+                                                   stats[i].renderData.renderEnd );
+        tasks[i] = Core::Utils::getIntervalMicro( stats[i].tasksStart, stats[i].tasksEnd );
+        frame[i] = Core::Utils::getIntervalMicro( stats[i].frameStart, stats[i].frameEnd );
+        sumEvents += events[i];
+        sumRender += render[i];
+        sumTasks += tasks[i];
+        sumFrame += frame[i];
 
         if ( i > 0 )
         {
@@ -264,6 +301,16 @@ void MainWindow::onUpdateFramestats( const std::vector<FrameTimerData>& stats )
     m_frameTime->setNum( int( sumFrame / N ) );
     m_frameUpdates->setNum( int( T / Scalar( sumFrame ) ) );
     m_avgFramerate->setNum( int( ( N - 1 ) * Scalar( 1000000.0 / sumInterFrame ) ) );
+
+    auto percentiles = []( const std::vector<Core::Utils::MicroSeconds>& durations ) {
+        return QString( "%1 / %2" )
+            .arg( Core::Utils::getPercentile( durations, 0.5 ) )
+            .arg( Core::Utils::getPercentile( durations, 0.99 ) );
+    };
+    m_eventsPercentiles->setText( percentiles( events ) );
+    m_renderPercentiles->setText( percentiles( render ) );
+    m_tasksPercentiles->setText( percentiles( tasks ) );
+    m_framePercentiles->setText( percentiles( frame ) );
 }
 
 Viewer* MainWindow::getViewer() {
@@ -418,6 +465,7 @@ void MainWindow::changeRenderObjectShader( const QString& shaderName ) {
         if ( ro->getRenderTechnique()->getConfiguration().m_name != name )
         {
             ro->getRenderTechnique()->setConfiguration( config );
+            ro->setDirty();
         }
     }
 }
@@ -575,7 +623,10 @@ void MainWindow::resetScene() {
 }
 
 void MainWindow::fitCamera() {
-    auto aabb = Engine::RadiumEngine::getInstance()->getRenderObjectManager()->getSceneAabb();
+    // The scene may have changed since the end of the last frame, e.g. a file was loaded.
+    auto roManager = Engine::RadiumEngine::getInstance()->getRenderObjectManager();
+    roManager->updateSceneAabb();
+    auto aabb = roManager->getSceneAabb();
     if ( aabb.isEmpty() )
         m_viewer->getCameraInterface()->resetCamera();
     else
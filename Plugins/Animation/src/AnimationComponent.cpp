@@ -80,6 +80,7 @@ void AnimationComponent::update( Scalar dt ) {
 
         // update the pose of the skeleton
         m_skel.setPose( currentPose, Ra::Core::Animation::Handle::SpaceType::LOCAL );
+        notifySkeletonChanged();
     }
 
     // update the render objects
@@ -135,6 +136,7 @@ void AnimationComponent::printSkeleton( const Ra::Core::Animation::Skeleton& ske
 void AnimationComponent::reset() {
     m_animationTime = 0;
     m_skel.setPose( m_refPose, Ra::Core::Animation::Handle::SpaceType::MODEL );
+    notifySkeletonChanged();
     for ( auto& bone : m_boneDrawables )
     {
         bone->update();
@@ -255,9 +257,8 @@ void AnimationComponent::setContentName( const std::string name ) {
 }
 
 void AnimationComponent::setupIO( const std::string& id ) {
-    ComponentMessenger::CallbackTypes<Skeleton>::Getter skelOut =
-        std::bind( &AnimationComponent::getSkeletonOutput, this );
-    ComponentMessenger::getInstance()->registerOutput<Skeleton>( getEntity(), this, id, skelOut );
+    ComponentMessenger::getInstance()->registerOutput<Skeleton>( getEntity(), this, id, &m_skel );
+    m_skeletonOutput = ComponentMessenger::getInstance()->getHandle<Skeleton>( getEntity(), id );
 
     ComponentMessenger::CallbackTypes<RefPose>::Getter refpOut =
         std::bind( &AnimationComponent::getRefPoseOutput, this );
@@ -269,9 +270,7 @@ void AnimationComponent::setupIO( const std::string& id ) {
     ComponentMessenger::getInstance()->registerOutput<Ra::Core::Animation::WeightMatrix>(
         getEntity(), this, id, wOut );
 
-    ComponentMessenger::CallbackTypes<bool>::Getter resetOut =
-        std::bind( &AnimationComponent::getWasReset, this );
-    ComponentMessenger::getInstance()->registerOutput<bool>( getEntity(), this, id, resetOut );
+    ComponentMessenger::getInstance()->registerOutput<bool>( getEntity(), this, id, &m_wasReset );
 
     ComponentMessenger::CallbackTypes<Animation>::Getter animOut =
         std::bind( &AnimationComponent::getAnimation, this );
@@ -298,6 +297,13 @@ const bool* AnimationComponent::getWasReset() const {
     return &m_wasReset;
 }
 
+void AnimationComponent::notifySkeletonChanged() {
+    if ( m_skeletonOutput.isValid() )
+    {
+        m_skeletonOutput.notifyChanged();
+    }
+}
+
 void AnimationComponent::setXray( bool on ) const {
     for ( const auto& b : m_boneDrawables )
     {
@@ -367,6 +373,7 @@ void AnimationComponent::setTransform( Ra::Core::Container::Index roIdx,
     auto diff = TBoneModel.inverse() * transform;
     m_skel.setTransform( boneIdx, TBoneLocal * diff,
                          Ra::Core::Animation::Handle::SpaceType::LOCAL );
+    notifySkeletonChanged();
 }
 
 uint AnimationComponent::getBoneIdx( Ra::Core::Container::Index index ) const {
@@ -11,6 +11,7 @@
 #include <Core/Asset/HandleData.hpp>
 
 #include <Engine/Component/Component.hpp>
+#include <Engine/Managers/ComponentMessenger/ComponentMessenger.hpp>
 
 #include <memory>
 
@@ -94,10 +95,15 @@ class ANIM_PLUGIN_API AnimationComponent : public Ra::Engine::Component {
     // Internal function to create the bone display objects.
     void setupSkeletonDisplay();
 
+    // Internal function to tell the skeleton consumers that the pose has changed.
+    void notifySkeletonChanged();
+
   private:
     std::string m_contentName;
 
     Ra::Core::Animation::Skeleton m_skel;   // Skeleton
+    Ra::Engine::ComponentMessenger::Handle<Ra::Core::Animation::Skeleton>
+        m_skeletonOutput; // Skeleton output, used to notify the skeleton changes
     Ra::Core::Animation::RefPose m_refPose; // Ref pose in model space.
     std::vector<Ra::Core::Animation::Animation> m_animations;
     Ra::Core::Animation::WeightMatrix m_weights; // Skinning weights ( should go in skinning )
@@ -105,6 +105,19 @@ void FancyMeshComponent::handleMeshLoading( const Ra::Core::Asset::GeometryData*
 
     displayMesh->loadGeometry( mesh );
 
+    if ( data->hasLods() )
+    {
+        // The levels index the vertices of the asset, i.e. of the mesh. Their errors are
+        // scaled by the frame, as the vertices.
+        auto lods = data->getLods();
+        const Scalar scale = T.linear().colwise().norm().maxCoeff();
+        for ( auto& lod : lods )
+        {
+            lod.m_error *= scale;
+        }
+        displayMesh->setLods( lods );
+    }
+
     // get the actual duplicate table according to the mesh, not to the file data.
     if ( !data->isLoadingDuplicates() )
     {
@@ -24,6 +24,13 @@ void FancyMeshSystem::handleAssetLoading( Ra::Engine::Entity* entity,
                                           const Ra::Core::Asset::FileData* fileData ) {
     auto geomData = fileData->getGeometryData();
 
+    // Levels of detail of the meshes, kept with the asset (see GeometryData::computeLods()).
+#pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < int( geomData.size() ); ++i )
+    {
+        geomData[i]->computeLods();
+    }
+
     uint id = 0;
 
     for ( const auto& data : geomData )
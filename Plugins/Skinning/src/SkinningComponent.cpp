@@ -2,6 +2,7 @@
 
 #include <Core/Animation/PoseOperation.hpp>
 #include <Core/Geometry/Normal.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 #include <Core/Animation/DualQuaternionSkinning.hpp>
 #include <Core/Animation/RotationCenterSkinning.hpp>
@@ -32,7 +33,9 @@ void SkinningComponent::setupSkinning() {
 
     if ( hasSkel && hasWeights && hasMesh && hasRefPose )
     {
-        m_skeletonGetter = compMsg->getterCallback<Skeleton>( getEntity(), m_contentsName );
+        m_skeletonReader = compMsg->getHandle<Skeleton>( getEntity(), m_contentsName );
+        m_resetReader = compMsg->getHandle<bool>( getEntity(), m_contentsName );
+        CORE_ASSERT( m_resetReader.canGet(), "Animation reset flag is not available" );
         m_verticesWriter =
             compMsg->rwCallback<Ra::Core::Container::Vector3Array>( getEntity(), m_contentsName + "v" );
         m_normalsWriter =
@@ -45,6 +48,10 @@ void SkinningComponent::setupSkinning() {
         m_refData.m_refPose = compMsg->get<RefPose>( getEntity(), m_contentsName );
         m_refData.m_weights = compMsg->get<WeightMatrix>( getEntity(), m_contentsName );
 
+        m_vertexNormals.setTopology( m_refData.m_referenceMesh.m_vertices.size(),
+                                     m_refData.m_referenceMesh.m_triangles,
+                                     *( m_duplicateTableGetter() ) );
+
         m_frameData.m_previousPose = m_refData.m_refPose;
         m_frameData.m_frameCounter = 0;
         m_frameData.m_doSkinning = false;
@@ -54,6 +61,9 @@ void SkinningComponent::setupSkinning() {
         m_frameData.m_currentPos = m_refData.m_referenceMesh.m_vertices;
         m_frameData.m_currentNormal = m_refData.m_referenceMesh.m_normals;
 
+        // Make sure the first skin() compares the current pose with the reference one.
+        m_skeletonVersion = m_skeletonReader.getVersion() - 1;
+
         // Do some debug checks:  Attempt to write to the mesh and check the weights match skeleton
         // and mesh.
         ON_ASSERT( bool skinnable =
@@ -72,20 +82,21 @@ void SkinningComponent::setupSkinning() {
 }
 
 void SkinningComponent::skin() {
+    RA_PROFILE_SCOPE( "SkinningComponent::skin" );
     CORE_ASSERT( m_isReady, "Skinning is not setup" );
 
-    const Skeleton* skel = m_skeletonGetter();
-
-    bool reset = ComponentMessenger::getInstance()->get<bool>( getEntity(), m_contentsName );
+    const bool reset = m_resetReader.get();
 
     // Reset the skin if it wasn't done before
     if ( reset && !m_frameData.m_doReset )
     {
         m_frameData.m_doReset = true;
         m_frameData.m_frameCounter = 0;
-    } else
+    } else if ( m_skeletonReader.getVersion() != m_skeletonVersion )
     {
-        m_frameData.m_currentPose = skel->getPose( SpaceType::MODEL );
+        // The skeleton has been modified since the last skinning, check its pose.
+        m_skeletonVersion = m_skeletonReader.getVersion();
+        m_frameData.m_currentPose = m_skeletonReader.get().getPose( SpaceType::MODEL );
         if ( !Ra::Core::Animation::areEqual( m_frameData.m_currentPose,
                                              m_frameData.m_previousPose ) )
         {
@@ -130,6 +141,7 @@ void SkinningComponent::skin() {
 }
 
 void SkinningComponent::endSkinning() {
+    RA_PROFILE_SCOPE( "SkinningComponent::endSkinning" );
     if ( m_frameData.m_doSkinning )
     {
         Ra::Core::Container::Vector3Array& vertices = *( m_verticesWriter() );
@@ -137,8 +149,7 @@ void SkinningComponent::endSkinning() {
 
         vertices = m_frameData.m_currentPos;
 
-        Ra::Core::Geometry::uniformNormal( vertices, m_refData.m_referenceMesh.m_triangles,
-                                           *( m_duplicateTableGetter() ), normals );
+        m_vertexNormals.compute( vertices, normals );
 
         std::swap( m_frameData.m_previousPose, m_frameData.m_currentPose );
         std::swap( m_frameData.m_previousPos, m_frameData.m_currentPos );
@@ -219,7 +230,21 @@ void SkinningComponent::setupSkinningType( SkinningType type ) {
     {
         if ( m_refData.m_CoR.empty() )
         {
-            Ra::Core::Animation::computeCoR( m_refData );
+            // The centers of rotation only depend on the reference mesh and the weights,
+            // reuse the ones computed the last time the asset has been loaded.
+            std::string cacheFile;
+            if ( !m_corCacheName.empty() )
+            {
+                cacheFile = Ra::Core::Animation::getCoRCacheFile( m_corCacheName, m_refData );
+            }
+            if ( cacheFile.empty() || !Ra::Core::Animation::loadCoR( cacheFile, m_refData ) )
+            {
+                Ra::Core::Animation::computeCoR( m_refData );
+                if ( !cacheFile.empty() )
+                {
+                    Ra::Core::Animation::saveCoR( cacheFile, m_refData );
+                }
+            }
             /*
                        for ( const auto& v :m_refData.m_CoR )
                        {
@@ -9,6 +9,7 @@
 #include <Core/Asset/HandleData.hpp>
 #include <Core/Math/DualQuaternion.hpp>
 #include <Core/Geometry/TriangleMesh.hpp>
+#include <Core/Geometry/VertexNormals.hpp>
 
 #include <Engine/Component/Component.hpp>
 #include <Engine/Managers/ComponentMessenger/ComponentMessenger.hpp>
@@ -24,6 +25,7 @@ class SKIN_PLUGIN_API SkinningComponent : public Ra::Engine::Component {
 
     SkinningComponent( const std::string& name, SkinningType type, Ra::Engine::Entity* entity ) :
         Component( name, entity ),
+        m_skeletonVersion( 0 ),
         m_skinningType( type ),
         m_isReady( false ) {}
     virtual ~SkinningComponent() {}
@@ -48,15 +50,24 @@ class SKIN_PLUGIN_API SkinningComponent : public Ra::Engine::Component {
     void setupSkinningType( SkinningType type );
     void setContentsName( const std::string name );
 
+    /// Set the prefix of the file caching the centers of rotation, usually the name of
+    /// the asset file. No cache is used if empty.
+    void setCoRCacheName( const std::string& name ) { m_corCacheName = name; }
+
   private:
     std::string m_contentsName;
+    std::string m_corCacheName;
 
     // Skinning data
     Ra::Core::Animation::RefData m_refData;
     Ra::Core::Animation::FrameData m_frameData;
 
-    Ra::Engine::ComponentMessenger::CallbackTypes<Ra::Core::Animation::Skeleton>::Getter
-        m_skeletonGetter;
+    // Pre-resolved handles on the animation data read each frame.
+    Ra::Engine::ComponentMessenger::Handle<Ra::Core::Animation::Skeleton> m_skeletonReader;
+    Ra::Engine::ComponentMessenger::Handle<bool> m_resetReader;
+    // Version of the skeleton at the last skinning.
+    uint m_skeletonVersion;
+
     Ra::Engine::ComponentMessenger::CallbackTypes<std::vector<Ra::Core::Container::Index>>::Getter
         m_duplicateTableGetter;
 
@@ -67,6 +78,9 @@ class SKIN_PLUGIN_API SkinningComponent : public Ra::Engine::Component {
 
     Ra::Core::Container::AlignedStdVector<Ra::Core::Math::DualQuaternion> m_DQ;
 
+    // Normals of the skinned mesh, its topology being set once.
+    Ra::Core::Geometry::VertexNormals m_vertexNormals;
+
     SkinningType m_skinningType;
     bool m_isReady;
 };
@@ -51,6 +51,7 @@ class SKIN_PLUGIN_API SkinningSystem : public Ra::Engine::System {
                 SkinningComponent* component = new SkinningComponent(
                     "SkC_" + skel->getName(), SkinningComponent::LBS, entity );
                 component->handleWeightsLoading( skel );
+                component->setCoRCacheName( fileData->getFileName() );
                 registerComponent( entity, component );
 
                 SkinningDisplayComponent* display = new SkinningDisplayComponent(
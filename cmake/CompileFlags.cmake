@@ -142,6 +142,11 @@ if (${RADIUM_WITH_PROFILING})
     message(STATUS "${PROJECT_NAME} : Profiling is enabled")
 endif()
 
+if (NOT "${RADIUM_LOG_MAX_LEVEL}" STREQUAL "")
+    add_definitions(-DFILELOG_MAX_LEVEL=Ra::Core::Utils::log${RADIUM_LOG_MAX_LEVEL})
+    message(STATUS "${PROJECT_NAME} : Log messages above ${RADIUM_LOG_MAX_LEVEL} are stripped")
+endif()
+
 if (${RADIUM_WARNINGS_AS_ERRORS})
     message(STATUS "${PROJECT_NAME} : Enabling warnings as errors")
     if ( APPLE OR ( UNIX OR MINGW ) )
@@ -1,5 +1,13 @@
 #include <Core/Animation/RotationCenterSkinning.hpp>
 
+#include <Core/Geometry/TriangleOperation.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
 namespace Ra {
 namespace Core {
 namespace Animation {
@@ -36,137 +44,464 @@ Scalar weightSimilarity( const Eigen::SparseVector<Scalar>& v1w,
     return result;
 }
 
-void computeCoR( RefData& dataInOut, Scalar sigma, Scalar weightEpsilon ) {
-    LOG( Utils::logDEBUG ) << "Precomputing CoRs";
-
-    // First step : subdivide the original mesh until weights are sufficiently close enough.
-    Scalar maxWeightDistance = 0.f;
-    Geometry::TriangleMesh subdividedMesh = dataInOut.m_referenceMesh;
-
-    // Store the weights as row major here because we are going to query the per-vertex weights.
-    Eigen::SparseMatrix<Scalar, Eigen::RowMajor> subdividedWeights = dataInOut.m_weights;
+namespace {
+/// Non zero weights of a vertex or a triangle : (handle, weight) pairs sorted by handle.
+using SparseWeights = std::vector<std::pair<uint, Scalar>>;
 
-    // Convert the mesh to DCEL for easy processing.
-    Core::Dcel dcel;
-    Geometry::convert(subdividedMesh, dcel );
-    // The mesh will be subdivided by repeated edge-split, so that adjacent vertices
-    // weights are distant of at most `weightEpsilon`.
-    // New vertices created by the edge splitting and their new weights are computed
-    // and appended to the existing vertices.
-    do
+/// Euclidean distance between two weight vectors.
+Scalar weightDistance( const SparseWeights& w1, const SparseWeights& w2 ) {
+    Scalar dist = 0;
+    auto it1 = w1.begin();
+    auto it2 = w2.begin();
+    while ( it1 != w1.end() || it2 != w2.end() )
     {
-        maxWeightDistance = 0;
-
-        // Stores the edges to split
-        std::vector<Container::Index> edgesToSplit;
-
-        // Compute all weights distances for all edges.
-        for ( const auto& edge : dcel.m_fulledge )
+        if ( it2 == w2.end() || ( it1 != w1.end() && it1->first < it2->first ) )
+        {
+            dist += it1->second * it1->second;
+            ++it1;
+        } else if ( it1 == w1.end() || it2->first < it1->first )
+        {
+            dist += it2->second * it2->second;
+            ++it2;
+        } else
         {
-            Vertex_ptr v1 = edge->V( 0 );
-            Vertex_ptr v2 = edge->V( 1 );
+            dist += Math::ipow<2>( it1->second - it2->second );
+            ++it1;
+            ++it2;
+        }
+    }
+    return std::sqrt( dist );
+}
 
-            Scalar weightDistance =
-                ( subdividedWeights.row( v1->idx ) - subdividedWeights.row( v2->idx ) ).norm();
+/// Returns the sum of the given weight vectors multiplied by s.
+SparseWeights weightAverage( const std::vector<const SparseWeights*>& weights, Scalar s ) {
+    SparseWeights result;
+    for ( const auto w : weights )
+    {
+        result.insert( result.end(), w->begin(), w->end() );
+    }
+    std::sort( result.begin(), result.end() );
+    uint n = 0;
+    for ( uint i = 0; i < result.size(); ++i )
+    {
+        if ( n > 0 && result[n - 1].first == result[i].first )
+        {
+            result[n - 1].second += result[i].second;
+        } else
+        { result[n++] = result[i]; }
+    }
+    result.resize( n );
+    for ( auto& w : result )
+    {
+        w.second *= s;
+    }
+    return result;
+}
 
-            maxWeightDistance = std::max( maxWeightDistance, weightDistance );
-            if ( weightDistance > weightEpsilon )
+/// Subdivide the mesh by splitting all its edges whose ends have weights farther than
+/// weightEpsilon at their middle, until none is left. The new vertices are appended to the
+/// existing ones. Each triangle is split along its split edges only, the neighbor triangles
+/// splitting the same edges so that no T-junction is created.
+void subdivide( Container::Vector3Array& vertices, std::vector<SparseWeights>& weights,
+                Container::VectorArray<Geometry::Triangle>& triangles, Scalar weightEpsilon ) {
+    bool split = true;
+    while ( split )
+    {
+        split = false;
+        // Index of the middle vertex of each edge, or -1 if it is not split.
+        std::unordered_map<uint64_t, int> middles;
+        auto getMiddle = [&]( uint a, uint b ) {
+            const uint64_t key = ( uint64_t( std::min( a, b ) ) << 32 ) | std::max( a, b );
+            auto it = middles.find( key );
+            if ( it == middles.end() )
             {
-                edgesToSplit.push_back( edge->idx );
+                int middle = -1;
+                if ( weightDistance( weights[a], weights[b] ) > weightEpsilon )
+                {
+                    middle = int( vertices.size() );
+                    vertices.push_back( 0.5f * ( vertices[a] + vertices[b] ) );
+                    weights.push_back( weightAverage( {&weights[a], &weights[b]}, 0.5f ) );
+                }
+                it = middles.emplace( key, middle ).first;
             }
-        }
+            return it->second;
+        };
 
-        LOG( Utils::logDEBUG ) << "Max weight distance is " << maxWeightDistance;
-
-        // We found some edges over the limit, so we split them.
-        if ( !edgesToSplit.empty() )
+        Container::VectorArray<Geometry::Triangle> subdivided;
+        subdivided.reserve( triangles.size() );
+        for ( const auto& t : triangles )
         {
-            LOG( Utils::logDEBUG ) << "Splitting " << edgesToSplit.size() << " edges";
-            int startIndex = subdividedWeights.rows();
-            int numCols = subdividedWeights.cols();
+            std::array<int, 3> m;
+            uint numSplit = 0;
+            for ( uint i = 0; i < 3; ++i )
+            {
+                m[i] = getMiddle( t[i], t[( i + 1 ) % 3] );
+                numSplit += m[i] >= 0 ? 1 : 0;
+            }
+            if ( numSplit == 3 )
+            {
+                subdivided.push_back( {t[0], uint( m[0] ), uint( m[2] )} );
+                subdivided.push_back( {uint( m[0] ), t[1], uint( m[1] )} );
+                subdivided.push_back( {uint( m[2] ), uint( m[1] ), t[2]} );
+                subdivided.push_back( {uint( m[0] ), uint( m[1] ), uint( m[2] )} );
+            } else if ( numSplit > 0 )
+            {
+                // Rotate the triangle so that the edge (v0, v1) is split, and the edge
+                // (v2, v0) is not.
+                uint r = 0;
+                while ( m[r] < 0 || m[( r + 2 ) % 3] >= 0 )
+                {
+                    ++r;
+                }
+                const uint v0 = t[r];
+                const uint v1 = t[( r + 1 ) % 3];
+                const uint v2 = t[( r + 2 ) % 3];
+                const uint m0 = uint( m[r] );
+                const int m1 = m[( r + 1 ) % 3];
+                if ( m1 < 0 )
+                {
+                    subdivided.push_back( {v0, m0, v2} );
+                    subdivided.push_back( {m0, v1, v2} );
+                } else
+                {
+                    subdivided.push_back( {m0, v1, uint( m1 )} );
+                    subdivided.push_back( {v0, m0, uint( m1 )} );
+                    subdivided.push_back( {v0, uint( m1 ), v2} );
+                }
+            } else
+            { subdivided.push_back( t ); }
+            split = split || numSplit > 0;
+        }
+        std::swap( triangles, subdivided );
+    }
+}
 
-            Eigen::SparseMatrix<Scalar, Eigen::RowMajor> newWeights(
-                startIndex + edgesToSplit.size(), numCols );
+/// Triangles of the subdivided mesh influenced by the same handles.
+struct TriangleCluster {
+    /// Handles influencing the triangles, sorted.
+    std::vector<uint> m_handles;
+    /// Weights of the handles, m_handles.size() per triangle.
+    std::vector<Scalar> m_weights;
+    /// Area of the triangles.
+    std::vector<Scalar> m_areas;
+    /// Area weighted centroids of the triangles.
+    Container::Vector3Array m_centroids;
+};
+
+/// Number of bins per sigma along each weight, in which the triangles of a cluster are merged.
+constexpr Scalar CoRWeightBinsPerSigma = 32;
+} // namespace
 
-            newWeights.topRows( startIndex ) = subdividedWeights;
-            subdividedWeights = newWeights;
+void computeCoR( RefData& dataInOut, Scalar sigma, Scalar weightEpsilon ) {
+    LOG( Utils::logDEBUG ) << "Precomputing CoRs";
+    CORE_ASSERT( weightEpsilon > 0, "The subdivision would not end" );
 
-            int i = 0;
+    const uint nVerts = dataInOut.m_referenceMesh.m_vertices.size();
+    CORE_ASSERT( dataInOut.m_weights.rows() == int( nVerts ), "Weights and vertices don't match" );
 
-            // Split ALL the edges !
-            for ( const auto& edge : edgesToSplit )
+    // Store the weights as row major here because we are going to query the per-vertex weights.
+    const Eigen::SparseMatrix<Scalar, Eigen::RowMajor> rowWeights = dataInOut.m_weights;
+    std::vector<SparseWeights> weights( nVerts );
+    for ( uint i = 0; i < nVerts; ++i )
+    {
+        for ( Eigen::SparseMatrix<Scalar, Eigen::RowMajor>::InnerIterator it( rowWeights, i ); it;
+              ++it )
+        {
+            if ( it.value() > 0 )
             {
-                int V1Idx = dcel.m_fulledge[edge]->V( 0 )->idx;
-                int V2Idx = dcel.m_fulledge[edge]->V( 1 )->idx;
-
-                DcelOperations::splitEdge( dcel, edge, 0.5f );
-                subdividedWeights.row( startIndex + i ) =
-                    0.5f * ( subdividedWeights.row( V1Idx ) + subdividedWeights.row( V2Idx ) );
-                ++i;
+                weights[i].emplace_back( uint( it.index() ), it.value() );
             }
         }
-        edgesToSplit.clear();
-
-    } while ( maxWeightDistance > weightEpsilon );
-
-    // get the subdivided mesh back into mesh form.
-    convert( dcel, subdividedMesh );
+    }
 
-    // Second step : evaluate the integrals over all triangles for all vertices.
-    CORE_ASSERT( subdividedMesh.m_vertices.size() == subdividedWeights.rows(),
-                 "Weights and vertices don't match" );
+    // First step : subdivide the original mesh until weights are sufficiently close enough.
+    Container::Vector3Array vertices = dataInOut.m_referenceMesh.m_vertices;
+    Container::VectorArray<Geometry::Triangle> triangles = dataInOut.m_referenceMesh.m_triangles;
+    subdivide( vertices, weights, triangles, weightEpsilon );
+    LOG( Utils::logDEBUG ) << "Subdivided mesh has " << triangles.size() << " triangles";
+
+    // Second step : cluster the triangles by the handles influencing them. The similarity of a
+    // triangle with a vertex is 0 unless two handles influence both of them, so the triangles
+    // influenced by a single handle are dropped.
+    // Within a cluster, the triangles whose weights fall in the same bin of size WeightStep
+    // are merged : their similarity with any vertex is replaced by the one of their mean
+    // weights, which is exact for equal weights and changes the exponent of the similarity by
+    // less than WeightStep / sigma otherwise.
+    const Scalar WeightStep = sigma / CoRWeightBinsPerSigma;
+    std::vector<TriangleCluster> clusters;
+    std::map<std::vector<uint>, uint> clusterIndices;
+    // Index of the merged triangle of each bin of each cluster, and number of triangles in it.
+    std::vector<std::map<std::vector<int>, uint>> clusterBins;
+    std::vector<std::vector<uint>> binSizes;
+    std::vector<int> bin;
+    for ( const auto& t : triangles )
+    {
+        const SparseWeights triWeight =
+            weightAverage( {&weights[t[0]], &weights[t[1]], &weights[t[2]]}, 1 / 3.f );
+        if ( triWeight.size() < 2 )
+        {
+            continue;
+        }
+        std::vector<uint> handles( triWeight.size() );
+        for ( uint i = 0; i < triWeight.size(); ++i )
+        {
+            handles[i] = triWeight[i].first;
+        }
+        auto it = clusterIndices.find( handles );
+        if ( it == clusterIndices.end() )
+        {
+            it = clusterIndices.emplace( handles, clusters.size() ).first;
+            clusters.emplace_back();
+            clusters.back().m_handles = handles;
+            clusterBins.emplace_back();
+            binSizes.emplace_back();
+        }
+        const uint c = it->second;
+        TriangleCluster& cluster = clusters[c];
+        bin.resize( triWeight.size() );
+        for ( uint i = 0; i < triWeight.size(); ++i )
+        {
+            bin[i] = int( std::floor( triWeight[i].second / WeightStep ) );
+        }
+        auto binIt = clusterBins[c].emplace( bin, cluster.m_areas.size() );
+        const uint merged = binIt.first->second;
+        if ( binIt.second )
+        {
+            cluster.m_weights.resize( cluster.m_weights.size() + triWeight.size(), 0 );
+            cluster.m_areas.push_back( 0 );
+            cluster.m_centroids.push_back( Math::Vector3::Zero() );
+            binSizes[c].push_back( 0 );
+        }
+        for ( uint i = 0; i < triWeight.size(); ++i )
+        {
+            cluster.m_weights[merged * triWeight.size() + i] += triWeight[i].second;
+        }
+        const Scalar area = Geometry::triangleArea( vertices[t[0]], vertices[t[1]], vertices[t[2]] );
+        cluster.m_areas[merged] += area;
+        cluster.m_centroids[merged] +=
+            area * ( vertices[t[0]] + vertices[t[1]] + vertices[t[2]] ) / 3.f;
+        ++binSizes[c][merged];
+    }
+    uint numMerged = 0;
+    for ( uint c = 0; c < clusters.size(); ++c )
+    {
+        const uint stride = clusters[c].m_handles.size();
+        for ( uint i = 0; i < clusters[c].m_weights.size(); ++i )
+        {
+            clusters[c].m_weights[i] /= binSizes[c][i / stride];
+        }
+        numMerged += clusters[c].m_areas.size();
+    }
 
-    dataInOut.m_CoR.clear();
-    dataInOut.m_CoR.reserve( dataInOut.m_referenceMesh.m_vertices.size() );
+    // Clusters influenced by each handle.
+    std::vector<std::vector<uint>> handleClusters( dataInOut.m_weights.cols() );
+    for ( uint c = 0; c < clusters.size(); ++c )
+    {
+        for ( uint h : clusters[c].m_handles )
+        {
+            handleClusters[h].push_back( c );
+        }
+    }
 
-    const uint nVerts = dataInOut.m_referenceMesh.m_vertices.size();
-    // naive implementation : iterate over all the triangles (of the subdivided mesh)
-    // for all vertices (of the original mesh).
+    // The vertices with the same weights have the same center of rotation.
+    std::map<SparseWeights, uint> uniqueIndices;
+    std::vector<const SparseWeights*> uniqueWeights;
+    std::vector<uint> vertexUnique( nVerts );
     for ( uint i = 0; i < nVerts; ++i )
     {
+        auto it = uniqueIndices.emplace( weights[i], uniqueWeights.size() );
+        if ( it.second )
+        {
+            uniqueWeights.push_back( &it.first->first );
+        }
+        vertexUnique[i] = it.first->second;
+    }
+    LOG( Utils::logDEBUG ) << "Computing " << uniqueWeights.size() << " CoRs over "
+                           << clusters.size() << " triangle clusters of " << numMerged
+                           << " merged triangles";
 
-        // Check that the first vertices of the subdivided mesh have not changed.
-        ON_ASSERT( const Math::Vector3& p = dataInOut.m_referenceMesh.m_vertices[i] );
-        CORE_ASSERT( subdividedMesh.m_vertices[i] == p, "Inconsistency in the meshes" );
+    // Third step : evaluate the integrals over the triangles sharing two handles with each
+    // vertex.
+    const Scalar sigmaSq = sigma * sigma;
+    Container::Vector3Array uniqueCoR( uniqueWeights.size(), Math::Vector3::Zero() );
+#pragma omp parallel
+    {
+        // Number of handles shared with the current vertex, for each cluster.
+        std::vector<uint> sharedCount( clusters.size(), 0 );
+        std::vector<uint> visited;
+        // Shared handles, as (index in the vertex weights, index in the cluster weights).
+        std::vector<std::pair<uint, uint>> shared;
+
+#pragma omp for schedule( dynamic, 16 )
+        for ( int u = 0; u < int( uniqueWeights.size() ); ++u )
+        {
+            const SparseWeights& Wi = *uniqueWeights[u];
+            visited.clear();
+            for ( const auto& w : Wi )
+            {
+                for ( uint c : handleClusters[w.first] )
+                {
+                    if ( sharedCount[c]++ == 0 )
+                    {
+                        visited.push_back( c );
+                    }
+                }
+            }
 
-        Math::Vector3 cor( 0, 0, 0 );
-        Scalar sumweight = 0;
-        const Eigen::SparseVector<Scalar> Wi = subdividedWeights.row( i );
+            Math::Vector3 cor( 0, 0, 0 );
+            Scalar sumweight = 0;
+            for ( uint c : visited )
+            {
+                if ( sharedCount[c] < 2 )
+                {
+                    continue;
+                }
+                const TriangleCluster& cluster = clusters[c];
+                const uint stride = cluster.m_handles.size();
+                shared.clear();
+                for ( uint i = 0, j = 0; i < Wi.size() && j < stride; )
+                {
+                    if ( Wi[i].first < cluster.m_handles[j] )
+                    {
+                        ++i;
+                    } else if ( cluster.m_handles[j] < Wi[i].first )
+                    {
+                        ++j;
+                    } else
+                    { shared.emplace_back( i++, j++ ); }
+                }
 
-        // Sum the cor and weights over all triangles of the subdivided mesh.
-        for ( uint t = 0; t < subdividedMesh.m_triangles.size(); ++t )
-        {
-            const Geometry::Triangle& tri = subdividedMesh.m_triangles[t];
-            std::array<Math::Vector3, 3> triVerts;
-            Geometry::getTriangleVertices( subdividedMesh, t, triVerts );
+                // Same sum as weightSimilarity(), over the pairs of shared handles.
+                for ( uint t = 0; t < cluster.m_areas.size(); ++t )
+                {
+                    const Scalar* W2 = &cluster.m_weights[t * stride];
+                    Scalar s = 0;
+                    for ( uint a = 0; a < shared.size(); ++a )
+                    {
+                        const Scalar W1j = Wi[shared[a].first].second;
+                        const Scalar W2j = W2[shared[a].second];
+                        for ( uint b = a + 1; b < shared.size(); ++b )
+                        {
+                            const Scalar W1k = Wi[shared[b].first].second;
+                            const Scalar W2k = W2[shared[b].second];
+                            const Scalar diff =
+                                std::exp( -Math::ipow<2>( ( W1j * W2k ) - ( W1k * W2j ) ) / sigmaSq );
+                            s += W1j * W1k * W2j * W2k * diff;
+                        }
+                    }
+                    // Each pair of handles appears twice in weightSimilarity().
+                    s *= 2;
+                    cor += s * cluster.m_centroids[t];
+                    sumweight += s * cluster.m_areas[t];
+                }
+            }
+            for ( uint c : visited )
+            {
+                sharedCount[c] = 0;
+            }
 
+            // Avoid division by 0
+            if ( sumweight > 0 )
+            {
+                uniqueCoR[u] = ( 1.f / sumweight ) * cor;
+            }
+        }
+    }
 
-            const Scalar area = Geometry::getTriangleArea( subdividedMesh, t );
-            const Eigen::SparseVector<Scalar> triWeight =
-                ( 1 / 3.f ) * ( subdividedWeights.row( tri[0] ) + subdividedWeights.row( tri[1] ) +
-                                subdividedWeights.row( tri[2] ) );
-            const Math::Vector3 centroid = ( triVerts[0] + triVerts[1] + triVerts[2] ) / 3.f;
+    dataInOut.m_CoR.resize( nVerts );
+    for ( uint i = 0; i < nVerts; ++i )
+    {
+        dataInOut.m_CoR[i] = uniqueCoR[vertexUnique[i]];
+    }
+}
 
-            const Scalar s = weightSimilarity( Wi, triWeight, sigma );
+namespace {
+// 64 bits FNV-1a hash, stable across runs and platforms.
+void hashBytes( uint64_t& hash, const void* data, size_t size ) {
+    const unsigned char* bytes = static_cast<const unsigned char*>( data );
+    for ( size_t i = 0; i < size; ++i )
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+}
 
-            cor += s * area * centroid;
-            sumweight += s * area;
+const char s_corMagic[4] = {'R', 'C', 'O', 'R'};
+} // namespace
+
+std::string getCoRCacheFile( const std::string& prefix, const RefData& data, Scalar sigma,
+                             Scalar weightEpsilon ) {
+    uint64_t hash = 14695981039346656037ull;
+    const auto& mesh = data.m_referenceMesh;
+    hashBytes( hash, mesh.m_vertices.data(), mesh.m_vertices.size() * sizeof( Math::Vector3 ) );
+    hashBytes( hash, mesh.m_triangles.data(),
+               mesh.m_triangles.size() * sizeof( Geometry::Triangle ) );
+    for ( int k = 0; k < data.m_weights.outerSize(); ++k )
+    {
+        for ( WeightMatrix::InnerIterator it( data.m_weights, k ); it; ++it )
+        {
+            const int64_t index[2] = {int64_t( it.row() ), int64_t( it.col() )};
+            const Scalar value = it.value();
+            hashBytes( hash, index, sizeof( index ) );
+            hashBytes( hash, &value, sizeof( value ) );
         }
+    }
+    hashBytes( hash, &sigma, sizeof( sigma ) );
+    hashBytes( hash, &weightEpsilon, sizeof( weightEpsilon ) );
 
-        // Avoid division by 0
-        if ( sumweight > 0 )
-        {
-            dataInOut.m_CoR.push_back( ( 1.f / sumweight ) * cor );
-        } else
-        { dataInOut.m_CoR.push_back( Math::Vector3::Zero() ); }
+    char name[17];
+    std::snprintf( name, sizeof( name ), "%016llx", static_cast<unsigned long long>( hash ) );
+    return prefix + "." + name + ".cor";
+}
 
-#if defined CORE_DEBUG
-        if ( i % 100 == 0 )
+bool saveCoR( const std::string& filename, const RefData& data ) {
+    // Write in a temporary file first, so that other instances never read a partial file.
+    const std::string tmpFile = filename + ".tmp";
+    {
+        std::ofstream output( tmpFile, std::ios::binary );
+        const uint32_t size = data.m_CoR.size();
+        const uint32_t scalarSize = sizeof( Scalar );
+        output.write( s_corMagic, sizeof( s_corMagic ) );
+        output.write( reinterpret_cast<const char*>( &scalarSize ), sizeof( scalarSize ) );
+        output.write( reinterpret_cast<const char*>( &size ), sizeof( size ) );
+        output.write( reinterpret_cast<const char*>( data.m_CoR.data() ),
+                      size * sizeof( Math::Vector3 ) );
+        if ( !output )
         {
-            LOG( Utils::logDEBUG ) << "CoR:" << i << " / " << nVerts;
+            LOG( Utils::logWARNING ) << "Cannot write centers of rotation " << tmpFile;
+            return false;
         }
-#endif // CORE_DEBUG
     }
+    std::remove( filename.c_str() );
+    if ( std::rename( tmpFile.c_str(), filename.c_str() ) != 0 )
+    {
+        LOG( Utils::logWARNING ) << "Cannot write centers of rotation " << filename;
+        std::remove( tmpFile.c_str() );
+        return false;
+    }
+    return true;
+}
+
+bool loadCoR( const std::string& filename, RefData& dataInOut ) {
+    std::ifstream input( filename, std::ios::binary );
+    char magic[4];
+    uint32_t scalarSize = 0;
+    uint32_t size = 0;
+    if ( !input.read( magic, sizeof( magic ) ) ||
+         !input.read( reinterpret_cast<char*>( &scalarSize ), sizeof( scalarSize ) ) ||
+         !input.read( reinterpret_cast<char*>( &size ), sizeof( size ) ) ||
+         !std::equal( magic, magic + 4, s_corMagic ) || scalarSize != sizeof( Scalar ) ||
+         size != dataInOut.m_referenceMesh.m_vertices.size() )
+    {
+        return false;
+    }
+    Container::Vector3Array CoR( size );
+    if ( !input.read( reinterpret_cast<char*>( CoR.data() ), size * sizeof( Math::Vector3 ) ) )
+    {
+        return false;
+    }
+    dataInOut.m_CoR = std::move( CoR );
+    return true;
 }
 
 void corSkinning( const Container::Vector3Array& input, const Pose& pose,
@@ -4,14 +4,10 @@
 #include <Core/RaCore.hpp>
 
 #include <array>
+#include <string>
 
-#include <Core/Container/IndexMap.hpp>
 #include <Core/Utils/Log.hpp>
-#include <Core/Geometry/DCEL/Dcel.hpp>
-#include <Core/Geometry/DCEL/FullEdge.hpp>
-#include <Core/Geometry/DCEL/Operations/EdgeSplit.hpp>
 #include <Core/Geometry/MeshUtils.hpp>
-#include <Core/Geometry/Convert.hpp>
 
 #include <Core/Animation/HandleWeight.hpp>
 #include <Core/Animation/Pose.hpp>
@@ -28,13 +24,34 @@ namespace Animation {
 // ACM ToG, 2016.
 
 /// Computes the similarity between two weights vector.
-Scalar weightSimilarity( const Eigen::SparseVector<Scalar>& v1w,
-                         const Eigen::SparseVector<Scalar>& v2w, Scalar sigma = 0.1f );
+Scalar RA_CORE_API weightSimilarity( const Eigen::SparseVector<Scalar>& v1w,
+                                     const Eigen::SparseVector<Scalar>& v2w, Scalar sigma = 0.1f );
 
 /// Compute the optimal center of rotations (1 per vertex) based on weight similarity.
+/// The reference mesh is first subdivided until the weights of the ends of each edge are
+/// closer than weightEpsilon. The center of rotation of a vertex is then the average of
+/// the centroids of the subdivided triangles, weighted by their area and by the similarity of
+/// their weights with the vertex ones.
+/// Only the triangles influenced by two handles influencing the vertex have a non zero
+/// similarity : the triangles are clustered by the handles influencing them, and each vertex
+/// only visits the clusters sharing two of its handles. The vertices with the same weights
+/// share their center of rotation, and the others are processed in parallel.
 void RA_CORE_API computeCoR( RefData& dataInOut, Scalar sigma = 0.1f,
                              Scalar weightEpsilon = 0.1f );
 
+/// Returns the name of a file in which the centers of rotation computed with the given
+/// parameters can be cached, made of prefix (e.g. the name of the asset file) and of a hash of
+/// the reference mesh, the weights and the parameters.
+std::string RA_CORE_API getCoRCacheFile( const std::string& prefix, const RefData& data,
+                                         Scalar sigma = 0.1f, Scalar weightEpsilon = 0.1f );
+
+/// Write the centers of rotation of data to the given file. Returns false on failure.
+bool RA_CORE_API saveCoR( const std::string& filename, const RefData& data );
+
+/// Read centers of rotation written by saveCoR() in dataInOut. Returns false if the file
+/// cannot be read or does not match the reference mesh.
+bool RA_CORE_API loadCoR( const std::string& filename, RefData& dataInOut );
+
 /// Skin the vertices with the optimal centers of rotation.
 void RA_CORE_API corSkinning( const Container::Vector3Array& input, const Pose& pose,
                               const WeightMatrix& weight, const Container::Vector3Array& CoR,
@@ -25,6 +25,22 @@ GeometryData::GeometryData( const std::string& name, const GeometryType& type )
 /// DESTRUCTOR
 GeometryData::~GeometryData() {}
 
+/// LEVELS OF DETAIL
+void GeometryData::computeLods( Scalar ratio, uint minTriangles ) {
+    if ( hasLods() || !isTriMesh() )
+    {
+        return;
+    }
+    Geometry::TriangleMesh mesh;
+    mesh.m_vertices = m_vertex;
+    mesh.m_triangles.reserve( m_faces.size() );
+    for ( const auto& f : m_faces )
+    {
+        mesh.m_triangles.push_back( f.head<3>() );
+    }
+    Geometry::computeLods( mesh, m_lods, ratio, minTriangles );
+}
+
 } // namespace Asset
 } // namespace Core
 } // namespace Ra
@@ -11,6 +11,7 @@
 
 #include <Core/Asset/AssetData.hpp>
 #include <Core/Asset/MaterialData.hpp>
+#include <Core/Geometry/Decimation.hpp>
 
 namespace Ra {
 namespace Core {
@@ -140,6 +141,14 @@ class RA_CORE_API GeometryData : public AssetData {
     inline void setDuplicateTable( const DuplicateTable& table );
     inline void setLoadDuplicates( const bool status );
 
+    /// LEVELS OF DETAIL
+    /// Compute the levels of detail of a triangle mesh (see Core::Geometry::computeLods()).
+    /// They are kept with the asset, hence only computed by the first call.
+    /// Several geometries can be processed in parallel.
+    void computeLods( Scalar ratio = 0.5, uint minTriangles = 512 );
+    inline const std::vector<Geometry::MeshLod>& getLods() const;
+    inline bool hasLods() const;
+
     /// QUERY
     inline bool isPointCloud() const;
     inline bool isLineMesh() const;
@@ -189,6 +198,9 @@ class RA_CORE_API GeometryData : public AssetData {
     // .
     DuplicateTable m_duplicateTable;
     bool m_loadDuplicates;
+
+    // the levels of detail of the faces, indexing m_vertex.
+    std::vector<Geometry::MeshLod> m_lods;
 };
 
 } // namespace Asset
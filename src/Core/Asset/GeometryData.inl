@@ -258,6 +258,15 @@ inline void GeometryData::setLoadDuplicates( const bool status ) {
     m_loadDuplicates = status;
 }
 
+/// LEVELS OF DETAIL
+inline const std::vector<Geometry::MeshLod>& GeometryData::getLods() const {
+    return m_lods;
+}
+
+inline bool GeometryData::hasLods() const {
+    return !m_lods.empty();
+}
+
 /// QUERY
 inline bool GeometryData::isPointCloud() const {
     return ( m_type == POINT_CLOUD );
@@ -2,6 +2,7 @@
 
 #include <Core/Container/CircularIndex.hpp>
 
+#include <Core/Geometry/OperatorAssembly.hpp>
 #include <Core/Geometry/TriangleOperation.hpp>
 
 namespace Ra {
@@ -13,39 +14,13 @@ namespace Geometry {
 /////////////////////
 
 AreaMatrix oneRingArea( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T ) {
-    AreaMatrix A( p.size(), p.size() );
-    A.reserve( p.size() );
-    for ( const auto& t : T )
-    {
-        uint i = t( 0 );
-        uint j = t( 1 );
-        uint k = t( 2 );
-        Scalar area = triangleArea( p[i], p[j], p[k] );
-        A.coeffRef( i, i ) += area;
-        A.coeffRef( j, j ) += area;
-        A.coeffRef( k, k ) += area;
-    }
+    AreaMatrix A;
+    oneRingArea( p, T, A );
     return A;
 }
 
 void oneRingArea( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T, AreaMatrix& A ) {
-    A.resize( p.size(), p.size() );
-    A.reserve( p.size() );
-#pragma omp parallel for
-    for ( int n = 0; n < int( T.size() ); ++n )
-    {
-        const Triangle& t = T[n];
-        const uint i = t( 0 );
-        const uint j = t( 1 );
-        const uint k = t( 2 );
-        const Scalar area = triangleArea( p[i], p[j], p[k] );
-#pragma omp critical
-        {
-            A.coeffRef( i, i ) += area;
-            A.coeffRef( j, j ) += area;
-            A.coeffRef( k, k ) += area;
-        }
-    }
+    MeshOperatorAssembler( p.size(), T ).oneRingArea( p, A );
 }
 
 AreaMatrix barycentricArea( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T ) {
@@ -55,83 +30,18 @@ AreaMatrix barycentricArea( const Container::VectorArray<Math::Vector3>& p, cons
 void barycentricArea( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T,
                       AreaMatrix& A ) {
     oneRingArea( p, T, A );
-    const uint size = p.size();
-#pragma omp parallel for
-    for ( int i = 0; i < int( size ); ++i )
-    {
-        A.coeffRef( i, i ) /= 3.0;
-    }
+    A *= Scalar( 1 ) / 3;
 }
 
 AreaMatrix voronoiArea( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T ) {
-    AreaMatrix A( p.size(), p.size() );
-    A.reserve( p.size() );
-    for ( const auto& t : T )
-    {
-        uint i = t( 0 );
-        uint j = t( 1 );
-        uint k = t( 2 );
-        A.coeffRef( i, i ) +=
-            Math::Vector::cotan( ( p[i] - p[k] ), ( p[j] - p[k] ) ) * ( p[i] - p[j] ).squaredNorm();
-        A.coeffRef( j, j ) +=
-            Math::Vector::cotan( ( p[j] - p[i] ), ( p[k] - p[i] ) ) * ( p[j] - p[k] ).squaredNorm();
-        A.coeffRef( k, k ) +=
-           Math:: Vector::cotan( ( p[k] - p[j] ), ( p[i] - p[j] ) ) * ( p[k] - p[i] ).squaredNorm();
-    }
-    return ( ( 1.0 / 8.0 ) * A );
+    AreaMatrix A;
+    MeshOperatorAssembler( p.size(), T ).voronoiArea( p, A );
+    return A;
 }
 
 AreaMatrix mixedArea( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T ) {
-    AreaMatrix A( p.size(), p.size() );
-    A.reserve( p.size() );
-    for ( const auto& t : T )
-    {
-        uint i = t( 0 );
-        uint j = t( 1 );
-        uint k = t( 2 );
-        if ( !isTriangleObtuse( p[i], p[j], p[k] ) )
-        {
-            Math::Vector3 ij = p[j] - p[i];
-            Math::Vector3 jk = p[k] - p[j];
-            Math::Vector3 ki = p[i] - p[k];
-            Scalar IJ = ( ij ).squaredNorm();
-            Scalar JK = ( jk ).squaredNorm();
-            Scalar KI = ( ki ).squaredNorm();
-            Scalar cotI = Math::Vector::cotan( ij, ( -ki ).eval() );
-            Scalar cotJ = Math::Vector::cotan( jk, ( -ij ).eval() );
-            Scalar cotK = Math::Vector::cotan( ki, ( -jk ).eval() );
-            A.coeffRef( i, i ) += ( 1.0 / 8.0 ) * ( ( KI * cotJ ) + ( IJ * cotK ) );
-            A.coeffRef( j, j ) += ( 1.0 / 8.0 ) * ( ( IJ * cotK ) + ( JK * cotI ) );
-            A.coeffRef( k, k ) += ( 1.0 / 8.0 ) * ( ( JK * cotI ) + ( KI * cotJ ) );
-
-        } else
-        {
-            Scalar area = triangleArea( p[i], p[j], p[k] );
-            if ( ( ( ( p[j] - p[i] ).normalized() ).dot( ( p[k] - p[i] ).normalized() ) ) < 0.0 )
-            {
-                /* obtuse at i */
-                A.coeffRef( i, i ) += area / 2.0;
-                A.coeffRef( j, j ) += area / 4.0;
-                A.coeffRef( k, k ) += area / 4.0;
-            } else
-            {
-                if ( ( ( ( p[k] - p[j] ).normalized() ).dot( ( p[i] - p[j] ).normalized() ) ) <
-                     0.0 )
-                {
-                    /* obtuse at j */
-                    A.coeffRef( i, i ) += area / 4.0;
-                    A.coeffRef( j, j ) += area / 2.0;
-                    A.coeffRef( k, k ) += area / 4.0;
-                } else
-                {
-                    /* obtuse at k */
-                    A.coeffRef( i, i ) += area / 4.0;
-                    A.coeffRef( j, j ) += area / 4.0;
-                    A.coeffRef( k, k ) += area / 2.0;
-                }
-            }
-        }
-    }
+    AreaMatrix A;
+    MeshOperatorAssembler( p.size(), T ).mixedArea( p, A );
     return A;
 }
 
@@ -1,9 +0,0 @@
-#include <Core/Geometry/DCEL/Dcel.hpp>
-#include <Core/RaCore.hpp>
-namespace Ra {
-namespace Core {
-namespace DcelOperations {
-RA_CORE_API[[deprecated]] void splitEdge( Dcel& dcel, Container::Index edgeIndex, Scalar fraction );
-}
-} // namespace Core
-} // namespace Ra
@@ -0,0 +1,586 @@
+#include <Core/Geometry/Decimation.hpp>
+
+#include <Core/Container/AlignedStdVector.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Core/Math/Quadric.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <queue>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+namespace {
+
+using Quadric3 = Math::Quadric<3>;
+
+/// Minimal cosine between the normals of a triangle before and after a collapse.
+/// Rejects the collapses flipping or folding the triangles.
+constexpr Scalar MinNormalCos = Scalar( 0.25 );
+
+/// Returns q expressed relatively to the point t : q'( x ) = q( x + t ).
+/// The quadrics are expressed relatively to the position of their vertex, which keeps their
+/// constant term and the errors small, hence accurate, on fine meshes.
+Quadric3 translate( const Quadric3& q, const Math::Vector3& t ) {
+    return Quadric3( q.getA(), q.getA() * t + q.getB(), q.evaluate( t ) );
+}
+
+/// Edge collapses in quadric error order, see decimate().
+/// The connectivity is the one of the positions : the vertices sharing a position (wedges)
+/// are the same topological vertex, e.g. the vertices of both sides of a texture seam.
+/// The collapse of the edge (u,v) onto v removes u, the triangles of the edge, and
+/// connects the other triangles of u to v : each wedge of u is replaced by the wedge of v
+/// sharing an edge triangle with it, so that the seams are simplified on both sides.
+class QuadricDecimation {
+  public:
+    explicit QuadricDecimation( const TriangleMesh& mesh );
+
+    /// Collapse edges until at most targetTriangles triangles remain, or no edge can be
+    /// collapsed.
+    void decimate( uint targetTriangles );
+
+    void getLod( MeshLod& lod ) const;
+
+    uint getNumTriangles() const { return m_numTriangles; }
+
+  private:
+    struct Collapse {
+        Scalar m_cost;
+        uint m_from;
+        uint m_to;
+        uint m_stamp; ///< Stamp of m_from when the collapse was computed.
+
+        // Lowest cost on top of the queue.
+        bool operator<( const Collapse& other ) const { return m_cost > other.m_cost; }
+    };
+
+    /// Returns the corner of triangle t at the position u, or 3.
+    uint getCorner( uint t, uint u ) const;
+
+    bool contains( uint t, uint u ) const { return getCorner( t, u ) < 3; }
+
+    /// Number of triangles of the edge (u,v).
+    uint countEdgeTriangles( uint u, uint v ) const;
+
+    /// Fill neighbors with the positions connected to u.
+    void getNeighbors( uint u, std::vector<uint>& neighbors ) const;
+
+    /// Number of positions connected to both u and v.
+    uint countCommonNeighbors( uint u, uint v ) const;
+
+    bool isBoundary( uint u ) const;
+
+    /// Fill m_wedgeTargets with the wedge of v replacing each wedge of u when collapsing u
+    /// onto v. Returns false if a wedge of u has no or several possible targets.
+    bool computeWedgeTargets( uint u, uint v ) const;
+
+    /// Check that collapsing u onto v keeps the mesh manifold, keeps the copies of a seam
+    /// vertex collapsing together, and does not flip triangles.
+    bool isValid( uint u, uint v ) const;
+
+    /// Quadric error of the collapse of u onto v.
+    Scalar getCost( uint u, uint v ) const {
+        return Scalar( m_quadrics[v].getC() ) +
+               m_quadrics[u].evaluate( m_mesh.m_vertices[v] - m_mesh.m_vertices[u] );
+    }
+
+    /// Push the cheapest valid collapse of u in the queue, invalidating the previous one.
+    void updateCollapse( uint u );
+
+    void collapse( uint u, uint v );
+
+  private:
+    const TriangleMesh& m_mesh;
+
+    /// Triangles of wedges.
+    Container::VectorArray<Triangle> m_triangles;
+    std::vector<bool> m_removedTriangle;
+    uint m_numTriangles;
+
+    /// Position of each wedge, i.e. the index of the first vertex sharing its position.
+    /// The data of the positions below are stored at this index.
+    std::vector<uint> m_positions;
+    std::vector<std::vector<uint>> m_wedges;
+    std::vector<std::vector<uint>> m_positionTriangles;
+    /// Quadric of each position, relatively to the position (see translate()).
+    Container::AlignedStdVector<Quadric3> m_quadrics;
+    std::vector<bool> m_removed;
+    std::vector<bool> m_locked;
+    std::vector<bool> m_boundary;
+    std::vector<uint> m_stamps;
+
+    std::priority_queue<Collapse> m_queue;
+    Scalar m_maxCost;
+
+    // Buffers of collapse(), updateCollapse() and isValid().
+    std::vector<uint> m_neighbors;
+    std::vector<uint> m_ring;
+    std::vector<std::pair<Scalar, uint>> m_candidates;
+    mutable std::vector<std::pair<uint, uint>> m_wedgeTargets;
+    mutable std::vector<uint> m_marks;
+    mutable uint m_mark;
+};
+
+QuadricDecimation::QuadricDecimation( const TriangleMesh& mesh ) :
+    m_mesh( mesh ),
+    m_triangles( mesh.m_triangles ),
+    m_removedTriangle( mesh.m_triangles.size(), false ),
+    m_numTriangles( mesh.m_triangles.size() ),
+    m_positions( mesh.m_vertices.size() ),
+    m_wedges( mesh.m_vertices.size() ),
+    m_positionTriangles( mesh.m_vertices.size() ),
+    m_quadrics( mesh.m_vertices.size() ),
+    m_removed( mesh.m_vertices.size(), false ),
+    m_locked( mesh.m_vertices.size(), false ),
+    m_boundary( mesh.m_vertices.size(), false ),
+    m_stamps( mesh.m_vertices.size(), 0 ),
+    m_maxCost( 0 ),
+    m_marks( mesh.m_vertices.size(), 0 ),
+    m_mark( 0 ) {
+    const uint numVertices = mesh.m_vertices.size();
+
+    std::vector<VertexIdx> duplicates;
+    findDuplicates( mesh, duplicates );
+    for ( uint v = 0; v < numVertices; ++v )
+    {
+        m_positions[v] = duplicates[v];
+    }
+
+    // Quadrics of the planes of the triangles.
+    for ( uint t = 0; t < m_triangles.size(); ++t )
+    {
+        const Triangle& tri = m_triangles[t];
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const uint u = m_positions[tri[i]];
+            m_positionTriangles[u].push_back( t );
+            if ( std::find( m_wedges[u].begin(), m_wedges[u].end(), tri[i] ) ==
+                 m_wedges[u].end() )
+            {
+                m_wedges[u].push_back( tri[i] );
+            }
+        }
+        const Math::Vector3& p0 = mesh.m_vertices[tri[0]];
+        Math::Vector3 n =
+            ( mesh.m_vertices[tri[1]] - p0 ).cross( mesh.m_vertices[tri[2]] - p0 );
+        const Scalar norm = n.norm();
+        if ( norm > 0 )
+        {
+            n /= norm;
+            for ( uint i = 0; i < 3; ++i )
+            {
+                const uint u = m_positions[tri[i]];
+                m_quadrics[u] += Quadric3( n, n.dot( mesh.m_vertices[u] - p0 ) );
+            }
+        }
+    }
+
+    // Boundaries : quadrics of the planes orthogonal to the triangles along the boundary
+    // edges, so that the collapses along a boundary keep its shape.
+    // The vertices of non manifold edges are locked.
+    for ( uint u = 0; u < numVertices; ++u )
+    {
+        for ( auto t : m_positionTriangles[u] )
+        {
+            const Triangle& tri = m_triangles[t];
+            for ( uint i = 0; i < 3; ++i )
+            {
+                const uint v = m_positions[tri[i]];
+                if ( v <= u )
+                {
+                    continue;
+                }
+                const uint numEdgeTriangles = countEdgeTriangles( u, v );
+                if ( numEdgeTriangles > 2 )
+                {
+                    m_locked[u] = true;
+                    m_locked[v] = true;
+                } else if ( numEdgeTriangles == 1 )
+                {
+                    m_boundary[u] = true;
+                    m_boundary[v] = true;
+
+                    const Math::Vector3& pu = mesh.m_vertices[u];
+                    const Math::Vector3 e = mesh.m_vertices[v] - pu;
+                    const Math::Vector3& p0 = mesh.m_vertices[tri[0]];
+                    const Math::Vector3 n = ( mesh.m_vertices[tri[1]] - p0 )
+                                                .cross( mesh.m_vertices[tri[2]] - p0 );
+                    Math::Vector3 m = e.cross( n );
+                    const Scalar norm = m.norm();
+                    if ( norm > 0 )
+                    {
+                        m /= norm;
+                        m_quadrics[u] += Quadric3( m, 0 );
+                        m_quadrics[v] += Quadric3( m, m.dot( e ) );
+                    }
+                }
+            }
+        }
+    }
+
+    for ( uint u = 0; u < numVertices; ++u )
+    {
+        updateCollapse( u );
+    }
+}
+
+uint QuadricDecimation::getCorner( uint t, uint u ) const {
+    const Triangle& tri = m_triangles[t];
+    uint i = 0;
+    while ( i < 3 && m_positions[tri[i]] != u )
+    {
+        ++i;
+    }
+    return i;
+}
+
+uint QuadricDecimation::countEdgeTriangles( uint u, uint v ) const {
+    uint count = 0;
+    for ( auto t : m_positionTriangles[u] )
+    {
+        if ( contains( t, v ) )
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void QuadricDecimation::getNeighbors( uint u, std::vector<uint>& neighbors ) const {
+    neighbors.clear();
+    for ( auto t : m_positionTriangles[u] )
+    {
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const uint w = m_positions[m_triangles[t][i]];
+            if ( w != u && std::find( neighbors.begin(), neighbors.end(), w ) == neighbors.end() )
+            {
+                neighbors.push_back( w );
+            }
+        }
+    }
+}
+
+uint QuadricDecimation::countCommonNeighbors( uint u, uint v ) const {
+    if ( m_mark >= uint( -3 ) )
+    {
+        std::fill( m_marks.begin(), m_marks.end(), 0 );
+        m_mark = 0;
+    }
+    // Neighbors of v are marked with m_mark + 1, the common ones with m_mark + 2.
+    m_mark += 2;
+    for ( auto t : m_positionTriangles[v] )
+    {
+        for ( uint i = 0; i < 3; ++i )
+        {
+            m_marks[m_positions[m_triangles[t][i]]] = m_mark - 1;
+        }
+    }
+    uint count = 0;
+    for ( auto t : m_positionTriangles[u] )
+    {
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const uint w = m_positions[m_triangles[t][i]];
+            if ( w != u && w != v && m_marks[w] == m_mark - 1 )
+            {
+                m_marks[w] = m_mark;
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+bool QuadricDecimation::isBoundary( uint u ) const {
+    for ( auto t : m_positionTriangles[u] )
+    {
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const uint w = m_positions[m_triangles[t][i]];
+            if ( w != u && countEdgeTriangles( u, w ) == 1 )
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool QuadricDecimation::computeWedgeTargets( uint u, uint v ) const {
+    m_wedgeTargets.clear();
+    for ( auto wedge : m_wedges[u] )
+    {
+        uint target = uint( -1 );
+        for ( auto t : m_positionTriangles[u] )
+        {
+            const uint cv = getCorner( t, v );
+            if ( cv == 3 || m_triangles[t][getCorner( t, u )] != wedge )
+            {
+                continue;
+            }
+            if ( target != uint( -1 ) && target != m_triangles[t][cv] )
+            {
+                return false;
+            }
+            target = m_triangles[t][cv];
+        }
+        if ( target == uint( -1 ) )
+        {
+            return false;
+        }
+        m_wedgeTargets.emplace_back( wedge, target );
+    }
+    return true;
+}
+
+bool QuadricDecimation::isValid( uint u, uint v ) const {
+    if ( m_removed[u] || m_removed[v] || m_locked[u] )
+    {
+        return false;
+    }
+    const uint numEdgeTriangles = countEdgeTriangles( u, v );
+    if ( numEdgeTriangles == 0 || numEdgeTriangles > 2 )
+    {
+        return false;
+    }
+    // A boundary vertex only moves along its boundary.
+    if ( m_boundary[u] && numEdgeTriangles != 1 )
+    {
+        return false;
+    }
+    // Likewise, a seam vertex only moves along its seam.
+    if ( !computeWedgeTargets( u, v ) )
+    {
+        return false;
+    }
+
+    // Link condition : the only common neighbors of u and v are the opposite vertices of the
+    // triangles of the edge.
+    if ( countCommonNeighbors( u, v ) != numEdgeTriangles )
+    {
+        return false;
+    }
+
+    // The remaining triangles of u must not flip nor degenerate.
+    const Math::Vector3& pv = m_mesh.m_vertices[v];
+    for ( auto t : m_positionTriangles[u] )
+    {
+        if ( contains( t, v ) )
+        {
+            continue;
+        }
+        const Triangle& tri = m_triangles[t];
+        std::array<Math::Vector3, 3> p;
+        for ( uint i = 0; i < 3; ++i )
+        {
+            p[i] = m_mesh.m_vertices[tri[i]];
+        }
+        const Math::Vector3 before = ( p[1] - p[0] ).cross( p[2] - p[0] );
+        p[getCorner( t, u )] = pv;
+        const Math::Vector3 after = ( p[1] - p[0] ).cross( p[2] - p[0] );
+        const Scalar norms = before.norm() * after.norm();
+        if ( norms <= 0 || before.dot( after ) < MinNormalCos * norms )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void QuadricDecimation::updateCollapse( uint u ) {
+    ++m_stamps[u];
+    if ( m_removed[u] || m_locked[u] || m_wedges[u].empty() )
+    {
+        return;
+    }
+    // Check the validity of the collapses in cost order, as it is more expensive.
+    getNeighbors( u, m_neighbors );
+    m_candidates.clear();
+    for ( auto v : m_neighbors )
+    {
+        m_candidates.emplace_back( getCost( u, v ), v );
+    }
+    std::sort( m_candidates.begin(), m_candidates.end() );
+    for ( const auto& candidate : m_candidates )
+    {
+        if ( isValid( u, candidate.second ) )
+        {
+            m_queue.push( {candidate.first, u, candidate.second, m_stamps[u]} );
+            return;
+        }
+    }
+}
+
+void QuadricDecimation::collapse( uint u, uint v ) {
+    // Set by the last call to isValid( u, v ).
+    const auto& targets = m_wedgeTargets;
+    m_ring.clear();
+
+    m_quadrics[v] += translate( m_quadrics[u], m_mesh.m_vertices[v] - m_mesh.m_vertices[u] );
+
+    for ( auto t : m_positionTriangles[u] )
+    {
+        Triangle& tri = m_triangles[t];
+        if ( contains( t, v ) )
+        {
+            m_removedTriangle[t] = true;
+            --m_numTriangles;
+            for ( uint i = 0; i < 3; ++i )
+            {
+                const uint w = m_positions[tri[i]];
+                if ( w != u )
+                {
+                    auto& triangles = m_positionTriangles[w];
+                    triangles.erase( std::find( triangles.begin(), triangles.end(), t ) );
+                }
+                if ( w != u && w != v )
+                {
+                    // Its edges with u and v are merged.
+                    m_ring.push_back( w );
+                }
+            }
+        } else
+        {
+            uint& wedge = tri[getCorner( t, u )];
+            wedge = std::find_if( targets.begin(), targets.end(),
+                                  [wedge]( const std::pair<uint, uint>& target ) {
+                                      return target.first == wedge;
+                                  } )
+                        ->second;
+            m_positionTriangles[v].push_back( t );
+        }
+    }
+    m_positionTriangles[u].clear();
+    m_wedges[u].clear();
+    m_removed[u] = true;
+
+    m_boundary[v] = isBoundary( v );
+    for ( auto w : m_ring )
+    {
+        m_boundary[w] = isBoundary( w );
+    }
+
+    // The costs and the validity of the collapses around v changed.
+    getNeighbors( v, m_ring );
+    updateCollapse( v );
+    for ( auto w : m_ring )
+    {
+        updateCollapse( w );
+    }
+}
+
+void QuadricDecimation::decimate( uint targetTriangles ) {
+    while ( m_numTriangles > targetTriangles && !m_queue.empty() )
+    {
+        const Collapse c = m_queue.top();
+        m_queue.pop();
+        if ( m_removed[c.m_from] || c.m_stamp != m_stamps[c.m_from] )
+        {
+            continue;
+        }
+        if ( !isValid( c.m_from, c.m_to ) )
+        {
+            updateCollapse( c.m_from );
+            continue;
+        }
+        m_maxCost = std::max( m_maxCost, c.m_cost );
+        collapse( c.m_from, c.m_to );
+    }
+}
+
+void QuadricDecimation::getLod( MeshLod& lod ) const {
+    lod.m_triangles.clear();
+    lod.m_triangles.reserve( m_numTriangles );
+    for ( uint t = 0; t < m_triangles.size(); ++t )
+    {
+        if ( !m_removedTriangle[t] )
+        {
+            lod.m_triangles.push_back( m_triangles[t] );
+        }
+    }
+    lod.m_error = std::sqrt( m_maxCost );
+}
+
+} // namespace
+
+void decimate( const TriangleMesh& mesh, uint targetTriangles, MeshLod& lod ) {
+    QuadricDecimation decimation( mesh );
+    decimation.decimate( targetTriangles );
+    decimation.getLod( lod );
+}
+
+void computeLods( const TriangleMesh& mesh, std::vector<MeshLod>& lods, Scalar ratio,
+                  uint minTriangles, uint maxLevels ) {
+    CORE_ASSERT( ratio > 0 && ratio < 1, "Invalid decimation ratio" );
+    lods.clear();
+    uint numTriangles = mesh.m_triangles.size();
+    if ( uint( numTriangles * ratio ) < minTriangles )
+    {
+        return;
+    }
+
+    QuadricDecimation decimation( mesh );
+    while ( lods.size() < maxLevels )
+    {
+        const uint target = uint( numTriangles * ratio );
+        if ( target < minTriangles )
+        {
+            break;
+        }
+        decimation.decimate( target );
+        // Stop once the locked vertices prevent most of the collapses.
+        if ( decimation.getNumTriangles() > ( numTriangles + target ) / 2 )
+        {
+            break;
+        }
+        numTriangles = decimation.getNumTriangles();
+        lods.emplace_back();
+        decimation.getLod( lods.back() );
+    }
+}
+
+void getLodMesh( const TriangleMesh& mesh, const MeshLod& lod, TriangleMesh& lodMesh,
+                 std::vector<uint>& vertexMap ) {
+    const uint numVertices = mesh.m_vertices.size();
+    std::vector<uint> newIndex( numVertices, uint( -1 ) );
+    vertexMap.clear();
+    lodMesh.clear();
+    lodMesh.m_triangles.reserve( lod.m_triangles.size() );
+    for ( const auto& t : lod.m_triangles )
+    {
+        Triangle tri;
+        for ( uint i = 0; i < 3; ++i )
+        {
+            if ( newIndex[t[i]] == uint( -1 ) )
+            {
+                newIndex[t[i]] = vertexMap.size();
+                vertexMap.push_back( t[i] );
+            }
+            tri[i] = newIndex[t[i]];
+        }
+        lodMesh.m_triangles.push_back( tri );
+    }
+
+    const bool hasNormals = mesh.m_normals.size() == numVertices;
+    lodMesh.m_vertices.reserve( vertexMap.size() );
+    if ( hasNormals )
+    {
+        lodMesh.m_normals.reserve( vertexMap.size() );
+    }
+    for ( auto v : vertexMap )
+    {
+        lodMesh.m_vertices.push_back( mesh.m_vertices[v] );
+        if ( hasNormals )
+        {
+            lodMesh.m_normals.push_back( mesh.m_normals[v] );
+        }
+    }
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
@@ -0,0 +1,53 @@
+#ifndef RADIUMENGINE_DECIMATION_HPP
+#define RADIUMENGINE_DECIMATION_HPP
+
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Geometry/MeshTypes.hpp>
+#include <Core/Geometry/TriangleMesh.hpp>
+#include <Core/RaCore.hpp>
+
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// A simplified version of a triangle mesh, connecting a subset of its vertices.
+/// As the vertices of the full resolution mesh are kept as they are, a level of detail
+/// shares their attributes (normals, texture coordinates, colors...) and can be drawn from
+/// the same vertex buffers with another index buffer.
+struct RA_CORE_API MeshLod {
+    /// Triangles of the level, indexing the vertices of the full resolution mesh.
+    Container::VectorArray<Triangle> m_triangles;
+
+    /// Estimate of the distance between the level and the full resolution surface :
+    /// the square root of the largest quadric error of the collapses.
+    Scalar m_error{0};
+};
+
+/// Simplify \p mesh down to \p targetTriangles triangles by quadric error edge collapses
+/// [Garland and Heckbert 1997]. Edges are collapsed onto one of their vertices, which keeps
+/// the vertex attributes without interpolation. The boundaries are only simplified along
+/// themselves. The copies of a vertex along a seam (vertices sharing their position, e.g. on
+/// texture or normal discontinuities) are collapsed together, so that both sides of the seam
+/// are simplified the same way and no crack opens. Collapses that would flip a triangle are
+/// rejected, hence the result may have more triangles than requested.
+RA_CORE_API void decimate( const TriangleMesh& mesh, uint targetTriangles, MeshLod& lod );
+
+/// Compute a chain of levels of detail of \p mesh, from the finest to the coarsest.
+/// Each level has about \p ratio times the triangles of the previous one, down to
+/// \p minTriangles triangles and at most \p maxLevels levels. The collapses of a level
+/// continue the ones of the previous level (see decimate()).
+RA_CORE_API void computeLods( const TriangleMesh& mesh, std::vector<MeshLod>& lods,
+                              Scalar ratio = 0.5, uint minTriangles = 512, uint maxLevels = 6 );
+
+/// Build the standalone mesh of \p lod, keeping only the vertices of \p mesh it uses.
+/// vertexMap[i] is the index in \p mesh of the vertex i of \p lodMesh.
+RA_CORE_API void getLodMesh( const TriangleMesh& mesh, const MeshLod& lod, TriangleMesh& lodMesh,
+                             std::vector<uint>& vertexMap );
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_DECIMATION_HPP
@@ -0,0 +1,109 @@
+#include <Core/Geometry/FactorizationCache.hpp>
+
+#include <Core/Utils/Log.hpp>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+namespace {
+
+/// Factorize M, running the symbolic analysis first if needed.
+template <typename Solver>
+bool factorizeWith( std::unique_ptr<Solver>& solver, const Math::Sparse& M, bool analyze ) {
+    if ( !solver )
+    {
+        solver.reset( new Solver );
+        analyze = true;
+    }
+    if ( analyze )
+    {
+        solver->analyzePattern( M );
+    }
+    solver->factorize( M );
+    return solver->info() == Eigen::Success;
+}
+
+} // namespace
+
+void FactorizationCache::setTopologyVersion( uint version ) {
+    if ( version != m_topologyVersion )
+    {
+        m_topologyVersion = version;
+        clear();
+    }
+}
+
+bool FactorizationCache::factorize( const std::string& name, Scalar parameter,
+                                    const SystemBuilder& build, SolverType type ) {
+    System& system = m_systems[SystemKey( name, parameter )];
+    const bool hasSolver = ( type == SOLVER_LLT ? bool( system.m_llt ) : bool( system.m_ldlt ) );
+    if ( system.m_isValid && system.m_type == type &&
+         system.m_geometryVersion == m_geometryVersion )
+    {
+        return true;
+    }
+
+    const Math::Sparse M = build();
+    CORE_ASSERT( M.rows() == M.cols(), "System matrix is not square" );
+
+    // Same topology, hence same pattern : only the numeric factorization is redone.
+    const bool analyze =
+        !hasSolver || M.rows() != system.m_size || M.nonZeros() != system.m_nonZeros;
+    if ( type == SOLVER_LLT )
+    {
+        system.m_ldlt.reset();
+        system.m_isValid = factorizeWith( system.m_llt, M, analyze );
+    } else
+    {
+        system.m_llt.reset();
+        system.m_isValid = factorizeWith( system.m_ldlt, M, analyze );
+    }
+    system.m_type = type;
+    system.m_geometryVersion = m_geometryVersion;
+    system.m_size = M.rows();
+    system.m_nonZeros = M.nonZeros();
+    m_numAnalyses += analyze ? 1 : 0;
+    ++m_numFactorizations;
+
+    if ( !system.m_isValid )
+    {
+        LOG( Utils::logWARNING ) << "Factorization of the system " << name << " ( " << parameter
+                                 << " ) failed.";
+    }
+    return system.m_isValid;
+}
+
+bool FactorizationCache::isFactorized( const std::string& name, Scalar parameter ) const {
+    auto it = m_systems.find( SystemKey( name, parameter ) );
+    return it != m_systems.end() && it->second.m_isValid &&
+           it->second.m_geometryVersion == m_geometryVersion;
+}
+
+bool FactorizationCache::solve( const std::string& name, Scalar parameter,
+                                const Math::MatrixN& B, Math::MatrixN& X ) const {
+    auto it = m_systems.find( SystemKey( name, parameter ) );
+    if ( it == m_systems.end() || !it->second.m_isValid )
+    {
+        LOG( Utils::logERROR ) << "System " << name << " ( " << parameter
+                               << " ) is not factorized.";
+        return false;
+    }
+    const System& system = it->second;
+    CORE_ASSERT( B.rows() == system.m_size, "Wrong right hand side size" );
+    if ( system.m_type == SOLVER_LLT )
+    {
+        X = system.m_llt->solve( B );
+        return system.m_llt->info() == Eigen::Success;
+    }
+    X = system.m_ldlt->solve( B );
+    return system.m_ldlt->info() == Eigen::Success;
+}
+
+void FactorizationCache::clear() {
+    m_systems.clear();
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
@@ -0,0 +1,99 @@
+#ifndef RADIUMENGINE_FACTORIZATIONCACHE_HPP
+#define RADIUMENGINE_FACTORIZATIONCACHE_HPP
+
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/RaCore.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// Factorizations of the sparse linear systems solved on a mesh ( e.g. heat diffusion or
+/// implicit smoothing ), kept along with the mesh so that repeated solves only cost the
+/// triangular substitutions.
+///
+/// A system is identified by a name ( the operator ) and a parameter ( e.g. the time step ).
+/// Its factorization is valid for the current topology and geometry versions of the cache,
+/// which the owner of the mesh increments when the connectivity or the vertex positions
+/// change :
+///   - when only the geometry changed, the matrix of the system is rebuilt and numerically
+///     refactorized, reusing the symbolic analysis ( ordering and elimination tree ) ;
+///   - when the topology changed, all the factorizations are dropped.
+///
+/// The cache is not thread safe.
+class RA_CORE_API FactorizationCache {
+  public:
+    /// Sparse Cholesky variants. LDL^T is more robust on semi-definite systems.
+    enum SolverType : uint { SOLVER_LLT = 0, SOLVER_LDLT };
+
+    /// Builds the matrix of a system, called only when its factorization must be updated.
+    using SystemBuilder = std::function<Math::Sparse()>;
+
+    FactorizationCache() = default;
+    FactorizationCache( const FactorizationCache& ) = delete;
+    FactorizationCache& operator=( const FactorizationCache& ) = delete;
+
+    /// Set the version of the connectivity of the mesh, dropping the factorizations if it
+    /// changed.
+    void setTopologyVersion( uint version );
+    uint getTopologyVersion() const { return m_topologyVersion; }
+
+    /// Set the version of the vertex positions of the mesh, the factorizations of an older
+    /// version being numerically updated when next requested.
+    void setGeometryVersion( uint version ) { m_geometryVersion = version; }
+    uint getGeometryVersion() const { return m_geometryVersion; }
+
+    /// Make sure the system ( name, parameter ) is factorized for the current versions,
+    /// calling \p build to get its matrix if not. Returns false if the factorization failed.
+    bool factorize( const std::string& name, Scalar parameter, const SystemBuilder& build,
+                    SolverType type = SOLVER_LLT );
+
+    /// Returns true if the system ( name, parameter ) has a factorization for the current
+    /// versions.
+    bool isFactorized( const std::string& name, Scalar parameter ) const;
+
+    /// Solve the system ( name, parameter ) for each column of \p B.
+    /// Returns false if the system is not factorized or if the solve failed.
+    bool solve( const std::string& name, Scalar parameter, const Math::MatrixN& B,
+                Math::MatrixN& X ) const;
+
+    /// Drop all the factorizations.
+    void clear();
+
+    /// Number of full ( symbolic and numeric ) and numeric only factorizations done since
+    /// the creation of the cache, for statistics.
+    uint getNumAnalyses() const { return m_numAnalyses; }
+    uint getNumFactorizations() const { return m_numFactorizations; }
+
+  private:
+    struct System {
+        SolverType m_type{SOLVER_LLT};
+        uint m_geometryVersion{0};
+        bool m_isValid{false};
+        /// Pattern the solver has been analyzed with.
+        Eigen::Index m_size{0};
+        Eigen::Index m_nonZeros{0};
+        std::unique_ptr<Eigen::SimplicialLLT<Math::Sparse>> m_llt;
+        std::unique_ptr<Eigen::SimplicialLDLT<Math::Sparse>> m_ldlt;
+    };
+
+    using SystemKey = std::pair<std::string, Scalar>;
+
+    std::map<SystemKey, System> m_systems;
+    uint m_topologyVersion{0};
+    uint m_geometryVersion{0};
+    uint m_numAnalyses{0};
+    uint m_numFactorizations{0};
+};
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_FACTORIZATIONCACHE_HPP
@@ -1,263 +1,585 @@
 #include <Core/Geometry/HalfEdge.hpp>
 
 #include <Core/Geometry/TriangleMesh.hpp>
-#include <map>
+#include <Core/Utils/Log.hpp>
+
+#include <algorithm>
 
 namespace Ra {
 namespace Core {
 namespace Geometry {
 namespace {
-// Allow to store the edges in a pair of half edges.
-struct EdgeKey {
-    VertexIdx vSmaller;
-    VertexIdx vLarger;
-
-    bool operator<( const EdgeKey& other ) const {
-        return vLarger != other.vLarger ? vLarger < other.vLarger : vSmaller < other.vSmaller;
+/// Appends the ordered neighbors of v.
+void getRing( const HalfEdgeData& heData, VertexIdx v, std::vector<VertexIdx>& ringOut ) {
+    const HalfEdgeIdx start = heData.getVertexHalfEdge( v );
+    HalfEdgeIdx h = start;
+    HalfEdgeIdx last;
+    while ( h.isValid() )
+    {
+        ringOut.push_back( heData.getToVertex( h ) );
+        last = h;
+        h = heData.getNextVertexHalfEdge( h );
+        if ( h == start )
+        {
+            return;
+        }
     }
-
-    bool operator==( const EdgeKey& other ) const {
-        return ( vLarger == other.vLarger && vSmaller == other.vSmaller );
+    // On the border, the last neighbor is only reached by the previous half edge.
+    if ( last.isValid() )
+    {
+        ringOut.push_back( heData.getFromVertex( HalfEdgeData::getPrev( last ) ) );
     }
-};
+}
 } // namespace
 
-void HalfEdgeData::checkConsistency() const {
-#if defined CORE_DEBUG
-    for ( HalfEdgeIdx i = 0; i < m_halfEdgeList.size(); ++i )
+HalfEdgeData::HalfEdgeData( const TriangleMesh& mesh ) {
+    update( mesh );
+}
+
+HalfEdgeData::HalfEdgeData( uint numVertices, const Container::VectorArray<Triangle>& T ) {
+    update( numVertices, T );
+}
+
+void HalfEdgeData::update( const TriangleMesh& mesh ) {
+    update( mesh.m_vertices.size(), mesh.m_triangles );
+}
+
+void HalfEdgeData::update( uint numVertices, const Container::VectorArray<Triangle>& T ) {
+    const uint numTriangles = T.size();
+    const uint numHalfEdges = 3 * numTriangles;
+    m_triangles = T;
+    m_opposite.assign( numHalfEdges, HalfEdgeIdx::Invalid() );
+    m_vertexHalfEdge.assign( numVertices, HalfEdgeIdx::Invalid() );
+
+    // Half edges starting from each vertex ( counting sort ).
+    std::vector<uint> offsets( numVertices + 1, 0 );
+    for ( const auto& t : T )
+    {
+        for ( uint c = 0; c < 3; ++c )
+        {
+            CORE_ASSERT( t( c ) < numVertices, "Invalid vertex index" );
+            ++offsets[t( c ) + 1];
+        }
+    }
+    for ( uint v = 0; v < numVertices; ++v )
     {
-        const HalfEdge& he = m_halfEdgeList[i];
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<uint> outgoing( numHalfEdges );
+    std::vector<uint> next( offsets.begin(), offsets.end() - 1 );
+    for ( uint h = 0; h < numHalfEdges; ++h )
+    {
+        outgoing[next[T[h / 3]( h % 3 )]++] = h;
+    }
 
-        // Check that each half edge has an opposite half.
-        CORE_ASSERT( he.m_pair.isValid(), "Half edge has no pair." );
-        const HalfEdge& pair = m_halfEdgeList[he.m_pair];
-        CORE_ASSERT( pair.m_pair == i, "Edge pair is inconsistent" );
+    // Number of half edges from -> to, and the last one of them.
+    auto findHalfEdge = [&]( uint from, uint to, uint& found ) {
+        uint count = 0;
+        for ( uint i = offsets[from]; i < offsets[from + 1]; ++i )
+        {
+            const uint h = outgoing[i];
+            if ( T[h / 3]( ( h + 1 ) % 3 ) == to )
+            {
+                found = h;
+                ++count;
+            }
+        }
+        return count;
+    };
 
-        // Check that the outer half-edges are not in any link.
-        if ( he.m_leftTriIdx.isInvalid() )
+    // The opposite of a -> b is b -> a, when both are unique.
+    int numNonManifold = 0;
+#pragma omp parallel for reduction( + : numNonManifold )
+    for ( int h = 0; h < int( numHalfEdges ); ++h )
+    {
+        const uint a = T[h / 3]( h % 3 );
+        const uint b = T[h / 3]( ( h + 1 ) % 3 );
+        if ( a == b )
         {
-            CORE_ASSERT( he.m_next.isInvalid(), "Boundary half edge should be isolated" );
-            CORE_ASSERT( he.m_prev.isInvalid(), "Boundary half edge should be isolated" );
-            CORE_ASSERT( pair.m_leftTriIdx.isValid(), "Isolated edge " );
-        } else
+            continue;
+        }
+        uint opposite = 0;
+        uint same = 0;
+        const uint numOpposite = findHalfEdge( b, a, opposite );
+        const uint numSame = findHalfEdge( a, b, same );
+        if ( numOpposite == 1 && numSame == 1 )
+        {
+            m_opposite[h] = opposite;
+        } else if ( numOpposite > 1 || numSame > 1 )
         {
-            // Check that half-edge belonging to a face are in a good linked list.
-            const HalfEdge& prev = m_halfEdgeList[he.m_prev];
-            const HalfEdge& next = m_halfEdgeList[he.m_next];
+            ++numNonManifold;
+        }
+    }
+    if ( numNonManifold > 0 )
+    {
+        LOG( Utils::logWARNING ) << numNonManifold
+                                 << " half edges are on non manifold edges, set as border.";
+    }
 
-            CORE_ASSERT( prev.m_next == i, "Edge chain is broken" );
-            CORE_ASSERT( next.m_prev == i, "Edge chain is broken" );
-            CORE_ASSERT( next.m_leftTriIdx == he.m_leftTriIdx, "Inconsistent face index" );
+    // The half edge of a border vertex starts the border.
+#pragma omp parallel for
+    for ( int v = 0; v < int( numVertices ); ++v )
+    {
+        for ( uint i = offsets[v]; i < offsets[v + 1]; ++i )
+        {
+            const uint h = outgoing[i];
+            if ( m_vertexHalfEdge[v].isInvalid() || m_opposite[h].isInvalid() )
+            {
+                m_vertexHalfEdge[v] = h;
+            }
+            if ( m_opposite[h].isInvalid() )
+            {
+                break;
+            }
         }
     }
-    // Check vertex to half edge mapping.
-    for ( VertexIdx v = 0; v < m_vertexToHalfEdge.size(); ++v )
+    checkConsistency();
+}
+
+void HalfEdgeData::getOneRings( std::vector<uint>& offsets, std::vector<VertexIdx>& ring ) const {
+    const uint numVertices = getNumVertices();
+    offsets.assign( numVertices + 1, 0 );
+#pragma omp parallel for
+    for ( int v = 0; v < int( numVertices ); ++v )
     {
-        CORE_ASSERT( !m_vertexToHalfEdge[v].empty(), "Isolated vertex" );
-        for ( auto idx : m_vertexToHalfEdge[v] )
+        const HalfEdgeIdx start = m_vertexHalfEdge[v];
+        HalfEdgeIdx h = start;
+        uint valence = 0;
+        while ( h.isValid() )
         {
-            const HalfEdge& he = m_halfEdgeList[idx];
-            const HalfEdge& pair = m_halfEdgeList[he.m_pair];
-            CORE_ASSERT( pair.m_endVertexIdx == v, "Inconsistent vertex index" );
+            ++valence;
+            h = getNextVertexHalfEdge( h );
+            if ( h == start )
+            {
+                break;
+            }
         }
+        // The last border neighbor.
+        offsets[v + 1] = valence + ( h.isInvalid() && start.isValid() ? 1 : 0 );
+    }
+    for ( uint v = 0; v < numVertices; ++v )
+    {
+        offsets[v + 1] += offsets[v];
     }
 
-    for ( TriangleIdx t = 0; t < m_triangleToHalfEdge.size(); ++t )
+    ring.resize( offsets[numVertices] );
+#pragma omp parallel for
+    for ( int v = 0; v < int( numVertices ); ++v )
     {
-        // Check that we can go around a face.
-        HalfEdgeIdx heIdx = m_triangleToHalfEdge[t];
-        const HalfEdge& he = m_halfEdgeList[heIdx];
-        const HalfEdge& next = m_halfEdgeList[he.m_next];
-        const HalfEdge& nextNext = m_halfEdgeList[next.m_next];
+        std::vector<VertexIdx> vertexRing;
+        vertexRing.reserve( offsets[v + 1] - offsets[v] );
+        getRing( *this, v, vertexRing );
+        std::copy( vertexRing.begin(), vertexRing.end(), ring.begin() + offsets[v] );
+    }
+}
 
-        CORE_ASSERT( he.m_leftTriIdx == t, "Inconsistent triangle index" );
-        CORE_ASSERT( next.m_leftTriIdx == t, "Inconsistent triangle index" );
-        CORE_ASSERT( nextNext.m_leftTriIdx == t, "Inconsistent triangle index" );
+VertexIdx HalfEdgeData::splitEdge( HalfEdgeIdx h ) {
+    CORE_ASSERT( !isDeleted( getTriangle( h ) ), "Half edge of a deleted triangle" );
+
+    // Schema of the operation, the new triangles being F2 and F3.
+    /*
+
+     before                                          after
+
+          C                                            C
+        /   \                                     /    |    \
+       /  F0 \                                   / F0  |  F2 \
+      /       \                                 /      |      \
+     / --h---> \                               / -h--> | ----> \
+    A --edge -- B                           A  -----  M ------ B
+     \ <--o--- /                               \ <---- | <-o-- /
+      \       /                                 \      |      /
+       \  F1 /                                   \ F3  |  F1 /
+        \   /                                     \    |    /
+          D                                           D
+
+    */
+    const VertexIdx m = getNumVertices();
+    m_vertexHalfEdge.push_back( HalfEdgeIdx::Invalid() );
+
+    // Triangle ( x, y, z ) of half edge x -> y becomes ( x, m, z ), ( m, y, z ) being added.
+    // Returns the new half edge m -> y.
+    auto splitTriangle = [this, m]( HalfEdgeIdx xy ) {
+        const TriangleIdx t = getTriangle( xy );
+        const uint i = xy % 3;
+        const VertexIdx y = m_triangles[t]( ( i + 1 ) % 3 );
+        const VertexIdx z = m_triangles[t]( ( i + 2 ) % 3 );
+        const HalfEdgeIdx yz = getNext( xy );
+        const HalfEdgeIdx yzOpposite = m_opposite[yz];
+
+        const HalfEdgeIdx my = m_opposite.size();
+        m_triangles.push_back( Triangle( uint( m ), uint( y ), uint( z ) ) );
+        m_opposite.resize( m_opposite.size() + 3, HalfEdgeIdx::Invalid() );
+        m_triangles[t]( ( i + 1 ) % 3 ) = m;
+
+        setOpposite( my + 1, yzOpposite );
+        setOpposite( yz, my + 2 );
+        if ( m_vertexHalfEdge[y] == yz )
+        {
+            m_vertexHalfEdge[y] = my + 1;
+        }
+        return my;
+    };
 
-        CORE_ASSERT( nextNext.m_next == heIdx, "We didn't end back where we started" );
+    const HalfEdgeIdx o = m_opposite[h];
+    const HalfEdgeIdx mb = splitTriangle( h );
+    if ( o.isValid() )
+    {
+        const HalfEdgeIdx ma = splitTriangle( o );
+        setOpposite( h, ma );
+        setOpposite( o, mb );
     }
-#endif
+    resetVertexHalfEdge( m, mb );
+    return m;
 }
 
-void HalfEdgeData::build( const TriangleMesh& mesh ) {
-    m_vertexToHalfEdge.resize( mesh.m_vertices.size() );
-    m_triangleToHalfEdge.resize( mesh.m_triangles.size(), HalfEdgeIdx::Invalid() );
+bool HalfEdgeData::isFlipOk( HalfEdgeIdx h ) const {
+    if ( isDeleted( getTriangle( h ) ) || isBorder( h ) )
+    {
+        return false;
+    }
+    const VertexIdx c = getToVertex( getNext( h ) );
+    const VertexIdx d = getToVertex( getNext( getOpposite( h ) ) );
+    if ( c == d )
+    {
+        return false;
+    }
+    std::vector<VertexIdx> ring;
+    getRing( *this, c, ring );
+    return std::find( ring.begin(), ring.end(), d ) == ring.end();
+}
 
-    std::map<EdgeKey, HalfEdgeIdx> edgeToHalfEdges;
+void HalfEdgeData::flipEdge( HalfEdgeIdx h ) {
+    CORE_ASSERT( isFlipOk( h ), "Edge cannot be flipped" );
+
+    // Triangles ( a, b, c ) and ( b, a, d ) become ( d, c, a ) and ( c, d, b ), each half
+    // edge keeping its position in its triangle.
+    const HalfEdgeIdx o = m_opposite[h];
+    const TriangleIdx t0 = getTriangle( h );
+    const TriangleIdx t1 = getTriangle( o );
+    const uint i = h % 3;
+    const uint j = o % 3;
+    const HalfEdgeIdx hNext = getNext( h );
+    const HalfEdgeIdx hPrev = getPrev( h );
+    const HalfEdgeIdx oNext = getNext( o );
+    const HalfEdgeIdx oPrev = getPrev( o );
+    const VertexIdx a = getFromVertex( h );
+    const VertexIdx b = getToVertex( h );
+    const VertexIdx c = getFromVertex( hPrev );
+    const VertexIdx d = getFromVertex( oPrev );
+    const HalfEdgeIdx bc = m_opposite[hNext];
+    const HalfEdgeIdx ca = m_opposite[hPrev];
+    const HalfEdgeIdx ad = m_opposite[oNext];
+    const HalfEdgeIdx db = m_opposite[oPrev];
+
+    m_triangles[t0]( i ) = d;
+    m_triangles[t0]( ( i + 1 ) % 3 ) = c;
+    m_triangles[t0]( ( i + 2 ) % 3 ) = a;
+    m_triangles[t1]( j ) = c;
+    m_triangles[t1]( ( j + 1 ) % 3 ) = d;
+    m_triangles[t1]( ( j + 2 ) % 3 ) = b;
+    setOpposite( hNext, ca );
+    setOpposite( hPrev, ad );
+    setOpposite( oNext, db );
+    setOpposite( oPrev, bc );
+
+    // Same half edges, at their new index.
+    const std::array<std::pair<HalfEdgeIdx, HalfEdgeIdx>, 6> moved = {{{hPrev, hNext},
+                                                                       {oNext, hPrev},
+                                                                       {oPrev, oNext},
+                                                                       {hNext, oPrev},
+                                                                       {h, hPrev},
+                                                                       {o, oPrev}}};
+    for ( VertexIdx v : {a, b, c, d} )
+    {
+        for ( const auto& m : moved )
+        {
+            if ( m_vertexHalfEdge[v] == m.first )
+            {
+                m_vertexHalfEdge[v] = m.second;
+                break;
+            }
+        }
+    }
+}
 
-    // For all triangles.
-    for ( TriangleIdx t = 0; t < mesh.m_triangles.size(); ++t )
+bool HalfEdgeData::isCollapseOk( HalfEdgeIdx h ) const {
+    if ( isDeleted( getTriangle( h ) ) )
     {
-        const Triangle& tri = mesh.m_triangles[t];
+        return false;
+    }
+    const VertexIdx a = getFromVertex( h );
+    const VertexIdx b = getToVertex( h );
+    const HalfEdgeIdx o = getOpposite( h );
 
-        // This arrays contains the indices of all three half edges of
-        // the current triangle in halfEdgeList.
-        Container::Index triangleHalfEdges[3];
+    // An inner edge between two border vertices would pinch the mesh.
+    if ( o.isValid() && isBorderVertex( a ) && isBorderVertex( b ) )
+    {
+        return false;
+    }
 
-        // for all edges in triangle.
-        for ( uint i = 0; i < 3; ++i )
+    // The vertices opposite to the edge must be the only common neighbors of a and b, and
+    // keep more than one triangle.
+    std::vector<VertexIdx> opposites{getToVertex( getNext( h ) )};
+    if ( o.isValid() )
+    {
+        opposites.push_back( getToVertex( getNext( o ) ) );
+        if ( opposites[0] == opposites[1] )
         {
-            VertexIdx vStart = tri[i];
-            VertexIdx vEnd = tri[( i + 1 ) % 3];
-
-            EdgeKey key;
-            key.vSmaller = std::min( vStart, vEnd );
-            key.vLarger = std::max( vStart, vEnd );
-
-            // If we never visited this edge before, that means we must create the two half edges.
-            auto edgeFound = edgeToHalfEdges.find( key );
-            if ( edgeFound == edgeToHalfEdges.end() )
-            {
-                HalfEdge he1; // Half edge from vStart to vEnd (belonging to this triangle)
-                HalfEdge
-                    he2; // Half edge from vEnd to VStart (belonging to a triangle not yet visited)
-
-                he1.m_endVertexIdx = vEnd;
-                he2.m_endVertexIdx = vStart;
-
-                // he1 is the half edge belonging to this triangle.
-                // he2's triangle will be set when its triangle is visited (invalid)
-                he1.m_leftTriIdx = t;
-
-                uint baseIdx = m_halfEdgeList.size();
-                he1.m_pair = baseIdx + 1;
-                he2.m_pair = baseIdx;
-
-                // Adds them to the vector
-                m_halfEdgeList.push_back( he1 );
-                m_halfEdgeList.push_back( he2 );
-                edgeToHalfEdges.insert( std::make_pair( key, baseIdx ) );
-                triangleHalfEdges[i] = baseIdx;
-
-                m_vertexToHalfEdge[vStart].push_back( baseIdx );
-                m_vertexToHalfEdge[vEnd].push_back( baseIdx + 1 );
-            } else
+            return false;
+        }
+    }
+    std::vector<VertexIdx> ring;
+    for ( VertexIdx v : opposites )
+    {
+        ring.clear();
+        getRing( *this, v, ring );
+        if ( ring.size() <= ( isBorderVertex( v ) ? 2u : 3u ) )
+        {
+            return false;
+        }
+    }
+    std::vector<VertexIdx> ringA;
+    std::vector<VertexIdx> ringB;
+    getRing( *this, a, ringA );
+    getRing( *this, b, ringB );
+    uint numCommon = 0;
+    for ( VertexIdx v : ringA )
+    {
+        if ( std::find( ringB.begin(), ringB.end(), v ) != ringB.end() )
+        {
+            if ( std::find( opposites.begin(), opposites.end(), v ) == opposites.end() )
             {
-                // If we found an existing edge, it means only one of them was belonging to a
-                // triangle so we look for the other, which should be next to the first.
-                uint firstHeIdx = edgeFound->second;
-
-                // Check triangle index consistency
-                CORE_ASSERT( m_halfEdgeList[firstHeIdx].m_leftTriIdx.isValid(),
-                             "First part of the half edge was not visited" );
-                CORE_ASSERT( m_halfEdgeList[firstHeIdx + 1].m_leftTriIdx.isInvalid(),
-                             "Second part of the half edge already visited (3 or more triangle "
-                             "share an edge?)" );
-
-                m_halfEdgeList[firstHeIdx + 1].m_leftTriIdx = t;
-                triangleHalfEdges[i] = firstHeIdx + 1;
+                return false;
             }
+            ++numCommon;
         }
-        // Now all our half edges must be consistent.
-        CORE_ASSERT( ( triangleHalfEdges[0].isValid() ) && ( triangleHalfEdges[1].isValid() ) &&
-                         ( triangleHalfEdges[2].isValid() ),
-                     "Triangle half edges are missing !" );
+    }
+    return numCommon == opposites.size();
+}
 
-        m_triangleToHalfEdge[t] = triangleHalfEdges[0];
-        // We can finally fixup the looping path on the half edges.
+void HalfEdgeData::collapseEdge( HalfEdgeIdx h ) {
+    CORE_ASSERT( isCollapseOk( h ), "Edge cannot be collapsed" );
+
+    const HalfEdgeIdx o = m_opposite[h];
+    const TriangleIdx t0 = getTriangle( h );
+    const TriangleIdx t1 = o.isValid() ? getTriangle( o ) : TriangleIdx::Invalid();
+    const VertexIdx a = getFromVertex( h );
+    const VertexIdx b = getToVertex( h );
+    const VertexIdx c = getFromVertex( getPrev( h ) );
+    const VertexIdx d = o.isValid() ? getFromVertex( getPrev( o ) ) : VertexIdx::Invalid();
+
+    // Outgoing half edges before the collapse, to find the new half edge of the vertices.
+    std::vector<HalfEdgeIdx> fromA;
+    std::vector<HalfEdgeIdx> fromB;
+    std::vector<HalfEdgeIdx> fromC;
+    std::vector<HalfEdgeIdx> fromD;
+    getVertexHalfEdges( a, fromA );
+    getVertexHalfEdges( b, fromB );
+    getVertexHalfEdges( c, fromC );
+    if ( d.isValid() )
+    {
+        getVertexHalfEdges( d, fromD );
+    }
+    fromB.insert( fromB.end(), fromA.begin(), fromA.end() );
+
+    // a becomes b in the remaining triangles, and the edges of the deleted triangles are
+    // glued together.
+    auto isKept = [t0, t1]( HalfEdgeIdx g ) {
+        const TriangleIdx t = getTriangle( g );
+        return t != t0 && t != t1;
+    };
+    for ( HalfEdgeIdx g : fromA )
+    {
+        if ( isKept( g ) )
+        {
+            m_triangles[getTriangle( g )]( g % 3 ) = b;
+        }
+    }
+    std::vector<TriangleIdx> deleted{t0};
+    setOpposite( m_opposite[getNext( h )], m_opposite[getPrev( h )] );
+    if ( o.isValid() )
+    {
+        setOpposite( m_opposite[getNext( o )], m_opposite[getPrev( o )] );
+        deleted.push_back( t1 );
+    }
+    for ( TriangleIdx t : deleted )
+    {
         for ( uint i = 0; i < 3; ++i )
         {
-            CORE_ASSERT( m_halfEdgeList[triangleHalfEdges[i]].m_leftTriIdx == t,
-                         "Inconsistent triangle index" );
+            m_triangles[t]( i ) = VertexIdx::Invalid();
+            m_opposite[3 * t + i] = HalfEdgeIdx::Invalid();
+        }
+    }
 
-            m_halfEdgeList[triangleHalfEdges[i]].m_prev = triangleHalfEdges[( i + 2 ) % 3];
-            m_halfEdgeList[triangleHalfEdges[i]].m_next = triangleHalfEdges[( i + 1 ) % 3];
+    m_vertexHalfEdge[a] = HalfEdgeIdx::Invalid();
+    const std::array<std::pair<VertexIdx, const std::vector<HalfEdgeIdx>*>, 3> changed = {
+        {{b, &fromB}, {c, &fromC}, {d, &fromD}}};
+    for ( const auto& v : changed )
+    {
+        if ( v.first.isValid() )
+        {
+            auto it = std::find_if( v.second->begin(), v.second->end(), isKept );
+            resetVertexHalfEdge( v.first,
+                                 it != v.second->end() ? *it : HalfEdgeIdx::Invalid() );
         }
     }
-    checkConsistency();
 }
 
-void getVertexFaces( const TriangleMesh& mesh, const HalfEdgeData& heData,
-                                       VertexIdx vertex, std::vector<TriangleIdx>& facesOut ) {
-    CORE_ASSERT( vertex < mesh.m_vertices.size(), "Invalid vertex index" );
-    for ( HalfEdgeIdx idx : heData.getVertexHalfEdges( vertex ) )
+void HalfEdgeData::garbageCollection() {
+    const uint numTriangles = getNumTriangles();
+    std::vector<TriangleIdx> triangleMap( numTriangles );
+    uint numKept = 0;
+    for ( uint t = 0; t < numTriangles; ++t )
+    {
+        triangleMap[t] = isDeleted( t ) ? TriangleIdx::Invalid() : TriangleIdx( numKept++ );
+    }
+    auto mapHalfEdge = [&triangleMap]( HalfEdgeIdx h ) {
+        return h.isValid() ? HalfEdgeIdx( 3 * triangleMap[h / 3] + h % 3 )
+                           : HalfEdgeIdx::Invalid();
+    };
+
+    Container::VectorArray<Triangle> triangles( numKept );
+    std::vector<HalfEdgeIdx> opposite( 3 * numKept );
+#pragma omp parallel for
+    for ( int t = 0; t < int( numTriangles ); ++t )
     {
-        const TriangleIdx t = heData[idx].m_leftTriIdx;
-        if ( t.isValid() )
+        const TriangleIdx newT = triangleMap[t];
+        if ( newT.isValid() )
         {
-            facesOut.push_back( t );
+            triangles[newT] = m_triangles[t];
+            for ( uint i = 0; i < 3; ++i )
+            {
+                opposite[3 * newT + i] = mapHalfEdge( m_opposite[3 * t + i] );
+            }
         }
     }
-}
-void getVertexNeighbors( const TriangleMesh& mesh, const HalfEdgeData& heData,
-                                           VertexIdx vertex,
-                                           std::vector<VertexIdx>& neighborsOut ) {
-    CORE_ASSERT( vertex < mesh.m_vertices.size(), "Invalid vertex index" );
-    for ( HalfEdgeIdx idx : heData.getVertexHalfEdges( vertex ) )
+#pragma omp parallel for
+    for ( int v = 0; v < int( getNumVertices() ); ++v )
     {
-        neighborsOut.push_back( heData[idx].m_endVertexIdx );
+        m_vertexHalfEdge[v] = mapHalfEdge( m_vertexHalfEdge[v] );
     }
+    std::swap( m_triangles, triangles );
+    std::swap( m_opposite, opposite );
+    checkConsistency();
 }
 
-void getAdjacentFaces( const TriangleMesh& mesh, const HalfEdgeData& heData,
-                                         TriangleIdx triangle,
-                                         std::array<TriangleIdx, 3>& adjOut ) {
-    HalfEdgeIdx currentHe = heData.getFirstTriangleHalfEdge( triangle );
-    for ( uint i = 0; i < 3; ++i )
+void HalfEdgeData::getTriangles( Container::VectorArray<Triangle>& T ) const {
+    T.clear();
+    T.reserve( getNumTriangles() );
+    for ( uint t = 0; t < getNumTriangles(); ++t )
     {
-        const HalfEdge& flipHe = heData[heData[currentHe].m_pair];
-        adjOut[i] = flipHe.m_leftTriIdx;
-        currentHe = heData[currentHe].m_next;
+        if ( !isDeleted( t ) )
+        {
+            T.push_back( m_triangles[t] );
+        }
     }
 }
 
-// This function is a good example on how to process the neighbors of a vertex
-// in order. We could have an iterator-like interface(TODO).
-void getVertexFirstRing( const TriangleMesh& mesh, const HalfEdgeData& heData,
-                                           VertexIdx vertex, std::vector<VertexIdx>& ringOut ) {
-    CORE_ASSERT( vertex < mesh.m_vertices.size(), "Invalid vertex index" );
-    CORE_ASSERT( heData.getVertexHalfEdges( vertex ).size() > 0, "Vertex has no neighbors" );
-
-    // If we are on a border of the mesh, we must start from one of the border edges.
-    // since we walk counter clockwise, the edge we must start from is the one whose
-    // pair edge has no face. If no such edge exist, then we are not on the border
-    // so any edge will do.
-    // TODO : we could guarantee that the first half edge is always the good one to
-    // start with in build(), which would optimizes this function.
-    HalfEdgeIdx starterEdge = heData.getVertexHalfEdges( vertex )[0];
-    for ( auto heIdx : heData.getVertexHalfEdges( vertex ) )
-    {
-        const HalfEdge& opposite = heData[heData[heIdx].m_pair];
-        if ( opposite.m_leftTriIdx.isInvalid() )
+void HalfEdgeData::getVertexHalfEdges( VertexIdx v, std::vector<HalfEdgeIdx>& halfEdges ) const {
+    halfEdges.clear();
+    const HalfEdgeIdx start = m_vertexHalfEdge[v];
+    HalfEdgeIdx h = start;
+    while ( h.isValid() )
+    {
+        halfEdges.push_back( h );
+        h = getNextVertexHalfEdge( h );
+        if ( h == start )
         {
-            starterEdge = heIdx;
             break;
         }
     }
+}
 
-    CORE_ASSERT( heData[starterEdge].m_leftTriIdx.isValid(),
-                 "Starter edge does not belong to a face" );
-
-    const VertexIdx startVertex = heData[starterEdge].m_endVertexIdx;
-    VertexIdx currentVertex = startVertex;
-    HalfEdgeIdx currentEdgeIdx = heData[starterEdge].m_next;
-
-    do
+void HalfEdgeData::resetVertexHalfEdge( VertexIdx v, HalfEdgeIdx h ) {
+    CORE_ASSERT( h.isInvalid() || getFromVertex( h ) == v, "Half edge not starting from v" );
+    // Turn clockwise until the border, if any.
+    const HalfEdgeIdx start = h;
+    while ( h.isValid() && m_opposite[h].isValid() )
     {
-        // Add current vertex to ring.
-        ringOut.push_back( currentVertex );
+        h = getNext( m_opposite[h] );
+        if ( h == start )
+        {
+            break;
+        }
+    }
+    m_vertexHalfEdge[v] = h;
+}
 
-        // Advance on the ring.
-        currentVertex = heData[currentEdgeIdx].m_endVertexIdx;
+void HalfEdgeData::checkConsistency() const {
+#if defined CORE_DEBUG
+    for ( HalfEdgeIdx h = 0; h < getNumHalfEdges(); ++h )
+    {
+        const HalfEdgeIdx o = m_opposite[h];
+        if ( isDeleted( getTriangle( h ) ) )
+        {
+            CORE_ASSERT( o.isInvalid(), "Deleted half edge is linked" );
+        } else if ( o.isValid() )
+        {
+            CORE_ASSERT( m_opposite[o] == h, "Edge pair is inconsistent" );
+            CORE_ASSERT( !isDeleted( getTriangle( o ) ), "Half edge linked to a deleted one" );
+            CORE_ASSERT( getFromVertex( o ) == getToVertex( h ) &&
+                             getToVertex( o ) == getFromVertex( h ),
+                         "Inconsistent vertex index" );
+        }
+    }
+    for ( VertexIdx v = 0; v < getNumVertices(); ++v )
+    {
+        const HalfEdgeIdx start = m_vertexHalfEdge[v];
+        if ( start.isInvalid() )
+        {
+            continue;
+        }
+        CORE_ASSERT( !isDeleted( getTriangle( start ) ), "Vertex half edge is deleted" );
+        HalfEdgeIdx h = start;
+        do
+        {
+            CORE_ASSERT( getFromVertex( h ) == v, "Inconsistent vertex index" );
+            h = getNextVertexHalfEdge( h );
+        } while ( h.isValid() && h != start );
+        CORE_ASSERT( h.isValid() || isBorder( start ),
+                     "Vertex half edge does not start the border" );
+    }
+#endif
+}
 
-        // To get the next edge along the ring, we must look at the next
-        // half edge from current (which should point to the center vertex,
-        // take its pair half edge so we end up on the next triangle,
-        // and take the next half edge to advance.
-        const HalfEdge& next = heData[heData[currentEdgeIdx].m_next];
-        const HalfEdge& flip = heData[next.m_pair];
-        currentEdgeIdx = flip.m_next;
+void getVertexFaces( const TriangleMesh& mesh, const HalfEdgeData& heData, VertexIdx vertex,
+                     std::vector<TriangleIdx>& facesOut ) {
+    CORE_ASSERT( vertex < mesh.m_vertices.size(), "Invalid vertex index" );
+    const HalfEdgeIdx start = heData.getVertexHalfEdge( vertex );
+    HalfEdgeIdx h = start;
+    while ( h.isValid() )
+    {
+        facesOut.push_back( HalfEdgeData::getTriangle( h ) );
+        h = heData.getNextVertexHalfEdge( h );
+        if ( h == start )
+        {
+            break;
+        }
+    }
+}
 
-        // Some debug checks.
-        CORE_ASSERT( next.m_endVertexIdx == vertex, " Inconsistent half edge data" );
-        CORE_ASSERT( flip.m_endVertexIdx == currentVertex, " Inconsistent half edge data" );
+void getVertexNeighbors( const TriangleMesh& mesh, const HalfEdgeData& heData,
+                         VertexIdx vertex, std::vector<VertexIdx>& neighborsOut ) {
+    getVertexFirstRing( mesh, heData, vertex, neighborsOut );
+}
 
-    } while ( currentVertex != startVertex && currentEdgeIdx.isValid() );
+void getAdjacentFaces( const TriangleMesh& mesh, const HalfEdgeData& heData,
+                       TriangleIdx triangle, std::array<TriangleIdx, 3>& adjOut ) {
+    CORE_ASSERT( triangle < mesh.m_triangles.size(), "Invalid triangle index" );
+    const HalfEdgeIdx first = heData.getFirstTriangleHalfEdge( triangle );
+    for ( uint i = 0; i < 3; ++i )
+    {
+        const HalfEdgeIdx o = heData.getOpposite( first + i );
+        adjOut[i] = o.isValid() ? HalfEdgeData::getTriangle( o ) : TriangleIdx::Invalid();
+    }
+}
 
-    // Now we check that we have all the neighbors.
-    CORE_ASSERT(
-        ringOut.size() == heData.getVertexHalfEdges( vertex ).size(),
-        " Missing some neighbors (the first ring might be broken in more than one place)" );
+void getVertexFirstRing( const TriangleMesh& mesh, const HalfEdgeData& heData,
+                         VertexIdx vertex, std::vector<VertexIdx>& ringOut ) {
+    CORE_ASSERT( vertex < mesh.m_vertices.size(), "Invalid vertex index" );
+    CORE_ASSERT( heData.getVertexHalfEdge( vertex ).isValid(), "Vertex has no neighbors" );
+    getRing( heData, vertex, ringOut );
 }
 } // namespace Geometry
 } // namespace Core
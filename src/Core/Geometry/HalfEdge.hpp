@@ -5,6 +5,7 @@
 #include <array>
 #include <vector>
 
+#include <Core/Container/VectorArray.hpp>
 #include <Core/CoreMacros.hpp>
 #include <Core/Geometry/MeshTypes.hpp>
 
@@ -13,56 +14,128 @@ namespace Core {
 namespace Geometry {
 struct TriangleMesh;
 
-/// A structure representing a Half edge (i.e. directed edge) of a mesh.
-/// All indices are invalid by default
-struct HalfEdge {
-    HalfEdgeIdx m_prev;       // Previous half edge along the face
-    HalfEdgeIdx m_pair;       // Oppositely oriented half-edge
-    HalfEdgeIdx m_next;       // Next half edge around the face
-    TriangleIdx m_leftTriIdx; // Face the half-edge borders (may be invalid)
-    VertexIdx m_endVertexIdx; // Vertex at the end of the edge;
-};
-
-/// Structure holding the half-edge data of one mesh.
-/// Note on non manifold edges : if the mesh is non-closed, two half edges will be constructed
-/// even on the border edges, however the "outer" half-edge will have invalid
-/// face and prev/next indices.
-/// Edges shared by more than 2 triangles are not supported and will cause an assert during
-/// the call to build().
+/// Structure holding the half-edge data of one triangle mesh.
+///
+/// The half edges are implicit : the half edges of triangle t are 3 * t, 3 * t + 1 and
+/// 3 * t + 2, half edge 3 * t + i going from vertex i to vertex i + 1 of the triangle. Only
+/// the triangles, the opposite of each half edge and one outgoing half edge per vertex are
+/// stored, in contiguous arrays of 32 bits indices.
+/// Border half edges have no opposite, and the half edge of a border vertex is the one
+/// starting the border, so that going around a vertex ( see getVertexFirstRing() ) visits all
+/// its triangles.
+/// Edges shared by more than 2 triangles, or by two triangles with inconsistent orientations,
+/// are handled as border edges. Vertices where several fans of triangles meet are not
+/// supported : only one of the fans is reachable when going around them.
 class RA_CORE_API HalfEdgeData {
   public:
+    HalfEdgeData() = default;
+
     /// Build the half edge data from a mesh.
-    inline explicit HalfEdgeData( const TriangleMesh& mesh );
+    explicit HalfEdgeData( const TriangleMesh& mesh );
+    HalfEdgeData( uint numVertices, const Container::VectorArray<Triangle>& T );
 
     /// Completely rebuilds the data from the given mesh.
-    inline void update( const TriangleMesh& mesh );
+    void update( const TriangleMesh& mesh );
+    void update( uint numVertices, const Container::VectorArray<Triangle>& T );
 
     /// Erases all data.
     inline void clear();
 
-    // Accessors to underlying data.
-    inline const HalfEdge& operator[]( HalfEdgeIdx i ) const;
-
-    /// Returns the half edges starting from given vertex.
-    inline const std::vector<HalfEdgeIdx>& getVertexHalfEdges( VertexIdx i ) const;
+    /// \name Sizes
+    /// The deleted triangles ( see collapseEdge() ) are counted until garbageCollection().
+    /// \{
+    inline uint getNumVertices() const;
+    inline uint getNumTriangles() const;
+    inline uint getNumHalfEdges() const;
+    /// \}
+
+    /// \name Navigation
+    /// \{
+    inline static HalfEdgeIdx getNext( HalfEdgeIdx h );
+    inline static HalfEdgeIdx getPrev( HalfEdgeIdx h );
+    inline static TriangleIdx getTriangle( HalfEdgeIdx h );
+
+    /// Returns the oppositely oriented half edge, invalid on the border.
+    inline HalfEdgeIdx getOpposite( HalfEdgeIdx h ) const;
+    inline VertexIdx getFromVertex( HalfEdgeIdx h ) const;
+    inline VertexIdx getToVertex( HalfEdgeIdx h ) const;
+    inline bool isBorder( HalfEdgeIdx h ) const;
+
+    /// Returns one of the half edges starting from given vertex, the one starting the
+    /// border for a border vertex, invalid for an isolated vertex.
+    inline HalfEdgeIdx getVertexHalfEdge( VertexIdx v ) const;
+    inline bool isBorderVertex( VertexIdx v ) const;
+
+    /// Returns the next half edge starting from the same vertex, turning counter clockwise,
+    /// invalid at the end of the border.
+    inline HalfEdgeIdx getNextVertexHalfEdge( HalfEdgeIdx h ) const;
 
     /// Returns one of the half edges around given triangle.
     inline HalfEdgeIdx getFirstTriangleHalfEdge( TriangleIdx t ) const;
 
+    /// Returns the vertices of a triangle.
+    inline const Triangle& getTriangleVertices( TriangleIdx t ) const;
+    inline bool isDeleted( TriangleIdx t ) const;
+    /// \}
+
+    /// Compute the ordered one ring of all the vertices ( see getVertexFirstRing() ) in a
+    /// compressed array : the neighbors of v are ring[offsets[v]] to ring[offsets[v + 1] - 1].
+    void getOneRings( std::vector<uint>& offsets, std::vector<VertexIdx>& ring ) const;
+
+    /// \name Edition
+    /// The operations are local and keep the indices of the other vertices and triangles.
+    /// \{
+
+    /// Split the edge of \p h by a new vertex, whose index is the former number of vertices,
+    /// and split its triangles in two. The new triangles are added at the end.
+    /// Returns the new vertex.
+    VertexIdx splitEdge( HalfEdgeIdx h );
+
+    /// Returns true if the edge of \p h can be flipped : it is not on the border and the
+    /// vertices opposite to it are not already linked.
+    bool isFlipOk( HalfEdgeIdx h ) const;
+
+    /// Replace the edge of \p h by the one linking the vertices opposite to it.
+    /// The two triangles keep their index.
+    void flipEdge( HalfEdgeIdx h );
+
+    /// Returns true if the edge of \p h can be collapsed while keeping a manifold mesh ( link
+    /// condition ).
+    bool isCollapseOk( HalfEdgeIdx h ) const;
+
+    /// Collapse the edge of \p h, merging its start vertex into its end vertex. The triangles
+    /// of the edge are deleted, the start vertex is left isolated.
+    void collapseEdge( HalfEdgeIdx h );
+
+    /// Remove the deleted triangles, which changes the triangle and half edge indices.
+    /// The vertices are kept.
+    void garbageCollection();
+    /// \}
+
+    /// Returns the triangles which are not deleted.
+    void getTriangles( Container::VectorArray<Triangle>& T ) const;
+
     /// Checks the structure is internally consistent (in debug mode).
     void checkConsistency() const;
 
   private:
-    // Internal building function called by update and the constructor.
-    void build( const TriangleMesh& mesh );
+    /// Outgoing half edges of v, in counter clockwise order.
+    void getVertexHalfEdges( VertexIdx v, std::vector<HalfEdgeIdx>& halfEdges ) const;
+
+    /// Set the half edge of v from one of its outgoing half edges, preferring the one
+    /// starting the border.
+    void resetVertexHalfEdge( VertexIdx v, HalfEdgeIdx h );
+
+    /// Link two half edges, which may be invalid.
+    inline void setOpposite( HalfEdgeIdx h0, HalfEdgeIdx h1 );
 
   private:
-    /// Container holding the half edges.
-    std::vector<HalfEdge> m_halfEdgeList;
-    /// Array mapping one vertex to one of the half edges starting from it.
-    std::vector<std::vector<HalfEdgeIdx>> m_vertexToHalfEdge;
-    /// Array mapping one triangle to one of the half edges starting from it.
-    std::vector<HalfEdgeIdx> m_triangleToHalfEdge;
+    /// Vertices of each triangle, the first one being invalid for deleted triangles.
+    Container::VectorArray<Triangle> m_triangles;
+    /// Opposite of each half edge.
+    std::vector<HalfEdgeIdx> m_opposite;
+    /// One outgoing half edge per vertex.
+    std::vector<HalfEdgeIdx> m_vertexHalfEdge;
 };
 
 /// Gets the faces which contain a given vertex.
@@ -78,16 +151,13 @@ RA_CORE_API void getAdjacentFaces( const TriangleMesh& mesh, const HalfEdgeData&
 RA_CORE_API void getVertexNeighbors( const TriangleMesh& mesh, const HalfEdgeData& heData,
                                      VertexIdx vertex, std::vector<VertexIdx>& neighborsOut );
 
-/// Gets the neighbors of a vertex in clockwise order.
+/// Gets the neighbors of a vertex in counter clockwise order.
 /// * If the vertex has a regular neighborhood (i.e. it doesn't sit on the border
 /// of a mesh), then ringOut forms an actual ring and each vertex in it is adjacent to the
 /// previous and next in the array, including the first and last.
-/// * If the vertex is located on the edge but all neighbors still form a connected
-/// graph (i.e. there's only one "missing link" in the ring) then ringOut will be in
-/// the correct order, each vertex adjacent to the previous and next in the array,
-/// except the first and last.
-/// * If there are multiple missing links, this function will assert. Consider using
-/// getVertexNeighbors instead.
+/// * If the vertex is located on the border, ringOut starts and ends with its border
+/// neighbors, each vertex being adjacent to the previous and next in the array, except the
+/// first and last.
 RA_CORE_API void getVertexFirstRing( const TriangleMesh& mesh, const HalfEdgeData& heData,
                                      VertexIdx vertex, std::vector<VertexIdx>& ringOut );
 } // namespace Geometry
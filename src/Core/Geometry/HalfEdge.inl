@@ -3,35 +3,92 @@
 namespace Ra {
 namespace Core {
 namespace Geometry {
-inline HalfEdgeData::HalfEdgeData( const TriangleMesh& mesh ) {
-    build( mesh );
+
+inline void HalfEdgeData::clear() {
+    m_triangles.clear();
+    m_opposite.clear();
+    m_vertexHalfEdge.clear();
+}
+
+inline uint HalfEdgeData::getNumVertices() const {
+    return m_vertexHalfEdge.size();
+}
+
+inline uint HalfEdgeData::getNumTriangles() const {
+    return m_triangles.size();
+}
+
+inline uint HalfEdgeData::getNumHalfEdges() const {
+    return m_opposite.size();
+}
+
+inline HalfEdgeIdx HalfEdgeData::getNext( HalfEdgeIdx h ) {
+    return h % 3 == 2 ? h - 2 : h + 1;
+}
+
+inline HalfEdgeIdx HalfEdgeData::getPrev( HalfEdgeIdx h ) {
+    return h % 3 == 0 ? h + 2 : h - 1;
+}
+
+inline TriangleIdx HalfEdgeData::getTriangle( HalfEdgeIdx h ) {
+    return h / 3;
 }
 
-inline const HalfEdge& HalfEdgeData::operator[]( HalfEdgeIdx i ) const {
-    CORE_ASSERT( i.isValid() && i < m_halfEdgeList.size(), "Invalid Index" );
-    return m_halfEdgeList[i];
+inline HalfEdgeIdx HalfEdgeData::getOpposite( HalfEdgeIdx h ) const {
+    CORE_ASSERT( h.isValid() && h < m_opposite.size(), "Invalid Index" );
+    return m_opposite[h];
 }
 
-inline const std::vector<HalfEdgeIdx>& HalfEdgeData::getVertexHalfEdges( VertexIdx i ) const {
-    CORE_ASSERT( i.isValid() && i < m_vertexToHalfEdge.size(), "Invalid Index" );
-    CORE_ASSERT( !m_vertexToHalfEdge[i].empty(), "Isolated vertex" );
-    return m_vertexToHalfEdge[i];
+inline VertexIdx HalfEdgeData::getFromVertex( HalfEdgeIdx h ) const {
+    CORE_ASSERT( h.isValid() && h < m_opposite.size(), "Invalid Index" );
+    return m_triangles[h / 3]( h % 3 );
+}
+
+inline VertexIdx HalfEdgeData::getToVertex( HalfEdgeIdx h ) const {
+    return getFromVertex( getNext( h ) );
+}
+
+inline bool HalfEdgeData::isBorder( HalfEdgeIdx h ) const {
+    return getOpposite( h ).isInvalid();
+}
+
+inline HalfEdgeIdx HalfEdgeData::getVertexHalfEdge( VertexIdx v ) const {
+    CORE_ASSERT( v.isValid() && v < m_vertexHalfEdge.size(), "Invalid Index" );
+    return m_vertexHalfEdge[v];
+}
+
+inline bool HalfEdgeData::isBorderVertex( VertexIdx v ) const {
+    const HalfEdgeIdx h = getVertexHalfEdge( v );
+    return h.isInvalid() || isBorder( h );
+}
+
+inline HalfEdgeIdx HalfEdgeData::getNextVertexHalfEdge( HalfEdgeIdx h ) const {
+    return getOpposite( getPrev( h ) );
 }
 
 inline HalfEdgeIdx HalfEdgeData::getFirstTriangleHalfEdge( TriangleIdx t ) const {
-    CORE_ASSERT( t.isValid() && t < m_triangleToHalfEdge.size(), "Invalid Index" );
-    return m_triangleToHalfEdge[t];
+    CORE_ASSERT( t.isValid() && t < m_triangles.size(), "Invalid Index" );
+    return 3 * t;
 }
 
-inline void HalfEdgeData::update( const TriangleMesh& mesh ) {
-    clear();
-    build( mesh );
+inline const Triangle& HalfEdgeData::getTriangleVertices( TriangleIdx t ) const {
+    CORE_ASSERT( t.isValid() && t < m_triangles.size(), "Invalid Index" );
+    return m_triangles[t];
 }
 
-inline void HalfEdgeData::clear() {
-    m_halfEdgeList.clear();
-    m_vertexToHalfEdge.clear();
-    m_triangleToHalfEdge.clear();
+inline bool HalfEdgeData::isDeleted( TriangleIdx t ) const {
+    return VertexIdx( getTriangleVertices( t )( 0 ) ).isInvalid();
+}
+
+inline void HalfEdgeData::setOpposite( HalfEdgeIdx h0, HalfEdgeIdx h1 ) {
+    if ( h0.isValid() )
+    {
+        m_opposite[h0] = h1;
+    }
+    if ( h1.isValid() )
+    {
+        m_opposite[h1] = h0;
+    }
 }
 
 } // namespace Geometry
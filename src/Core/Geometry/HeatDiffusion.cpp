@@ -26,6 +26,23 @@ Heat heat( const AreaMatrix& A, const Time& t, const LaplacianMatrix& L,
     return u;
 }
 
+void heat( FactorizationCache& cache, const AreaMatrix& A, const Time& t,
+           const LaplacianMatrix& L, Heat& u, const Delta& delta ) {
+    Math::MatrixN b = delta;
+    Math::MatrixN x;
+    heat( cache, A, t, L, b, x );
+    u.resize( x.rows() );
+    u.getMap() = x.col( 0 );
+}
+
+void heat( FactorizationCache& cache, const AreaMatrix& A, const Time& t,
+           const LaplacianMatrix& L, const Math::MatrixN& delta, Math::MatrixN& u ) {
+    if ( cache.factorize( "heat", t, [&]() -> Math::Sparse { return A + ( t * L ); } ) )
+    {
+        cache.solve( "heat", t, delta, u );
+    }
+}
+
 } // namespace Geometry
 } // namespace Core
 } // namespace Ra
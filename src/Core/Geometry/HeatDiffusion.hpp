@@ -4,6 +4,7 @@
 #include <Core/Geometry/Delta.hpp>        // Delta
 #include <Core/Container/VectorArray.hpp>       // VectorArray
 #include <Core/Geometry/Area.hpp>           // AreaMatrix
+#include <Core/Geometry/FactorizationCache.hpp>
 #include <Core/Geometry/Laplacian.hpp> // LaplacianMatrix
 #include <Core/RaCore.hpp>
 
@@ -61,6 +62,24 @@ RA_CORE_API void heat( const AreaMatrix& A, const Time& t,
 RA_CORE_API Heat heat( const AreaMatrix& A, const Time& t,
                        const LaplacianMatrix& L, const Delta& delta );
 
+/*
+ * Solve the heating equation as above, the factorization of ( A + t * L ) being kept in the
+ * cache. It is only recomputed when the geometry or topology version of the cache changed, in
+ * which case A and L must be the ones of the current mesh.
+ */
+/// WARNING: L must be a positive semi-definite matrix
+RA_CORE_API void heat( FactorizationCache& cache, const AreaMatrix& A, const Time& t,
+                       const LaplacianMatrix& L, Heat& u, const Delta& delta );
+
+/*
+ * Solve the heating equation for several sources at once, given by the columns of delta, the
+ * factorization of ( A + t * L ) being kept in the cache. Column i of u is the heat of the
+ * source i.
+ */
+/// WARNING: L must be a positive semi-definite matrix
+RA_CORE_API void heat( FactorizationCache& cache, const AreaMatrix& A, const Time& t,
+                       const LaplacianMatrix& L, const Math::MatrixN& delta, Math::MatrixN& u );
+
 } // namespace Geometry
 } // namespace Core
 } // namespace Ra
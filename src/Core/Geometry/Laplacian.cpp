@@ -1,6 +1,7 @@
 #include <Core/Geometry/Laplacian.hpp>
 
 #include <Core/Container/CircularIndex.hpp>
+#include <Core/Geometry/OperatorAssembly.hpp>
 
 namespace Ra {
 namespace Core {
@@ -42,29 +43,9 @@ LaplacianMatrix powerLaplacian( const LaplacianMatrix& L, const uint k ) {
 
 LaplacianMatrix cotangentWeightLaplacian( const Container::VectorArray<Math::Vector3>& p,
                                           const Container::VectorArray<Triangle>& T ) {
-    LaplacianMatrix L( p.size(), p.size() );
-    for ( const auto& t : T )
-    {
-        uint i = t( 0 );
-        uint j = t( 1 );
-        uint k = t( 2 );
-        Math::Vector3 IJ = p[j] - p[i];
-        Math::Vector3 JK = p[k] - p[j];
-        Math::Vector3 KI = p[i] - p[k];
-        Scalar cotI = Math::Vector::cotan( IJ, ( -KI ).eval() );
-        Scalar cotJ = Math::Vector::cotan( JK, ( -IJ ).eval() );
-        Scalar cotK = Math::Vector::cotan( KI, ( -JK ).eval() );
-        L.coeffRef( i, j ) -= cotK;
-        L.coeffRef( j, i ) -= cotK;
-        L.coeffRef( j, k ) -= cotI;
-        L.coeffRef( k, j ) -= cotI;
-        L.coeffRef( k, i ) -= cotJ;
-        L.coeffRef( i, k ) -= cotJ;
-        L.coeffRef( i, i ) += cotJ + cotK;
-        L.coeffRef( j, j ) += cotI + cotK;
-        L.coeffRef( k, k ) += cotI + cotJ;
-    }
-    return ( 0.5 * L );
+    LaplacianMatrix L;
+    MeshOperatorAssembler( p.size(), T ).cotangentWeightLaplacian( p, L );
+    return L;
 }
 
 ////////////////
@@ -77,6 +77,24 @@ void laplacianSmoothing( const Container::VectorArray<Math::Vector3>& v,
     std::swap( p, tmp );
 }
 
+void implicitLaplacianSmoothing( FactorizationCache& cache,
+                                 const Container::VectorArray<Math::Vector3>& v,
+                                 const AreaMatrix& A, const LaplacianMatrix& L, const Scalar lambda,
+                                 Container::VectorArray<Math::Vector3>& p ) {
+    p = v;
+    if ( !cache.factorize( "implicitSmoothing", lambda,
+                           [&]() -> Math::Sparse { return A + ( lambda * L ); } ) )
+    {
+        return;
+    }
+    const Math::MatrixN b = A * v.getMap().transpose();
+    Math::MatrixN x;
+    if ( cache.solve( "implicitSmoothing", lambda, b, x ) )
+    {
+        p.getMap() = x.transpose();
+    }
+}
+
 } // namespace Geometry
 } // namespace Core
 } // namespace Ra
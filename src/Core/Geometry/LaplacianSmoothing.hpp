@@ -3,6 +3,8 @@
 
 #include <Core/Geometry/Diffusion.hpp> // ScalarValue
 #include <Core/Container/VectorArray.hpp>        // VectorArray
+#include <Core/Geometry/Area.hpp>           // AreaMatrix
+#include <Core/Geometry/FactorizationCache.hpp>
 #include <Core/Geometry/Laplacian.hpp>  // LaplacianMatrix
 #include <Core/RaCore.hpp>
 
@@ -47,6 +49,27 @@ RA_CORE_API void laplacianSmoothing( const Container::VectorArray<Math::Vector3>
                                      const ScalarValue& weight, const uint iteration,
                                      Container::VectorArray<Math::Vector3>& p );
 
+/*
+ * Return the new position of the vertices v_i after a step of implicit smoothing, solving
+ *
+ *       ( A + lambda * L ) p = A v
+ *
+ * where A is the AreaMatrix and L the positive semi-definite cotangent LaplacianMatrix of the
+ * mesh. The three coordinates are solved at once.
+ * The factorization is kept in the cache, and only recomputed when its geometry or topology
+ * version changed, in which case A and L must be the ones of the current mesh.
+ *
+ * The definition was taken from:
+ * "Implicit Fairing of Irregular Meshes using Diffusion and Curvature Flow"
+ * [ Mathieu Desbrun, Mark Meyer, Peter Schroder, Alan H. Barr ]
+ * SIGGRAPH 1999
+ */
+RA_CORE_API void implicitLaplacianSmoothing( FactorizationCache& cache,
+                                             const Container::VectorArray<Math::Vector3>& v,
+                                             const AreaMatrix& A, const LaplacianMatrix& L,
+                                             const Scalar lambda,
+                                             Container::VectorArray<Math::Vector3>& p );
+
 } // namespace Geometry
 } // namespace Core
 } // namespace Ra
@@ -0,0 +1,263 @@
+#include <Core/Geometry/MeshDistance.hpp>
+
+#include <Core/Geometry/DistanceQueries.hpp>
+#include <Core/Geometry/Normal.hpp>
+#include <Core/Utils/Log.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+MeshDistance::MeshDistance( const TriangleMesh& mesh, uint leafSize ) {
+    build( mesh, leafSize );
+}
+
+void MeshDistance::build( const TriangleMesh& mesh, uint leafSize ) {
+    CORE_ASSERT( leafSize > 0, "Leaves must hold triangles." );
+    const auto& vertices = mesh.m_vertices;
+    m_triangles = mesh.m_triangles;
+    const uint numTriangles = m_triangles.size();
+
+    // Face and edge pseudo normals, the normal of an edge being the sum of the normals of its
+    // triangles.
+    m_faceNormals.resize( numTriangles );
+#pragma omp parallel for
+    for ( int t = 0; t < int( numTriangles ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        const Math::Vector3 n =
+            ( vertices[T[1]] - vertices[T[0]] ).cross( vertices[T[2]] - vertices[T[0]] );
+        m_faceNormals[t] = n.squaredNorm() > 0 ? n.normalized() : Math::Vector3::Zero();
+    }
+    std::vector<std::pair<std::uint64_t, uint>> edges( 3 * numTriangles );
+    for ( uint t = 0; t < numTriangles; ++t )
+    {
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const std::uint64_t a = m_triangles[t][i];
+            const std::uint64_t b = m_triangles[t][( i + 1 ) % 3];
+            edges[3 * t + i] =
+                std::make_pair( std::min( a, b ) << 32 | std::max( a, b ), 3 * t + i );
+        }
+    }
+    std::sort( edges.begin(), edges.end() );
+    m_edgeNormals.resize( 3 * numTriangles );
+    for ( uint begin = 0; begin < edges.size(); )
+    {
+        uint end = begin;
+        Math::Vector3 n = Math::Vector3::Zero();
+        for ( ; end < edges.size() && edges[end].first == edges[begin].first; ++end )
+        {
+            n += m_faceNormals[edges[end].second / 3];
+        }
+        for ( ; begin < end; ++begin )
+        {
+            m_edgeNormals[edges[begin].second] = n;
+        }
+    }
+    angleWeightedNormal( vertices, m_triangles, m_vertexNormals );
+
+    // The hierarchy of the non degenerate triangles, split at the median of their centers.
+    m_nodes.clear();
+    m_triangleIndices.clear();
+    for ( uint t = 0; t < numTriangles; ++t )
+    {
+        if ( !m_faceNormals[t].isZero() )
+        {
+            m_triangleIndices.push_back( t );
+        }
+    }
+    Container::Vector3Array centers( numTriangles );
+#pragma omp parallel for
+    for ( int t = 0; t < int( numTriangles ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        centers[t] = ( vertices[T[0]] + vertices[T[1]] + vertices[T[2]] ) / 3;
+    }
+    if ( !m_triangleIndices.empty() )
+    {
+        m_nodes.push_back( Node{Math::Aabb(), 0, uint( m_triangleIndices.size() )} );
+    }
+    uint levelBegin = 0;
+    while ( levelBegin < m_nodes.size() )
+    {
+        const int levelEnd = int( m_nodes.size() );
+#pragma omp parallel for
+        for ( int i = levelBegin; i < levelEnd; ++i )
+        {
+            Node& node = m_nodes[i];
+            node.m_aabb.setEmpty();
+            Math::Aabb centerAabb;
+            for ( uint j = node.m_first; j < node.m_first + node.m_count; ++j )
+            {
+                const Triangle& T = m_triangles[m_triangleIndices[j]];
+                for ( uint k = 0; k < 3; ++k )
+                {
+                    node.m_aabb.extend( vertices[T[k]] );
+                }
+                centerAabb.extend( centers[m_triangleIndices[j]] );
+            }
+            if ( node.m_count > leafSize )
+            {
+                int axis;
+                centerAabb.sizes().maxCoeff( &axis );
+                auto begin = m_triangleIndices.begin() + node.m_first;
+                std::nth_element( begin, begin + node.m_count / 2, begin + node.m_count,
+                                  [&centers, axis]( uint a, uint b ) {
+                                      return centers[a][axis] < centers[b][axis];
+                                  } );
+            }
+        }
+        for ( int i = levelBegin; i < levelEnd; ++i )
+        {
+            const uint first = m_nodes[i].m_first;
+            const uint count = m_nodes[i].m_count;
+            if ( count > leafSize )
+            {
+                m_nodes[i].m_first = m_nodes.size();
+                m_nodes[i].m_count = 0;
+                m_nodes.push_back( Node{Math::Aabb(), first, count / 2} );
+                m_nodes.push_back( Node{Math::Aabb(), first + count / 2, count - count / 2} );
+            }
+        }
+        levelBegin = levelEnd;
+    }
+
+    m_corners.resize( 3 * m_triangleIndices.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( m_triangleIndices.size() ); ++i )
+    {
+        const Triangle& T = m_triangles[m_triangleIndices[i]];
+        for ( uint k = 0; k < 3; ++k )
+        {
+            m_corners[3 * i + k] = vertices[T[k]];
+        }
+    }
+}
+
+MeshDistance::ClosestPoint MeshDistance::getClosestPoint( const Math::Vector3& q,
+                                                          Scalar maxDistance ) const {
+    ClosestPoint closest;
+    if ( maxDistance < std::sqrt( std::numeric_limits<Scalar>::max() ) )
+    {
+        closest.m_squaredDistance = maxDistance * maxDistance;
+    }
+    if ( m_nodes.empty() )
+    {
+        return closest;
+    }
+    // The depth of the tree is at most the number of bits of the number of triangles.
+    uint stack[64];
+    uint size = 0;
+    stack[size++] = 0;
+    while ( size > 0 )
+    {
+        const Node& node = m_nodes[stack[--size]];
+        // The node is checked again since the closest point may have moved.
+        if ( node.m_aabb.squaredExteriorDistance( q ) >= closest.m_squaredDistance )
+        {
+            continue;
+        }
+        if ( node.m_count > 0 )
+        {
+            for ( uint i = node.m_first; i < node.m_first + node.m_count; ++i )
+            {
+                const PointToTriangleOutput output =
+                    pointToTriSq( q, m_corners[3 * i], m_corners[3 * i + 1], m_corners[3 * i + 2] );
+                if ( output.distanceSquared < closest.m_squaredDistance )
+                {
+                    closest.m_point = output.meshPoint;
+                    closest.m_squaredDistance = output.distanceSquared;
+                    closest.m_triangle = m_triangleIndices[i];
+                    closest.m_flags = output.flags;
+                }
+            }
+            continue;
+        }
+        const Scalar d0 = m_nodes[node.m_first].m_aabb.squaredExteriorDistance( q );
+        const Scalar d1 = m_nodes[node.m_first + 1].m_aabb.squaredExteriorDistance( q );
+        // The nearest child is pushed last to be visited first.
+        const uint nearest = d1 < d0 ? 1 : 0;
+        if ( std::max( d0, d1 ) < closest.m_squaredDistance )
+        {
+            stack[size++] = node.m_first + 1 - nearest;
+        }
+        if ( std::min( d0, d1 ) < closest.m_squaredDistance )
+        {
+            stack[size++] = node.m_first + nearest;
+        }
+    }
+    return closest;
+}
+
+void MeshDistance::getClosestPoints( const Container::Vector3Array& queries,
+                                     std::vector<ClosestPoint>& closest ) const {
+    closest.resize( queries.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        closest[i] = getClosestPoint( queries[i] );
+    }
+}
+
+Math::Vector3 MeshDistance::getPseudoNormal( const ClosestPoint& closest ) const {
+    const uint index = ( closest.m_flags & 0xcu ) >> 2;
+    switch ( closest.m_flags & 0x3u )
+    {
+    case PointToTriangleOutput::HIT_VERTEX:
+        return m_vertexNormals[m_triangles[closest.m_triangle][index]];
+    case PointToTriangleOutput::HIT_EDGE:
+        return m_edgeNormals[3 * closest.m_triangle + index];
+    default:
+        return m_faceNormals[closest.m_triangle];
+    }
+}
+
+Scalar MeshDistance::getSignedDistance( const Math::Vector3& q ) const {
+    const ClosestPoint closest = getClosestPoint( q );
+    if ( closest.m_triangle.isInvalid() )
+    {
+        return std::numeric_limits<Scalar>::max();
+    }
+    const Scalar distance = std::sqrt( closest.m_squaredDistance );
+    return ( q - closest.m_point ).dot( getPseudoNormal( closest ) ) < 0 ? -distance : distance;
+}
+
+void MeshDistance::getSignedDistances( const Container::Vector3Array& queries,
+                                       std::vector<Scalar>& distances ) const {
+    distances.resize( queries.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        distances[i] = getSignedDistance( queries[i] );
+    }
+}
+
+Scalar MeshDistance::getMaxDistance( const Container::Vector3Array& points ) const {
+    std::vector<Scalar> squaredDistances( points.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        squaredDistances[i] = getClosestPoint( points[i] ).m_squaredDistance;
+    }
+    return squaredDistances.empty()
+               ? 0
+               : std::sqrt( *std::max_element( squaredDistances.begin(), squaredDistances.end() ) );
+}
+
+Scalar hausdorffDistance( const TriangleMesh& mesh0, const TriangleMesh& mesh1 ) {
+    const MeshDistance distance0( mesh0 );
+    const MeshDistance distance1( mesh1 );
+    return std::max( distance1.getMaxDistance( mesh0.m_vertices ),
+                     distance0.getMaxDistance( mesh1.m_vertices ) );
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
@@ -0,0 +1,97 @@
+#ifndef RADIUMENGINE_MESHDISTANCE_HPP
+#define RADIUMENGINE_MESHDISTANCE_HPP
+
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Geometry/MeshTypes.hpp>
+#include <Core/Geometry/TriangleMesh.hpp>
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/RaCore.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// Closest point and signed distance queries on the surface of a triangle mesh.
+///
+/// The triangles are stored in a bounding volume hierarchy, built in parallel level by level
+/// by splitting the nodes at the median of the centers of their triangles. The corners of the
+/// triangles of each leaf are contiguous, and the exact distances are computed by
+/// pointToTriSq() on the leaves whose box is closer than the current closest point.
+/// The signed distances use the angle weighted pseudo normals of the closest feature
+/// ( Baerentzen and Aanaes 2005 ), which requires a closed, welded and consistently oriented
+/// mesh. The degenerate triangles are ignored.
+class RA_CORE_API MeshDistance {
+  public:
+    /// Result of a closest point query.
+    struct ClosestPoint {
+        Math::Vector3 m_point{0, 0, 0};
+        Scalar m_squaredDistance{std::numeric_limits<Scalar>::max()};
+        /// Triangle of the closest point, invalid if no triangle is close enough.
+        TriangleIdx m_triangle;
+        /// The closest feature of the triangle, as the flags of PointToTriangleOutput.
+        uchar m_flags{0};
+    };
+
+    MeshDistance() = default;
+    explicit MeshDistance( const TriangleMesh& mesh, uint leafSize = 4 );
+
+    /// Build the hierarchy of the mesh triangles, the leaves having at most leafSize triangles.
+    void build( const TriangleMesh& mesh, uint leafSize = 4 );
+
+    /// Returns the closest point of the surface to q, if it is closer than maxDistance.
+    ClosestPoint getClosestPoint( const Math::Vector3& q,
+                                  Scalar maxDistance = std::numeric_limits<Scalar>::max() ) const;
+
+    /// Get the closest point to each query, in parallel.
+    void getClosestPoints( const Container::Vector3Array& queries,
+                           std::vector<ClosestPoint>& closest ) const;
+
+    /// Returns the distance of q to the surface, negative inside.
+    Scalar getSignedDistance( const Math::Vector3& q ) const;
+
+    /// Get the signed distance of each query, in parallel.
+    void getSignedDistances( const Container::Vector3Array& queries,
+                             std::vector<Scalar>& distances ) const;
+
+    /// Returns the largest distance of the points to the surface.
+    Scalar getMaxDistance( const Container::Vector3Array& points ) const;
+
+  private:
+    /// A leaf holds the triangles m_first to m_first + m_count - 1 of the leaf order, an inner
+    /// node has m_count = 0 and its children are m_first and m_first + 1.
+    struct Node {
+        Math::Aabb m_aabb;
+        uint m_first;
+        uint m_count;
+    };
+
+    /// Returns the pseudo normal of the closest feature of a closest point.
+    Math::Vector3 getPseudoNormal( const ClosestPoint& closest ) const;
+
+  private:
+    std::vector<Node> m_nodes;
+    /// The corners of the triangles, three per triangle in the leaf order.
+    Container::Vector3Array m_corners;
+    /// Index in the mesh of the triangles, in the leaf order.
+    std::vector<uint> m_triangleIndices;
+
+    /// Pseudo normals, indexed as the mesh.
+    Container::VectorArray<Triangle> m_triangles;
+    Container::Vector3Array m_faceNormals;
+    /// Normals of the edges ( t[i], t[i + 1] ) of each triangle t, three per triangle.
+    Container::Vector3Array m_edgeNormals;
+    Container::Vector3Array m_vertexNormals;
+};
+
+/// Returns the symmetric Hausdorff distance between the surfaces, sampled at the vertices of
+/// the meshes, i.e. the largest distance of a vertex of a mesh to the surface of the other.
+RA_CORE_API Scalar hausdorffDistance( const TriangleMesh& mesh0, const TriangleMesh& mesh1 );
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_MESHDISTANCE_HPP
@@ -2,6 +2,7 @@
 #include <Core/Math/Math.hpp>
 #include <Core/Math/RayCast.hpp>
 #include <Core/Geometry/MeshUtils.hpp>
+#include <Core/Geometry/VertexNormals.hpp>
 #include <Core/Utils/StringUtils.hpp>
 
 #include <map>
@@ -17,24 +18,8 @@ namespace Core {
 namespace Geometry {
 
 void getAutoNormals( TriangleMesh& mesh, Container::VectorArray<Math::Vector3>& normalsOut ) {
-    const uint numVertices = mesh.m_vertices.size();
-    const uint numTriangles = mesh.m_triangles.size();
-
-    normalsOut.clear();
-    normalsOut.resize( numVertices, Math::Vector3::Zero() );
-
-    for ( uint t = 0; t < numTriangles; t++ )
-    {
-        const Triangle& tri = mesh.m_triangles[t];
-        Math::Vector3 n = getTriangleNormal( mesh, t );
-
-        for ( uint i = 0; i < 3; ++i )
-        {
-            normalsOut[tri[i]] += n;
-        }
-    }
-
-    normalsOut.getMap().colwise().normalize();
+    VertexNormals normals( mesh.m_vertices.size(), mesh.m_triangles );
+    normals.compute( mesh.m_vertices, normalsOut );
 }
 
 bool findDuplicates( const TriangleMesh& mesh, std::vector<VertexIdx>& duplicatesMap ) {
@@ -1,6 +1,7 @@
 #include <Core/Geometry/Normal.hpp>
 
 #include <Core/Geometry/TriangleOperation.hpp>
+#include <Core/Geometry/VertexNormals.hpp>
 #include <Core/Container/CircularIndex.hpp>
 
 #include <Core/Utils/Timer.hpp>
@@ -15,71 +16,15 @@ namespace Geometry {
 
 void uniformNormal( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T,
                     Container::VectorArray<Math::Vector3>& normal ) {
-    const uint N = p.size();
-    normal.clear();
-    normal.resize( N, Math::Vector3::Zero() );
-
-    for ( const auto& t : T )
-    {
-        const uint i = t( 0 );
-        const uint j = t( 1 );
-        const uint k = t( 2 );
-        const Math::Vector3 triN = triangleNormal( p[i], p[j], p[k] );
-        if ( !triN.allFinite() )
-        {
-            continue;
-        }
-        normal[i] += triN;
-        normal[j] += triN;
-        normal[k] += triN;
-    }
-
-#pragma omp parallel for
-    for ( uint i = 0; i < N; ++i )
-    {
-        if ( !normal[i].isApprox( Math::Vector3::Zero() ) )
-        {
-            normal[i].normalize();
-        }
-    }
+    VertexNormals( p.size(), T, VertexNormals::WEIGHT_UNIFORM ).compute( p, normal );
 }
 
 void uniformNormal( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T,
                     const std::vector<Ra::Core::Container::Index>& duplicateTable,
                     Container::VectorArray<Math::Vector3>& normal ) {
-    const uint N = p.size();
-    normal.clear();
-    normal.resize( N, Math::Vector3::Zero() );
-
-    for ( const auto& t : T )
-    {
-        const Container::Index i = duplicateTable.at( t( 0 ) );
-        const Container::Index j = duplicateTable.at( t( 1 ) );
-        const Container::Index k = duplicateTable.at( t( 2 ) );
-        const Math::Vector3 triN = triangleNormal( p[i], p[j], p[k] );
-        if ( !triN.allFinite() )
-        {
-            continue;
-        }
-        normal[i] += triN;
-        normal[j] += triN;
-        normal[k] += triN;
-    }
-
-#pragma omp parallel for
-    for ( uint i = 0; i < N; ++i )
-    {
-        if ( !normal[i].isApprox( Math::Vector3::Zero() ) )
-        {
-            normal[i].normalize();
-        }
-    }
-
-#pragma omp parallel for
-    for ( uint i = 0; i < N; ++i )
-    {
-        normal[i] = normal[duplicateTable[i]];
-    }
+    VertexNormals normals;
+    normals.setTopology( p.size(), T, duplicateTable );
+    normals.compute( p, normal );
 }
 
 Math::Vector3 localUniformNormal( const uint i, const Container::VectorArray<Math::Vector3>& p,
@@ -98,48 +43,12 @@ Math::Vector3 localUniformNormal( const uint i, const Container::VectorArray<Mat
 
 void angleWeightedNormal( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T,
                           Container::VectorArray<Math::Vector3>& normal ) {
-    const uint N = p.size();
-    normal.clear();
-    normal.resize( N, Math::Vector3::Zero() );
-    for ( const auto& t : T )
-    {
-        uint i = t( 0 );
-        uint j = t( 1 );
-        uint k = t( 2 );
-        const Math::Vector3 triN = triangleNormal( p[i], p[j], p[k] );
-        const Scalar theta_i = Math::Vector::angle( ( p[j] - p[i] ), ( p[k] - p[i] ) );
-        const Scalar theta_j = Math::Vector::angle( ( p[i] - p[j] ), ( p[k] - p[j] ) );
-        const Scalar theta_k = Math::Vector::angle( ( p[i] - p[k] ), ( p[j] - p[k] ) );
-        normal[i] += theta_i * triN;
-        normal[j] += theta_j * triN;
-        normal[k] += theta_k * triN;
-    }
-    for ( auto& n : normal )
-    {
-        n.normalize();
-    }
+    VertexNormals( p.size(), T, VertexNormals::WEIGHT_ANGLE ).compute( p, normal );
 }
 
 void areaWeightedNormal( const Container::VectorArray<Math::Vector3>& p, const Container::VectorArray<Triangle>& T,
                          Container::VectorArray<Math::Vector3>& normal ) {
-    const uint N = p.size();
-    normal.clear();
-    normal.resize( N, Math::Vector3::Zero() );
-    for ( const auto& t : T )
-    {
-        uint i = t( 0 );
-        uint j = t( 1 );
-        uint k = t( 2 );
-        const Scalar area = triangleArea( p[i], p[j], p[k] );
-        const Math::Vector3 triN = area * triangleNormal( p[i], p[j], p[k] );
-        normal[i] += triN;
-        normal[j] += triN;
-        normal[k] += triN;
-    }
-    for ( auto& n : normal )
-    {
-        n.normalize();
-    }
+    VertexNormals( p.size(), T, VertexNormals::WEIGHT_AREA ).compute( p, normal );
 }
 
 ////////////////
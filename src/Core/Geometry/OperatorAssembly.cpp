@@ -0,0 +1,299 @@
+#include <Core/Geometry/OperatorAssembly.hpp>
+
+#include <Core/Geometry/TriangleOperation.hpp>
+
+#include <algorithm>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+namespace {
+
+/// Local entries of the patterns, for a triangle ( i, j, k ) : 0, 1 and 2 stand for the
+/// vertices i, j and k, 3 for the triangle itself.
+using LocalEntry = std::pair<uint, uint>;
+
+const std::vector<LocalEntry>& getLocalEntries( uint type ) {
+    static const std::vector<LocalEntry> entries[] = {
+        // Laplacian.
+        {{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 0}, {0, 2}, {0, 0}, {1, 1}, {2, 2}},
+        // Edges.
+        {{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 0}, {0, 2}},
+        // Half-edges.
+        {{0, 1}, {1, 2}, {2, 0}},
+        // Triangle to vertex.
+        {{3, 0}, {3, 1}, {3, 2}},
+        // Diagonal.
+        {{0, 0}, {1, 1}, {2, 2}}};
+    return entries[type];
+}
+
+/// Cotangents of the angles of the triangle at its vertices.
+inline Math::Vector3 triangleCotangents( const Math::Vector3& pi, const Math::Vector3& pj,
+                                         const Math::Vector3& pk ) {
+    const Math::Vector3 IJ = pj - pi;
+    const Math::Vector3 JK = pk - pj;
+    const Math::Vector3 KI = pi - pk;
+    return Math::Vector3( Math::Vector::cotan( IJ, ( -KI ).eval() ),
+                          Math::Vector::cotan( JK, ( -IJ ).eval() ),
+                          Math::Vector::cotan( KI, ( -JK ).eval() ) );
+}
+
+} // namespace
+
+MeshOperatorAssembler::MeshOperatorAssembler( uint numVertices,
+                                              const Container::VectorArray<Triangle>& T ) {
+    setTopology( numVertices, T );
+}
+
+void MeshOperatorAssembler::setTopology( uint numVertices,
+                                         const Container::VectorArray<Triangle>& T ) {
+    m_numVertices = numVertices;
+    m_triangles = T;
+    for ( auto& pattern : m_patterns )
+    {
+        pattern = Pattern();
+    }
+}
+
+bool MeshOperatorAssembler::hasTopology( uint numVertices,
+                                         const Container::VectorArray<Triangle>& T ) const {
+    return numVertices == m_numVertices && T.size() == m_triangles.size() &&
+           std::equal( T.begin(), T.end(), m_triangles.begin() );
+}
+
+const MeshOperatorAssembler::Pattern& MeshOperatorAssembler::getPattern( PatternType type ) {
+    Pattern& pattern = m_patterns[type];
+    if ( pattern.m_isBuilt )
+    {
+        return pattern;
+    }
+
+    const std::vector<LocalEntry>& entries = getLocalEntries( type );
+    const uint stride = entries.size();
+    const uint numTriangles = m_triangles.size();
+    auto globalIndex = [this]( uint t, uint local ) -> int {
+        return local == 3 ? int( t ) : int( m_triangles[t]( local ) );
+    };
+
+    // Symbolic part : the structure of the matrix, Eigen sorting and merging the entries.
+    std::vector<Eigen::Triplet<Scalar>> triplets( numTriangles * stride );
+#pragma omp parallel for
+    for ( int t = 0; t < int( numTriangles ); ++t )
+    {
+        for ( uint e = 0; e < stride; ++e )
+        {
+            triplets[t * stride + e] = Eigen::Triplet<Scalar>(
+                globalIndex( t, entries[e].first ), globalIndex( t, entries[e].second ), 0 );
+        }
+    }
+    pattern.m_matrix.resize( type == PATTERN_TRIANGLE ? numTriangles : m_numVertices,
+                             m_numVertices );
+    pattern.m_matrix.setFromTriplets( triplets.begin(), triplets.end() );
+    pattern.m_matrix.makeCompressed();
+    triplets.clear();
+    triplets.shrink_to_fit();
+
+    // Coefficient of each contribution, found in the sorted rows of its column.
+    const int* outer = pattern.m_matrix.outerIndexPtr();
+    const int* inner = pattern.m_matrix.innerIndexPtr();
+    std::vector<int> slots( numTriangles * stride );
+#pragma omp parallel for
+    for ( int t = 0; t < int( numTriangles ); ++t )
+    {
+        for ( uint e = 0; e < stride; ++e )
+        {
+            const int row = globalIndex( t, entries[e].first );
+            const int col = globalIndex( t, entries[e].second );
+            slots[t * stride + e] =
+                int( std::lower_bound( inner + outer[col], inner + outer[col + 1], row ) - inner );
+        }
+    }
+
+    // Contributions grouped by coefficient ( counting sort ), in the order of the triangles
+    // so that the sums do not depend on the number of threads.
+    const int nnz = pattern.m_matrix.nonZeros();
+    pattern.m_offsets.assign( nnz + 1, 0 );
+    for ( int s : slots )
+    {
+        ++pattern.m_offsets[s + 1];
+    }
+    for ( int s = 0; s < nnz; ++s )
+    {
+        pattern.m_offsets[s + 1] += pattern.m_offsets[s];
+    }
+    pattern.m_contributions.resize( slots.size() );
+    std::vector<int> next( pattern.m_offsets.begin(), pattern.m_offsets.end() - 1 );
+    for ( uint c = 0; c < slots.size(); ++c )
+    {
+        pattern.m_contributions[next[slots[c]]++] = c;
+    }
+
+    pattern.m_isBuilt = true;
+    return pattern;
+}
+
+void MeshOperatorAssembler::fill( const Pattern& pattern, const std::vector<Scalar>& values,
+                                  Math::Sparse& M ) const {
+    const Math::Sparse& S = pattern.m_matrix;
+    const bool samePattern =
+        M.rows() == S.rows() && M.cols() == S.cols() && M.isCompressed() &&
+        M.nonZeros() == S.nonZeros() &&
+        std::equal( S.outerIndexPtr(), S.outerIndexPtr() + S.outerSize() + 1,
+                    M.outerIndexPtr() ) &&
+        std::equal( S.innerIndexPtr(), S.innerIndexPtr() + S.nonZeros(), M.innerIndexPtr() );
+    if ( !samePattern )
+    {
+        M = S;
+    }
+
+    Scalar* coefficients = M.valuePtr();
+    const int nnz = M.nonZeros();
+#pragma omp parallel for
+    for ( int s = 0; s < nnz; ++s )
+    {
+        Scalar sum = 0;
+        for ( int c = pattern.m_offsets[s]; c < pattern.m_offsets[s + 1]; ++c )
+        {
+            sum += values[pattern.m_contributions[c]];
+        }
+        coefficients[s] = sum;
+    }
+}
+
+void MeshOperatorAssembler::cotangentWeightLaplacian(
+    const Container::VectorArray<Math::Vector3>& p, Math::Sparse& L ) {
+    CORE_ASSERT( p.size() == m_numVertices, "Wrong number of vertices" );
+    const Pattern& pattern = getPattern( PATTERN_LAPLACIAN );
+    std::vector<Scalar> values( 9 * m_triangles.size() );
+#pragma omp parallel for
+    for ( int t = 0; t < int( m_triangles.size() ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        const Math::Vector3 cot =
+            Scalar( 0.5 ) * triangleCotangents( p[T( 0 )], p[T( 1 )], p[T( 2 )] );
+        Scalar* v = &values[9 * t];
+        v[0] = v[1] = -cot( 2 );
+        v[2] = v[3] = -cot( 0 );
+        v[4] = v[5] = -cot( 1 );
+        v[6] = cot( 1 ) + cot( 2 );
+        v[7] = cot( 0 ) + cot( 2 );
+        v[8] = cot( 0 ) + cot( 1 );
+    }
+    fill( pattern, values, L );
+}
+
+void MeshOperatorAssembler::cotangentWeightAdjacency(
+    const Container::VectorArray<Math::Vector3>& p, Math::Sparse& A ) {
+    CORE_ASSERT( p.size() == m_numVertices, "Wrong number of vertices" );
+    const Pattern& pattern = getPattern( PATTERN_EDGE );
+    std::vector<Scalar> values( 6 * m_triangles.size() );
+#pragma omp parallel for
+    for ( int t = 0; t < int( m_triangles.size() ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        const Math::Vector3 cot =
+            Scalar( 0.5 ) * triangleCotangents( p[T( 0 )], p[T( 1 )], p[T( 2 )] );
+        Scalar* v = &values[6 * t];
+        v[0] = v[1] = cot( 2 );
+        v[2] = v[3] = cot( 0 );
+        v[4] = v[5] = cot( 1 );
+    }
+    fill( pattern, values, A );
+}
+
+void MeshOperatorAssembler::uniformAdjacency( Math::Sparse& A ) {
+    // The coefficients are 1 whatever the number of triangles sharing the edge.
+    const Pattern& pattern = getPattern( PATTERN_HALF_EDGE );
+    A = pattern.m_matrix;
+    std::fill( A.valuePtr(), A.valuePtr() + A.nonZeros(), Scalar( 1 ) );
+}
+
+void MeshOperatorAssembler::triangleUniformAdjacency( Math::Sparse& A ) {
+    const Pattern& pattern = getPattern( PATTERN_TRIANGLE );
+    A = pattern.m_matrix;
+    std::fill( A.valuePtr(), A.valuePtr() + A.nonZeros(), Scalar( 1 ) );
+}
+
+void MeshOperatorAssembler::oneRingArea( const Container::VectorArray<Math::Vector3>& p,
+                                         Math::Sparse& A ) {
+    CORE_ASSERT( p.size() == m_numVertices, "Wrong number of vertices" );
+    const Pattern& pattern = getPattern( PATTERN_DIAGONAL );
+    std::vector<Scalar> values( 3 * m_triangles.size() );
+#pragma omp parallel for
+    for ( int t = 0; t < int( m_triangles.size() ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        const Scalar area = triangleArea( p[T( 0 )], p[T( 1 )], p[T( 2 )] );
+        values[3 * t] = values[3 * t + 1] = values[3 * t + 2] = area;
+    }
+    fill( pattern, values, A );
+}
+
+void MeshOperatorAssembler::voronoiArea( const Container::VectorArray<Math::Vector3>& p,
+                                         Math::Sparse& A ) {
+    CORE_ASSERT( p.size() == m_numVertices, "Wrong number of vertices" );
+    const Pattern& pattern = getPattern( PATTERN_DIAGONAL );
+    std::vector<Scalar> values( 3 * m_triangles.size() );
+#pragma omp parallel for
+    for ( int t = 0; t < int( m_triangles.size() ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        const Math::Vector3& pi = p[T( 0 )];
+        const Math::Vector3& pj = p[T( 1 )];
+        const Math::Vector3& pk = p[T( 2 )];
+        values[3 * t] =
+            Math::Vector::cotan( ( pi - pk ), ( pj - pk ) ) * ( pi - pj ).squaredNorm() / 8;
+        values[3 * t + 1] =
+            Math::Vector::cotan( ( pj - pi ), ( pk - pi ) ) * ( pj - pk ).squaredNorm() / 8;
+        values[3 * t + 2] =
+            Math::Vector::cotan( ( pk - pj ), ( pi - pj ) ) * ( pk - pi ).squaredNorm() / 8;
+    }
+    fill( pattern, values, A );
+}
+
+void MeshOperatorAssembler::mixedArea( const Container::VectorArray<Math::Vector3>& p,
+                                       Math::Sparse& A ) {
+    CORE_ASSERT( p.size() == m_numVertices, "Wrong number of vertices" );
+    const Pattern& pattern = getPattern( PATTERN_DIAGONAL );
+    std::vector<Scalar> values( 3 * m_triangles.size() );
+#pragma omp parallel for
+    for ( int t = 0; t < int( m_triangles.size() ); ++t )
+    {
+        const Triangle& T = m_triangles[t];
+        const Math::Vector3& pi = p[T( 0 )];
+        const Math::Vector3& pj = p[T( 1 )];
+        const Math::Vector3& pk = p[T( 2 )];
+        Scalar* v = &values[3 * t];
+        if ( !isTriangleObtuse( pi, pj, pk ) )
+        {
+            // Voronoi area of each vertex.
+            const Scalar IJ = ( pj - pi ).squaredNorm();
+            const Scalar JK = ( pk - pj ).squaredNorm();
+            const Scalar KI = ( pi - pk ).squaredNorm();
+            const Math::Vector3 cot = triangleCotangents( pi, pj, pk );
+            v[0] = ( ( KI * cot( 1 ) ) + ( IJ * cot( 2 ) ) ) / 8;
+            v[1] = ( ( IJ * cot( 2 ) ) + ( JK * cot( 0 ) ) ) / 8;
+            v[2] = ( ( JK * cot( 0 ) ) + ( KI * cot( 1 ) ) ) / 8;
+        } else
+        {
+            // Half of the area for the obtuse vertex, a quarter for the others.
+            const Scalar area = triangleArea( pi, pj, pk );
+            v[0] = v[1] = v[2] = area / 4;
+            if ( ( pj - pi ).normalized().dot( ( pk - pi ).normalized() ) < 0 )
+            {
+                v[0] = area / 2;
+            } else if ( ( pk - pj ).normalized().dot( ( pi - pj ).normalized() ) < 0 )
+            {
+                v[1] = area / 2;
+            } else
+            { v[2] = area / 2; }
+        }
+    }
+    fill( pattern, values, A );
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
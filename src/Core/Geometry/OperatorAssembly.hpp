@@ -0,0 +1,102 @@
+#ifndef RADIUMENGINE_OPERATORASSEMBLY_HPP
+#define RADIUMENGINE_OPERATORASSEMBLY_HPP
+
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Geometry/MeshTypes.hpp>
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/RaCore.hpp>
+
+#include <array>
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// Assembly of the sparse operators of a triangle mesh ( Laplacian, adjacency and area
+/// matrices, see Laplacian.hpp, Adjacency.hpp and Area.hpp ).
+///
+/// The sparsity pattern of each operator only depends on the triangles. It is built once, the
+/// first time the operator is requested, along with the list of the triangle contributions to
+/// each of its coefficients. Then the coefficients are computed in parallel : each triangle
+/// computes its contributions, and each coefficient sums the ones falling on it.
+/// Hence an assembler kept with a mesh refills its operators without symbolic work when only
+/// the vertex positions change, e.g. during skinning or smoothing.
+/// The free functions of Laplacian.hpp, Adjacency.hpp and Area.hpp go through a temporary
+/// assembler and redo the symbolic work at each call : caching the assembler of a mesh is left
+/// to the callers which refill its operators.
+class RA_CORE_API MeshOperatorAssembler {
+  public:
+    MeshOperatorAssembler() = default;
+    MeshOperatorAssembler( uint numVertices, const Container::VectorArray<Triangle>& T );
+
+    /// Set the connectivity of the operators, dropping the cached patterns.
+    void setTopology( uint numVertices, const Container::VectorArray<Triangle>& T );
+
+    /// Returns true if the assembler has been set up with this connectivity.
+    bool hasTopology( uint numVertices, const Container::VectorArray<Triangle>& T ) const;
+
+    uint getNumVertices() const { return m_numVertices; }
+    uint getNumTriangles() const { return m_triangles.size(); }
+
+    /// The operators below are the ones of the functions of the same name, for the vertex
+    /// positions \p p. The output matrix keeps its storage if it already has the pattern of
+    /// the operator, e.g. when filled by a previous call.
+
+    void cotangentWeightLaplacian( const Container::VectorArray<Math::Vector3>& p,
+                                   Math::Sparse& L );
+
+    void cotangentWeightAdjacency( const Container::VectorArray<Math::Vector3>& p,
+                                   Math::Sparse& A );
+
+    void uniformAdjacency( Math::Sparse& A );
+
+    void triangleUniformAdjacency( Math::Sparse& A );
+
+    void oneRingArea( const Container::VectorArray<Math::Vector3>& p, Math::Sparse& A );
+
+    void voronoiArea( const Container::VectorArray<Math::Vector3>& p, Math::Sparse& A );
+
+    void mixedArea( const Container::VectorArray<Math::Vector3>& p, Math::Sparse& A );
+
+  private:
+    /// Sparsity patterns, by the coefficients each triangle contributes to.
+    enum PatternType : uint {
+        PATTERN_LAPLACIAN = 0, ///< Edges in both directions and vertices.
+        PATTERN_EDGE,          ///< Edges in both directions.
+        PATTERN_HALF_EDGE,     ///< Edges in the direction of the triangles.
+        PATTERN_TRIANGLE,      ///< Triangle to vertex incidence.
+        PATTERN_DIAGONAL,      ///< Vertices.
+
+        MAX_PATTERN
+    };
+
+    struct Pattern {
+        /// Structure of the operator, with zero coefficients.
+        Math::Sparse m_matrix;
+        /// The contributions to the coefficient s are m_contributions[m_offsets[s]] to
+        /// m_contributions[m_offsets[s + 1] - 1], indexing the values computed by the
+        /// triangles ( the one of the local entry e of triangle t being t * stride + e ).
+        std::vector<int> m_offsets;
+        std::vector<int> m_contributions;
+        bool m_isBuilt{false};
+    };
+
+    /// Returns the pattern of the given type, building it if needed.
+    const Pattern& getPattern( PatternType type );
+
+    /// Copy the structure of \p pattern in \p M if it differs, and set each coefficient of M
+    /// to the sum of its contributions in \p values.
+    void fill( const Pattern& pattern, const std::vector<Scalar>& values, Math::Sparse& M ) const;
+
+  private:
+    uint m_numVertices{0};
+    Container::VectorArray<Triangle> m_triangles;
+    std::array<Pattern, MAX_PATTERN> m_patterns;
+};
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_OPERATORASSEMBLY_HPP
@@ -0,0 +1,276 @@
+#include <Core/Geometry/PointCloudProcessing.hpp>
+
+#include <Core/Geometry/PointCloud.hpp>
+#include <Core/Utils/Log.hpp>
+
+#include <Eigen/Eigenvalues>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <tuple>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+namespace {
+/// Symmetric k nearest neighbors graph, the neighbors of i being
+/// neighbors[offsets[i]] to neighbors[offsets[i + 1] - 1].
+void getNeighborGraph( const PointKdTree& tree, const Container::Vector3Array& points, uint k,
+                       std::vector<uint>& offsets, std::vector<uint>& neighbors ) {
+    k = std::min( k + 1, uint( points.size() ) );
+    std::vector<uint> nearest;
+    tree.getKNearest( points, k, nearest );
+
+    // Counting sort of the edges in both directions, the point itself being skipped.
+    offsets.assign( points.size() + 1, 0 );
+    for ( uint i = 0; i < points.size(); ++i )
+    {
+        for ( uint j = k * i; j < k * i + k; ++j )
+        {
+            if ( nearest[j] != i )
+            {
+                ++offsets[i + 1];
+                ++offsets[nearest[j] + 1];
+            }
+        }
+    }
+    std::partial_sum( offsets.begin(), offsets.end(), offsets.begin() );
+    std::vector<uint> next( offsets.begin(), offsets.end() - 1 );
+    neighbors.resize( offsets.back() );
+    for ( uint i = 0; i < points.size(); ++i )
+    {
+        for ( uint j = k * i; j < k * i + k; ++j )
+        {
+            if ( nearest[j] != i )
+            {
+                neighbors[next[i]++] = nearest[j];
+                neighbors[next[nearest[j]]++] = i;
+            }
+        }
+    }
+}
+} // namespace
+
+void estimateNormals( const PointKdTree& tree, const Container::Vector3Array& points, uint k,
+                      Container::Vector3Array& normals ) {
+    CORE_ASSERT( tree.size() == points.size(), "Tree not built on the points." );
+    normals.resize( points.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        std::vector<uint> nearest;
+        tree.getKNearest( points[i], k, nearest );
+        Math::Vector3 mean = Math::Vector3::Zero();
+        for ( uint j : nearest )
+        {
+            mean += points[j];
+        }
+        mean /= Scalar( nearest.size() );
+        Math::Matrix3 covariance = Math::Matrix3::Zero();
+        for ( uint j : nearest )
+        {
+            const Math::Vector3 d = points[j] - mean;
+            covariance += d * d.transpose();
+        }
+        // The eigen values are sorted by increasing order.
+        Eigen::SelfAdjointEigenSolver<Math::Matrix3> solver;
+        solver.computeDirect( covariance );
+        normals[i] = solver.eigenvectors().col( 0 ).normalized();
+    }
+}
+
+void orientNormals( const PointKdTree& tree, const Container::Vector3Array& points, uint k,
+                    Container::Vector3Array& normals ) {
+    CORE_ASSERT( normals.size() == points.size(), "One normal per point expected." );
+    if ( points.empty() )
+    {
+        return;
+    }
+    std::vector<uint> offsets;
+    std::vector<uint> neighbors;
+    getNeighborGraph( tree, points, k, offsets, neighbors );
+
+    // Connected components, and the point of each one farthest from the center.
+    const Math::Vector3 center = meanPoint( points );
+    std::vector<int> component( points.size(), -1 );
+    std::vector<uint> seeds;
+    std::vector<uint> stack;
+    for ( uint i = 0; i < points.size(); ++i )
+    {
+        if ( component[i] >= 0 )
+        {
+            continue;
+        }
+        component[i] = seeds.size();
+        seeds.push_back( i );
+        stack.push_back( i );
+        while ( !stack.empty() )
+        {
+            const uint v = stack.back();
+            stack.pop_back();
+            if ( ( points[v] - center ).squaredNorm() >
+                 ( points[seeds.back()] - center ).squaredNorm() )
+            {
+                seeds.back() = v;
+            }
+            for ( uint j = offsets[v]; j < offsets[v + 1]; ++j )
+            {
+                if ( component[neighbors[j]] < 0 )
+                {
+                    component[neighbors[j]] = component[i];
+                    stack.push_back( neighbors[j] );
+                }
+            }
+        }
+    }
+
+    // Propagation along the minimum spanning tree of each component ( Prim ).
+    using Edge = std::tuple<Scalar, uint, uint>;
+    std::priority_queue<Edge, std::vector<Edge>, std::greater<Edge>> front;
+    std::vector<bool> visited( points.size(), false );
+    for ( uint seed : seeds )
+    {
+        if ( normals[seed].dot( points[seed] - center ) < 0 )
+        {
+            normals[seed] = -normals[seed];
+        }
+        front.emplace( Scalar( 0 ), seed, seed );
+        while ( !front.empty() )
+        {
+            uint from, to;
+            std::tie( std::ignore, from, to ) = front.top();
+            front.pop();
+            if ( visited[to] )
+            {
+                continue;
+            }
+            visited[to] = true;
+            if ( normals[to].dot( normals[from] ) < 0 )
+            {
+                normals[to] = -normals[to];
+            }
+            for ( uint j = offsets[to]; j < offsets[to + 1]; ++j )
+            {
+                const uint v = neighbors[j];
+                if ( !visited[v] )
+                {
+                    front.emplace( 1 - std::abs( normals[to].dot( normals[v] ) ), to, v );
+                }
+            }
+        }
+    }
+}
+
+void orientNormalsTowards( const Container::Vector3Array& points, const Math::Vector3& viewpoint,
+                           Container::Vector3Array& normals ) {
+    CORE_ASSERT( normals.size() == points.size(), "One normal per point expected." );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        if ( normals[i].dot( viewpoint - points[i] ) < 0 )
+        {
+            normals[i] = -normals[i];
+        }
+    }
+}
+
+void getStatisticalInliers( const PointKdTree& tree, const Container::Vector3Array& points,
+                            uint k, Scalar stdRatio, std::vector<uint>& inliers ) {
+    CORE_ASSERT( tree.size() == points.size(), "Tree not built on the points." );
+    inliers.clear();
+    if ( points.empty() )
+    {
+        return;
+    }
+    // The nearest neighbor of each point is itself.
+    std::vector<Scalar> meanDistances( points.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        std::vector<uint> nearest;
+        tree.getKNearest( points[i], k + 1, nearest );
+        Scalar sum = 0;
+        for ( uint j : nearest )
+        {
+            sum += ( points[j] - points[i] ).norm();
+        }
+        meanDistances[i] = nearest.size() > 1 ? sum / ( nearest.size() - 1 ) : 0;
+    }
+
+    const Scalar mean = std::accumulate( meanDistances.begin(), meanDistances.end(), Scalar( 0 ) ) /
+                        meanDistances.size();
+    Scalar variance = 0;
+    for ( Scalar d : meanDistances )
+    {
+        variance += ( d - mean ) * ( d - mean );
+    }
+    variance /= meanDistances.size();
+    const Scalar threshold = mean + stdRatio * std::sqrt( variance );
+    for ( uint i = 0; i < points.size(); ++i )
+    {
+        if ( meanDistances[i] <= threshold )
+        {
+            inliers.push_back( i );
+        }
+    }
+}
+
+void voxelDownsample( const Container::Vector3Array& points, Scalar voxelSize,
+                      Container::Vector3Array& downsampled, std::vector<uint>& pointCells ) {
+    CORE_ASSERT( voxelSize > 0, "Invalid voxel size." );
+    downsampled.clear();
+    pointCells.resize( points.size() );
+    if ( points.empty() )
+    {
+        return;
+    }
+
+    // Key of the voxel of each point, 21 bits per axis from the corner of the bounding box.
+    const Math::Vector3 origin = aabb( points ).min();
+    CORE_ASSERT( ( ( aabb( points ).max() - origin ) / voxelSize ).maxCoeff() < ( 1 << 21 ),
+                 "Too many voxels." );
+    std::vector<std::uint64_t> keys( points.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        const Eigen::Matrix<std::uint64_t, 3, 1> cell =
+            ( ( points[i] - origin ) / voxelSize ).array().floor().cast<std::uint64_t>();
+        keys[i] = ( cell.x() << 42 ) | ( cell.y() << 21 ) | cell.z();
+    }
+    std::vector<uint> order( points.size() );
+    std::iota( order.begin(), order.end(), 0 );
+    std::sort( order.begin(), order.end(), [&keys]( uint a, uint b ) {
+        return keys[a] < keys[b] || ( keys[a] == keys[b] && a < b );
+    } );
+
+    // Each voxel is a range of the sorted points.
+    std::vector<uint> offsets;
+    for ( uint i = 0; i < order.size(); ++i )
+    {
+        if ( i == 0 || keys[order[i]] != keys[order[i - 1]] )
+        {
+            offsets.push_back( i );
+        }
+    }
+    offsets.push_back( order.size() );
+    const int numCells = int( offsets.size() ) - 1;
+    downsampled.resize( numCells );
+#pragma omp parallel for
+    for ( int c = 0; c < numCells; ++c )
+    {
+        Math::Vector3 sum = Math::Vector3::Zero();
+        for ( uint i = offsets[c]; i < offsets[c + 1]; ++i )
+        {
+            sum += points[order[i]];
+            pointCells[order[i]] = c;
+        }
+        downsampled[c] = sum / Scalar( offsets[c + 1] - offsets[c] );
+    }
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
@@ -0,0 +1,55 @@
+#ifndef RADIUMENGINE_POINTCLOUDPROCESSING_HPP
+#define RADIUMENGINE_POINTCLOUDPROCESSING_HPP
+
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Geometry/PointKdTree.hpp>
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/RaCore.hpp>
+
+#include <vector>
+
+namespace Ra {
+namespace Core {
+/// This file contains the processing of scanned point clouds : normal estimation, outlier
+/// removal and downsampling. The tree arguments must be built on the points. The
+/// computations over the points run in parallel, one point per thread, and do not store the
+/// neighborhoods of all the points.
+namespace Geometry {
+
+/// Estimate the normal of each point as the direction of least variance of its k nearest
+/// neighbors, itself included. The normals are unit vectors, with an arbitrary sign.
+RA_CORE_API void estimateNormals( const PointKdTree& tree, const Container::Vector3Array& points,
+                                  uint k, Container::Vector3Array& normals );
+
+/// Flip the normals so that they are consistent between neighbors, by propagating the
+/// orientation along a minimum spanning tree of the k nearest neighbors graph, where the
+/// edges between points with parallel normals are the cheapest ( Hoppe et al. 1992 ).
+/// Each connected component starts from its point farthest from the center of the cloud,
+/// whose normal is flipped outwards.
+RA_CORE_API void orientNormals( const PointKdTree& tree, const Container::Vector3Array& points,
+                                uint k, Container::Vector3Array& normals );
+
+/// Flip the normals towards the viewpoint, e.g. the position of the scanner.
+RA_CORE_API void orientNormalsTowards( const Container::Vector3Array& points,
+                                       const Math::Vector3& viewpoint,
+                                       Container::Vector3Array& normals );
+
+/// Get the points whose mean distance to their k nearest neighbors is at most
+/// stdRatio standard deviations above the mean of these distances over the cloud, by
+/// increasing index.
+RA_CORE_API void getStatisticalInliers( const PointKdTree& tree,
+                                        const Container::Vector3Array& points, uint k,
+                                        Scalar stdRatio, std::vector<uint>& inliers );
+
+/// Replace the points in each cell of a regular grid by their mean. Point i of points is
+/// merged in point pointCells[i] of downsampled, so that the other attributes of the points
+/// can be averaged the same way.
+RA_CORE_API void voxelDownsample( const Container::Vector3Array& points, Scalar voxelSize,
+                                  Container::Vector3Array& downsampled,
+                                  std::vector<uint>& pointCells );
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_POINTCLOUDPROCESSING_HPP
@@ -0,0 +1,119 @@
+#include <Core/Geometry/PointHashGrid.hpp>
+
+#include <Core/Utils/Log.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+PointHashGrid::PointHashGrid( const Container::Vector3Array& points, Scalar cellSize ) {
+    build( points, cellSize );
+}
+
+Eigen::Vector3i PointHashGrid::getCell( const Math::Vector3& p ) const {
+    return ( p / m_cellSize ).array().floor().cast<int>();
+}
+
+uint PointHashGrid::getBucket( const Eigen::Vector3i& cell ) const {
+    const uint h = ( uint( cell.x() ) * 73856093u ) ^ ( uint( cell.y() ) * 19349663u ) ^
+                   ( uint( cell.z() ) * 83492791u );
+    return h % ( m_offsets.size() - 1 );
+}
+
+void PointHashGrid::build( const Container::Vector3Array& points, Scalar cellSize ) {
+    CORE_ASSERT( cellSize > 0, "Invalid cell size." );
+    m_cellSize = cellSize;
+    // About one point per bucket, the collisions being filtered by the distance test.
+    const uint numBuckets = std::max( uint( points.size() ), 1u );
+    m_offsets.assign( numBuckets + 1, 0 );
+    std::vector<uint> buckets( points.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        buckets[i] = getBucket( getCell( points[i] ) );
+    }
+
+    // Counting sort of the points by bucket.
+    for ( uint b : buckets )
+    {
+        ++m_offsets[b + 1];
+    }
+    for ( uint b = 0; b < numBuckets; ++b )
+    {
+        m_offsets[b + 1] += m_offsets[b];
+    }
+    std::vector<uint> next( m_offsets.begin(), m_offsets.end() - 1 );
+    m_points.resize( points.size() );
+    m_indices.resize( points.size() );
+    for ( uint i = 0; i < points.size(); ++i )
+    {
+        const uint j = next[buckets[i]]++;
+        m_points[j] = points[i];
+        m_indices[j] = i;
+    }
+}
+
+void PointHashGrid::getInRadius( const Math::Vector3& q, Scalar radius,
+                                 std::vector<uint>& indices ) const {
+    indices.clear();
+    if ( m_points.empty() )
+    {
+        return;
+    }
+    const Scalar radius2 = radius * radius;
+    const Eigen::Vector3i lo = getCell( q - Math::Vector3::Constant( radius ) );
+    const Eigen::Vector3i hi = getCell( q + Math::Vector3::Constant( radius ) );
+    // Several cells may share a bucket, which must be visited once.
+    std::vector<uint> visited;
+    for ( int x = lo.x(); x <= hi.x(); ++x )
+    {
+        for ( int y = lo.y(); y <= hi.y(); ++y )
+        {
+            for ( int z = lo.z(); z <= hi.z(); ++z )
+            {
+                const uint b = getBucket( Eigen::Vector3i( x, y, z ) );
+                if ( std::find( visited.begin(), visited.end(), b ) != visited.end() )
+                {
+                    continue;
+                }
+                visited.push_back( b );
+                for ( uint i = m_offsets[b]; i < m_offsets[b + 1]; ++i )
+                {
+                    if ( ( m_points[i] - q ).squaredNorm() <= radius2 )
+                    {
+                        indices.push_back( m_indices[i] );
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PointHashGrid::getInRadius( const Container::Vector3Array& queries, Scalar radius,
+                                 std::vector<uint>& offsets, std::vector<uint>& indices ) const {
+    std::vector<std::vector<uint>> neighbors( queries.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        getInRadius( queries[i], radius, neighbors[i] );
+    }
+    offsets.resize( queries.size() + 1 );
+    offsets[0] = 0;
+    for ( uint i = 0; i < queries.size(); ++i )
+    {
+        offsets[i + 1] = offsets[i] + neighbors[i].size();
+    }
+    indices.resize( offsets.back() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        std::copy( neighbors[i].begin(), neighbors[i].end(), indices.begin() + offsets[i] );
+    }
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
@@ -0,0 +1,56 @@
+#ifndef RADIUMENGINE_POINTHASHGRID_HPP
+#define RADIUMENGINE_POINTHASHGRID_HPP
+
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/RaCore.hpp>
+
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// Spatial hash of a set of points for the fixed radius queries.
+///
+/// The points are hashed by the cell of a regular grid they fall in, and sorted by bucket so
+/// that each bucket is a contiguous range. A radius query visits the cells overlapping the
+/// ball, which is cheaper than a PointKdTree when the radius is close to the cell size, e.g.
+/// for the neighborhoods of a uniformly sampled surface.
+class RA_CORE_API PointHashGrid {
+  public:
+    PointHashGrid() = default;
+    PointHashGrid( const Container::Vector3Array& points, Scalar cellSize );
+
+    /// Hash the points in cells of the given size.
+    void build( const Container::Vector3Array& points, Scalar cellSize );
+
+    uint size() const { return m_points.size(); }
+    Scalar getCellSize() const { return m_cellSize; }
+
+    /// Get the points at distance at most radius from q, in no particular order.
+    void getInRadius( const Math::Vector3& q, Scalar radius, std::vector<uint>& indices ) const;
+
+    /// Get the points at distance at most radius from each query, in parallel, the ones of
+    /// query i being indices[offsets[i]] to indices[offsets[i + 1] - 1].
+    void getInRadius( const Container::Vector3Array& queries, Scalar radius,
+                      std::vector<uint>& offsets, std::vector<uint>& indices ) const;
+
+  private:
+    Eigen::Vector3i getCell( const Math::Vector3& p ) const;
+    uint getBucket( const Eigen::Vector3i& cell ) const;
+
+  private:
+    Scalar m_cellSize{1};
+    /// The points of bucket b are m_points[m_offsets[b]] to m_points[m_offsets[b + 1] - 1].
+    std::vector<uint> m_offsets;
+    Container::Vector3Array m_points;
+    /// Index of each point in the input array.
+    std::vector<uint> m_indices;
+};
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_POINTHASHGRID_HPP
@@ -0,0 +1,357 @@
+#include <Core/Geometry/PointKdTree.hpp>
+
+#include <Core/Utils/Log.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+namespace {
+/// Ray with a unit direction, and its squared distance to the points.
+struct UnitRay {
+    explicit UnitRay( const Math::Ray& ray ) :
+        m_origin( ray.origin() ),
+        m_direction( ray.direction().normalized() ) {}
+
+    Scalar squaredDistance( const Math::Vector3& p, Scalar& t ) const {
+        t = std::max( Scalar( 0 ), ( p - m_origin ).dot( m_direction ) );
+        return ( m_origin + t * m_direction - p ).squaredNorm();
+    }
+
+    /// Returns true if the ray enters the box enlarged by radius, and sets tEntry to where it
+    /// does. The enlarged box contains all the points at distance at most radius from the box.
+    bool hits( const Math::Aabb& aabb, Scalar radius, Scalar& tEntry ) const {
+        Scalar tExit = std::numeric_limits<Scalar>::max();
+        tEntry = 0;
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const Scalar lo = aabb.min()[i] - radius;
+            const Scalar hi = aabb.max()[i] + radius;
+            if ( m_direction[i] == 0 )
+            {
+                if ( m_origin[i] < lo || m_origin[i] > hi )
+                {
+                    return false;
+                }
+            } else
+            {
+                const Scalar t1 = ( lo - m_origin[i] ) / m_direction[i];
+                const Scalar t2 = ( hi - m_origin[i] ) / m_direction[i];
+                tEntry = std::max( tEntry, std::min( t1, t2 ) );
+                tExit = std::min( tExit, std::max( t1, t2 ) );
+            }
+        }
+        return tEntry <= tExit;
+    }
+
+    Math::Vector3 m_origin;
+    Math::Vector3 m_direction;
+};
+} // namespace
+
+PointKdTree::PointKdTree( const Container::Vector3Array& points, uint leafSize ) {
+    build( points, leafSize );
+}
+
+void PointKdTree::build( const Container::Vector3Array& points, uint leafSize ) {
+    CORE_ASSERT( leafSize > 0, "Leaves must hold points." );
+    m_nodes.clear();
+    m_points.clear();
+    m_indices.resize( points.size() );
+    std::iota( m_indices.begin(), m_indices.end(), 0 );
+    if ( points.empty() )
+    {
+        return;
+    }
+
+    // Each level is split in parallel, the nodes holding disjoint ranges of m_indices.
+    m_nodes.push_back( Node{Math::Aabb(), 0, uint( points.size() )} );
+    uint levelBegin = 0;
+    while ( levelBegin < m_nodes.size() )
+    {
+        const int levelEnd = int( m_nodes.size() );
+#pragma omp parallel for
+        for ( int i = levelBegin; i < levelEnd; ++i )
+        {
+            Node& node = m_nodes[i];
+            node.m_aabb.setEmpty();
+            for ( uint j = node.m_first; j < node.m_first + node.m_count; ++j )
+            {
+                node.m_aabb.extend( points[m_indices[j]] );
+            }
+            if ( node.m_count > leafSize )
+            {
+                int axis;
+                node.m_aabb.sizes().maxCoeff( &axis );
+                auto begin = m_indices.begin() + node.m_first;
+                std::nth_element( begin, begin + node.m_count / 2, begin + node.m_count,
+                                  [&points, axis]( uint a, uint b ) {
+                                      return points[a][axis] < points[b][axis];
+                                  } );
+            }
+        }
+        for ( int i = levelBegin; i < levelEnd; ++i )
+        {
+            const uint first = m_nodes[i].m_first;
+            const uint count = m_nodes[i].m_count;
+            if ( count > leafSize )
+            {
+                m_nodes[i].m_first = m_nodes.size();
+                m_nodes[i].m_count = 0;
+                m_nodes.push_back( Node{Math::Aabb(), first, count / 2} );
+                m_nodes.push_back( Node{Math::Aabb(), first + count / 2, count - count / 2} );
+            }
+        }
+        levelBegin = levelEnd;
+    }
+
+    m_points.resize( points.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( points.size() ); ++i )
+    {
+        m_points[i] = points[m_indices[i]];
+    }
+}
+
+template <typename NodeKey, typename VisitLeaf>
+void PointKdTree::traverse( const NodeKey& nodeKey, const VisitLeaf& visitLeaf ) const {
+    if ( m_nodes.empty() )
+    {
+        return;
+    }
+    // The depth of the tree is at most the number of bits of the number of points.
+    uint stack[64];
+    uint size = 0;
+    stack[size++] = 0;
+    while ( size > 0 )
+    {
+        const Node& node = m_nodes[stack[--size]];
+        // The node is checked again since the visit of the previous leaves may prune it.
+        Scalar key;
+        if ( !nodeKey( node.m_aabb, key ) )
+        {
+            continue;
+        }
+        if ( node.m_count > 0 )
+        {
+            visitLeaf( node.m_first, node.m_first + node.m_count );
+            continue;
+        }
+        Scalar key0, key1;
+        const bool near0 = nodeKey( m_nodes[node.m_first].m_aabb, key0 );
+        const bool near1 = nodeKey( m_nodes[node.m_first + 1].m_aabb, key1 );
+        // The nearest child is pushed last to be visited first.
+        const uint nearest = key1 < key0 ? 1 : 0;
+        if ( ( nearest == 0 ? near1 : near0 ) )
+        {
+            stack[size++] = node.m_first + 1 - nearest;
+        }
+        if ( ( nearest == 0 ? near0 : near1 ) )
+        {
+            stack[size++] = node.m_first + nearest;
+        }
+    }
+}
+
+Container::Index PointKdTree::getNearest( const Math::Vector3& q ) const {
+    Container::Index nearest;
+    Scalar bestDistance = std::numeric_limits<Scalar>::max();
+    traverse(
+        [&]( const Math::Aabb& aabb, Scalar& key ) {
+            key = aabb.squaredExteriorDistance( q );
+            return key < bestDistance;
+        },
+        [&]( uint begin, uint end ) {
+            for ( uint i = begin; i < end; ++i )
+            {
+                const Scalar d = ( m_points[i] - q ).squaredNorm();
+                if ( d < bestDistance )
+                {
+                    bestDistance = d;
+                    nearest = m_indices[i];
+                }
+            }
+        } );
+    return nearest;
+}
+
+void PointKdTree::getKNearest( const Math::Vector3& q, uint k, std::vector<uint>& indices ) const {
+    indices.clear();
+    if ( k == 0 )
+    {
+        return;
+    }
+    // Max heap of the k nearest points found so far.
+    std::vector<std::pair<Scalar, uint>> heap;
+    heap.reserve( k );
+    traverse(
+        [&]( const Math::Aabb& aabb, Scalar& key ) {
+            key = aabb.squaredExteriorDistance( q );
+            return heap.size() < k || key < heap.front().first;
+        },
+        [&]( uint begin, uint end ) {
+            for ( uint i = begin; i < end; ++i )
+            {
+                const Scalar d = ( m_points[i] - q ).squaredNorm();
+                if ( heap.size() < k )
+                {
+                    heap.emplace_back( d, m_indices[i] );
+                    std::push_heap( heap.begin(), heap.end() );
+                } else if ( d < heap.front().first )
+                {
+                    std::pop_heap( heap.begin(), heap.end() );
+                    heap.back() = std::make_pair( d, m_indices[i] );
+                    std::push_heap( heap.begin(), heap.end() );
+                }
+            }
+        } );
+    std::sort_heap( heap.begin(), heap.end() );
+    indices.reserve( heap.size() );
+    for ( const auto& p : heap )
+    {
+        indices.push_back( p.second );
+    }
+}
+
+void PointKdTree::getInRadius( const Math::Vector3& q, Scalar radius,
+                               std::vector<uint>& indices ) const {
+    indices.clear();
+    const Scalar radius2 = radius * radius;
+    traverse(
+        [&]( const Math::Aabb& aabb, Scalar& key ) {
+            key = aabb.squaredExteriorDistance( q );
+            return key <= radius2;
+        },
+        [&]( uint begin, uint end ) {
+            for ( uint i = begin; i < end; ++i )
+            {
+                if ( ( m_points[i] - q ).squaredNorm() <= radius2 )
+                {
+                    indices.push_back( m_indices[i] );
+                }
+            }
+        } );
+}
+
+Container::Index PointKdTree::getClosestToRay( const Math::Ray& ray, Scalar maxDistance ) const {
+    const UnitRay unitRay( ray );
+    Container::Index closest;
+    Scalar bestDistance = maxDistance;
+    bool bounded = maxDistance < std::sqrt( std::numeric_limits<Scalar>::max() );
+    Scalar bestDistance2 = bounded ? maxDistance * maxDistance : maxDistance;
+    traverse(
+        [&]( const Math::Aabb& aabb, Scalar& key ) {
+            if ( !bounded )
+            {
+                // Nothing to prune yet, the boxes are ordered by the distance of their center.
+                Scalar t;
+                key = unitRay.squaredDistance( aabb.center(), t );
+                return true;
+            }
+            return unitRay.hits( aabb, bestDistance, key );
+        },
+        [&]( uint begin, uint end ) {
+            for ( uint i = begin; i < end; ++i )
+            {
+                Scalar t;
+                const Scalar d = unitRay.squaredDistance( m_points[i], t );
+                if ( d <= bestDistance2 )
+                {
+                    bestDistance2 = d;
+                    bestDistance = std::sqrt( d );
+                    bounded = true;
+                    closest = m_indices[i];
+                }
+            }
+        } );
+    return closest;
+}
+
+void PointKdTree::getNearRay( const Math::Ray& ray, Scalar radius,
+                              std::vector<uint>& indices ) const {
+    const UnitRay unitRay( ray );
+    const Scalar radius2 = radius * radius;
+    std::vector<std::pair<Scalar, uint>> hits;
+    traverse(
+        [&]( const Math::Aabb& aabb, Scalar& key ) { return unitRay.hits( aabb, radius, key ); },
+        [&]( uint begin, uint end ) {
+            for ( uint i = begin; i < end; ++i )
+            {
+                Scalar t;
+                if ( unitRay.squaredDistance( m_points[i], t ) <= radius2 )
+                {
+                    hits.emplace_back( t, m_indices[i] );
+                }
+            }
+        } );
+    std::sort( hits.begin(), hits.end() );
+    indices.clear();
+    indices.reserve( hits.size() );
+    for ( const auto& h : hits )
+    {
+        indices.push_back( h.second );
+    }
+}
+
+void PointKdTree::getNearest( const Container::Vector3Array& queries,
+                              std::vector<Container::Index>& indices ) const {
+    indices.resize( queries.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        indices[i] = getNearest( queries[i] );
+    }
+}
+
+void PointKdTree::getKNearest( const Container::Vector3Array& queries, uint k,
+                               std::vector<uint>& indices ) const {
+    CORE_ASSERT( k <= size(), "Not enough points for the queries." );
+    indices.resize( std::size_t( k ) * queries.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        std::vector<uint> nearest;
+        getKNearest( queries[i], k, nearest );
+        std::copy( nearest.begin(), nearest.end(), indices.begin() + std::size_t( k ) * i );
+    }
+}
+
+void PointKdTree::getInRadius( const Container::Vector3Array& queries, Scalar radius,
+                               std::vector<uint>& offsets, std::vector<uint>& indices ) const {
+    std::vector<std::vector<uint>> neighbors( queries.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        getInRadius( queries[i], radius, neighbors[i] );
+    }
+    offsets.resize( queries.size() + 1 );
+    offsets[0] = 0;
+    for ( uint i = 0; i < queries.size(); ++i )
+    {
+        offsets[i + 1] = offsets[i] + neighbors[i].size();
+    }
+    indices.resize( offsets.back() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( queries.size() ); ++i )
+    {
+        std::copy( neighbors[i].begin(), neighbors[i].end(), indices.begin() + offsets[i] );
+    }
+}
+
+void PointKdTree::getClosestToRay( const std::vector<Math::Ray>& rays, Scalar maxDistance,
+                                   std::vector<Container::Index>& indices ) const {
+    indices.resize( rays.size() );
+#pragma omp parallel for
+    for ( int i = 0; i < int( rays.size() ); ++i )
+    {
+        indices[i] = getClosestToRay( rays[i], maxDistance );
+    }
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
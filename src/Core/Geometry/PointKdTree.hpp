@@ -0,0 +1,108 @@
+#ifndef RADIUMENGINE_POINTKDTREE_HPP
+#define RADIUMENGINE_POINTKDTREE_HPP
+
+#include <Core/Container/Index.hpp>
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/Math/Ray.hpp>
+#include <Core/RaCore.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// Kd-tree for the nearest neighbors queries on a set of points, e.g. for picking, normal
+/// estimation or welding.
+///
+/// The tree is built in parallel, level by level, by splitting each node at the median of its
+/// largest extent. Each node keeps the bounding box of its points, and the points are stored
+/// in the order of the leaves, so that a leaf is a contiguous range. The queries return the
+/// indices of the points in the input array. The batch queries run in parallel, one query per
+/// thread.
+class RA_CORE_API PointKdTree {
+  public:
+    PointKdTree() = default;
+    explicit PointKdTree( const Container::Vector3Array& points, uint leafSize = 16 );
+
+    /// Build the tree of the points, the leaves having at most leafSize points.
+    void build( const Container::Vector3Array& points, uint leafSize = 16 );
+
+    uint size() const { return m_points.size(); }
+    bool empty() const { return m_points.empty(); }
+
+    /// \name Single queries
+    /// \{
+
+    /// Returns the point closest to q, invalid if the tree is empty.
+    Container::Index getNearest( const Math::Vector3& q ) const;
+
+    /// Get the k points closest to q, by increasing distance, or all the points if there are
+    /// less than k.
+    void getKNearest( const Math::Vector3& q, uint k, std::vector<uint>& indices ) const;
+
+    /// Get the points at distance at most radius from q, in no particular order.
+    void getInRadius( const Math::Vector3& q, Scalar radius, std::vector<uint>& indices ) const;
+
+    /// Returns the point closest to the ray, i.e. the half line starting at its origin, if it
+    /// is at distance at most maxDistance from the ray. Returns an invalid index otherwise.
+    Container::Index
+    getClosestToRay( const Math::Ray& ray,
+                     Scalar maxDistance = std::numeric_limits<Scalar>::max() ) const;
+
+    /// Get the points at distance at most radius from the ray, sorted along the ray.
+    void getNearRay( const Math::Ray& ray, Scalar radius, std::vector<uint>& indices ) const;
+    /// \}
+
+    /// \name Batch queries
+    /// \{
+
+    /// Get the point closest to each query.
+    void getNearest( const Container::Vector3Array& queries,
+                     std::vector<Container::Index>& indices ) const;
+
+    /// Get the k points closest to each query, the ones of query i being
+    /// indices[k * i] to indices[k * i + k - 1]. There must be at least k points.
+    void getKNearest( const Container::Vector3Array& queries, uint k,
+                      std::vector<uint>& indices ) const;
+
+    /// Get the points at distance at most radius from each query, the ones of query i being
+    /// indices[offsets[i]] to indices[offsets[i + 1] - 1].
+    void getInRadius( const Container::Vector3Array& queries, Scalar radius,
+                      std::vector<uint>& offsets, std::vector<uint>& indices ) const;
+
+    /// Get the point closest to each ray ( see getClosestToRay() ).
+    void getClosestToRay( const std::vector<Math::Ray>& rays, Scalar maxDistance,
+                          std::vector<Container::Index>& indices ) const;
+    /// \}
+
+  private:
+    /// A leaf holds the points m_first to m_first + m_count - 1, an inner node has m_count = 0
+    /// and its children are m_first and m_first + 1.
+    struct Node {
+        Math::Aabb m_aabb;
+        uint m_first;
+        uint m_count;
+    };
+
+    /// Visit the points [begin, end) of the leaves whose box is accepted by
+    /// nodeKey( aabb, key ), the smallest key first. The visit of a leaf may change what
+    /// nodeKey accepts.
+    template <typename NodeKey, typename VisitLeaf>
+    void traverse( const NodeKey& nodeKey, const VisitLeaf& visitLeaf ) const;
+
+  private:
+    std::vector<Node> m_nodes;
+    /// The points, in the order of the leaves.
+    Container::Vector3Array m_points;
+    /// Index of each point in the input array.
+    std::vector<uint> m_indices;
+};
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_POINTKDTREE_HPP
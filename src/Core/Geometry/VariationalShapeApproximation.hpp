@@ -23,6 +23,11 @@ enum class MetricType { L2, L21, LLOYD };
  *        The VariationalShapeApproximationBase class computes the K proxies describing
  *        a surface from a given triangle mesh.
  *
+ *        The face data are computed once, in separate arrays, and the face adjacency is
+ *        stored in a compressed array. The proxies are fitted in parallel, one region per
+ *        thread. The regions are grown either by the sequential flooding of the paper, from a
+ *        global priority queue, or in parallel by batches ( see set_batched_growing() ).
+ *
  * @note It is based on "Variational Shape Approximation" paper.
  * @warning It doesn't implement region teleporting or non-organic shape partitioning.
  */
@@ -41,21 +46,21 @@ class VariationalShapeApproximationBase {
     //////////////////////////////////////////////////////////////////////////////
     using Mesh = TriangleMesh; ///< Mesh class.
 
-    using FaceBarycenter = Container::Vector3Array;   ///< Face barycenters.
-    using FaceNormal = Container::Vector3Array;       ///< Face normals.
-    using FaceArea = std::vector<Scalar>;  ///< Face areas.
-    using FaceRegion = std::vector<uint>;  ///< Face region IDs.
-    using FaceVisited = std::vector<bool>; ///< Dirty bits
+    using FaceBarycenter = Container::Vector3Array; ///< Face barycenters.
+    using FaceNormal = Container::Vector3Array;     ///< Face normals.
+    using FaceArea = std::vector<Scalar>;           ///< Face areas.
+    using FaceRegion = std::vector<uint>;           ///< Face region IDs.
+    using FaceVisited = std::vector<bool>;          ///< Dirty bits
     using FaceValue = std::vector<Scalar>; ///< Face value containing the color value.
-    using FaceAdjacency = std::vector<std::set<TriangleIdx>>;
-
-    using Proxy = std::pair<Vector3, Vector3>;      ///< Proxy structure.
-    using ProxyList = std::array<Proxy, K>;         ///< List of proxies.
-    using Region = std::vector<TriangleIdx>;        ///< Region structure.
-    using RegionList = std::array<Region, K>;       ///< List of regions.
-    using Energy = Scalar;                          ///< Energy value.
-    using Pair = std::pair<TriangleIdx, uint>;      ///< Triangle-Proxy pair.
-    using QueueEntry = std::pair<Energy, Pair>;     ///< Queue entry. It contains < Energy, <T,P> >.
+    using FaceAdjacency = std::vector<TriangleIdx>; ///< Faces sharing a vertex, compressed.
+
+    using Proxy = std::pair<Math::Vector3, Math::Vector3>; ///< Proxy structure.
+    using ProxyList = std::array<Proxy, K>;                ///< List of proxies.
+    using Region = std::vector<TriangleIdx>;               ///< Region structure.
+    using RegionList = std::array<Region, K>;              ///< List of regions.
+    using Energy = Scalar;                                 ///< Energy value.
+    using Pair = std::pair<TriangleIdx, uint>;             ///< Triangle-Proxy pair.
+    using QueueEntry = std::pair<Energy, Pair>; ///< Queue entry. It contains < Energy, <T,P> >.
     using QueueEntryList = std::vector<QueueEntry>; ///< List of queue entries.
 
     using PriorityQueue =
@@ -78,7 +83,10 @@ class VariationalShapeApproximationBase {
     //////////////////////////////////////////////////////////////////////////////
     // INIT
     //////////////////////////////////////////////////////////////////////////////
-    inline void init();              ///< Initialize the data and set the seed triangles.
+    inline void init(); ///< Initialize the data and set the seed triangles.
+    inline void init( const FaceRegion& partition ); ///< Initialize the data and the regions
+                                                     ///< from the region ID of each face, e.g.
+                                                     ///< the partition() of a previous run.
     inline bool initialized() const; ///< Return true if init() was called. False otherwise.
 
     //////////////////////////////////////////////////////////////////////////////
@@ -91,16 +99,32 @@ class VariationalShapeApproximationBase {
     template <uint Iteration>
     inline void exec(); ///< Execute the algorithm performing the given amount of iterations.
 
+    inline uint exec( const uint iteration,
+                      const Scalar tolerance ); ///< Execute the algorithm performing at most the
+                                                ///< given amount of iterations, stopping when
+                                                ///< the energy decreases by less than tolerance
+                                                ///< times its value. Returns the number of
+                                                ///< iterations performed.
+
+    inline void set_batched_growing( const bool batched ); ///< Grow the regions in parallel, by
+                                                           ///< batches of faces.
+
     //////////////////////////////////////////////////////////////////////////////
     // REGION
     //////////////////////////////////////////////////////////////////////////////
     inline const Region& region( const uint i ) const; ///< Returns the i-th region.
+    inline const FaceRegion& partition() const;        ///< Returns the region ID of each face.
 
     //////////////////////////////////////////////////////////////////////////////
     // PROXY
     //////////////////////////////////////////////////////////////////////////////
     inline const Proxy& proxy( const uint i ) const; ///< Returns the i-th proxy.
 
+    //////////////////////////////////////////////////////////////////////////////
+    // ENERGY
+    //////////////////////////////////////////////////////////////////////////////
+    inline Energy energy() const; ///< Returns the energy of the faces for their proxy.
+
     //////////////////////////////////////////////////////////////////////////////
     // COLOR
     //////////////////////////////////////////////////////////////////////////////
@@ -124,6 +148,8 @@ class VariationalShapeApproximationBase {
     //////////////////////////////////////////////////////////////////////////////
     inline void
     geometry_partitioning(); ///< Performs the geometry partitioning with the current proxies.
+    inline void queue_growing(); ///< Grows the regions from their seed with a priority queue.
+    inline void batched_growing(); ///< Grows the regions from their seed by batches of faces.
     inline void add_neighbors_to_queue(
         const TriangleIdx& T,
         const uint proxy_id ); ///< Add the neighbors of T to the priority queue.
@@ -148,12 +174,15 @@ class VariationalShapeApproximationBase {
     FaceVisited m_fvisited;
     FaceValue m_fvalue;
     FaceAdjacency m_fadj;
+    std::vector<uint> m_fadj_offset; ///< The neighbors of face t are m_fadj[m_fadj_offset[t]]
+                                     ///< to m_fadj[m_fadj_offset[t + 1] - 1].
 
     PriorityQueue m_queue;
     RegionList m_region;
     ProxyList m_proxy;
 
     bool m_init;
+    bool m_batched;
 };
 
 //============================================================================
@@ -245,7 +274,7 @@ class VariationalShapeApproximation<K_Region, MetricType::L21>
 //============================================================================
 
 /**
- * @brief This is a specialized version of the VSA for the L21 metric.
+ * @brief This is a specialized version of the VSA for the Lloyd metric.
  */
 template <uint K_Region>
 class VariationalShapeApproximation<K_Region, MetricType::LLOYD>
@@ -271,14 +300,14 @@ class VariationalShapeApproximation<K_Region, MetricType::LLOYD>
     //////////////////////////////////////////////////////////////////////////////
     // PROXY FITTING
     //////////////////////////////////////////////////////////////////////////////
-    inline void proxy_fitting() override final; ///< Computes the Proxy fitting for the L21 metric.
+    inline void proxy_fitting() override final; ///< Computes the Proxy fitting for the Lloyd
+                                                ///< metric.
 
     //////////////////////////////////////////////////////////////////////////////
     // ENERGY
     //////////////////////////////////////////////////////////////////////////////
-    inline Scalar
-    E( const TriangleIdx& T,
-       const Proxy& P ) const override final; ///< Computes the energy function for the L21 metric.
+    inline Scalar E( const TriangleIdx& T, const Proxy& P ) const
+        override final; ///< Computes the energy function for the Lloyd metric.
 };
 
 //============================================================================
@@ -298,10 +327,10 @@ template <uint K_Region>
 using VSA_L21 = VariationalShapeApproximation<K_Region, MetricType::L21>;
 
 template <uint K_Region>
-using VSA_L21 = VariationalShapeApproximation<K_Region, MetricType::LLOYD>;
+using VSA_LLOYD = VariationalShapeApproximation<K_Region, MetricType::LLOYD>;
 
 } // namespace Geometry
 } // namespace Core
 } // namespace Ra
 
-#include <Core/Geometry/Approximation/VariationalShapeApproximation.inl>
+#include <Core/Geometry/VariationalShapeApproximation.inl>
@@ -1,8 +1,11 @@
-#include <Core/Geometry/Approximation/VariationalShapeApproximation.hpp>
+#include <Core/Geometry/VariationalShapeApproximation.hpp>
 
 #include <Core/Geometry/TriangleOperation.hpp>
 #include <Core/Utils/Log.hpp>
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <ctime>
+#include <limits>
 #include <random>
 #include <set>
 
@@ -20,7 +23,8 @@ inline VariationalShapeApproximationBase<K_Region>::VariationalShapeApproximatio
     m_queue(),
     m_region(),
     m_proxy(),
-    m_init( false ) {}
+    m_init( false ),
+    m_batched( false ) {}
 
 //////////////////////////////////////////////////////////////////////////////
 // DESTRUCTOR
@@ -38,6 +42,29 @@ inline void VariationalShapeApproximationBase<K_Region>::init() {
     this->m_init = true;
 }
 
+template <uint K_Region>
+inline void VariationalShapeApproximationBase<K_Region>::init( const FaceRegion& partition ) {
+    CORE_ASSERT( partition.size() == this->m_mesh.m_triangles.size(), "Wrong partition size" );
+    this->compute_data();
+    for ( uint i = 0; i < K; ++i )
+    {
+        this->m_region[i].clear();
+    }
+    for ( uint t = 0; t < partition.size(); ++t )
+    {
+        if ( partition[t] < K )
+        {
+            this->m_region[partition[t]].push_back( t );
+            this->m_fregion[t] = partition[t];
+        }
+    }
+    for ( uint i = 0; i < K; ++i )
+    {
+        CORE_ASSERT( !this->m_region[i].empty(), "Empty region in the partition" );
+    }
+    this->m_init = true;
+}
+
 template <uint K_Region>
 inline bool VariationalShapeApproximationBase<K_Region>::initialized() const {
     return m_init;
@@ -65,18 +92,39 @@ inline void VariationalShapeApproximationBase<K_Region>::exec( const uint iterat
 template <uint K_Region>
 template <uint Iteration>
 inline void VariationalShapeApproximationBase<K_Region>::exec() {
+    this->exec( Iteration );
+}
+
+template <uint K_Region>
+inline uint VariationalShapeApproximationBase<K_Region>::exec( const uint iteration,
+                                                               const Scalar tolerance ) {
     if ( !this->initialized() )
     {
         CORE_WARN_IF( false, "V.S.A. NOT INITIALIZED" );
-        return;
+        return 0;
     }
     LOG( Utils::logDEBUG ) << "Computing V.S.A. ...";
-    for ( uint i = 0; i < Iteration; ++i )
+    Energy previous = std::numeric_limits<Energy>::max();
+    uint i = 0;
+    while ( i < iteration )
     {
         this->proxy_fitting();
         this->geometry_partitioning();
+        ++i;
+        const Energy e = this->energy();
+        if ( previous - e <= tolerance * previous )
+        {
+            break;
+        }
+        previous = e;
     }
-    LOG( Utils::logDEBUG ) << "V.S.A. completed.";
+    LOG( Utils::logDEBUG ) << "V.S.A. completed in " << i << " iterations.";
+    return i;
+}
+
+template <uint K_Region>
+inline void VariationalShapeApproximationBase<K_Region>::set_batched_growing( const bool batched ) {
+    m_batched = batched;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -88,6 +136,12 @@ VariationalShapeApproximationBase<K_Region>::region( const uint i ) const {
     return m_region.at( i );
 }
 
+template <uint K_Region>
+inline const typename VariationalShapeApproximationBase<K_Region>::FaceRegion&
+VariationalShapeApproximationBase<K_Region>::partition() const {
+    return m_fregion;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // PROXY
 //////////////////////////////////////////////////////////////////////////////
@@ -97,6 +151,26 @@ VariationalShapeApproximationBase<K_Region>::proxy( const uint i ) const {
     return m_proxy.at( i );
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// ENERGY
+//////////////////////////////////////////////////////////////////////////////
+template <uint K_Region>
+inline typename VariationalShapeApproximationBase<K_Region>::Energy
+VariationalShapeApproximationBase<K_Region>::energy() const {
+    Energy e = 0;
+    const uint size = this->m_fregion.size();
+#pragma omp parallel for reduction( + : e )
+    for ( int t = 0; t < int( size ); ++t )
+    {
+        const uint R = this->m_fregion[t];
+        if ( R < K )
+        {
+            e += this->E( t, this->m_proxy[R] );
+        }
+    }
+    return e;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // COLOR
 //////////////////////////////////////////////////////////////////////////////
@@ -104,7 +178,7 @@ template <uint K_Region>
 inline void VariationalShapeApproximationBase<K_Region>::create_region_color() {
     for ( uint i = 0; i < K; ++i )
     {
-        const Scalar q = Scalar( i ) / static_cast<Scalar>( K - 1 );
+        const Scalar q = Scalar( i ) / static_cast<Scalar>( std::max( K - 1, 1u ) );
         for ( const auto& T : this->m_region[i] )
         {
             this->m_fvalue[T] = q;
@@ -134,7 +208,7 @@ inline void VariationalShapeApproximationBase<K_Region>::shuffle_regions() {
     {
         id[i] = i;
     }
-    std::random_shuffle( id.begin(), id.end() );
+    std::shuffle( id.begin(), id.end(), std::default_random_engine( time( 0 ) ) );
     for ( uint i = 0; i < K; ++i )
     {
         tmp_region[i] = this->m_region[id[i]];
@@ -157,41 +231,84 @@ inline void VariationalShapeApproximationBase<K_Region>::shuffle_regions() {
 template <uint K_Region>
 inline void VariationalShapeApproximationBase<K_Region>::compute_data() {
     const uint size = this->m_mesh.m_triangles.size();
+    const uint vsize = this->m_mesh.m_vertices.size();
     this->m_fbary.resize( size );
     this->m_fnormal.resize( size );
     this->m_farea.resize( size );
-    this->m_fregion.resize( size, -1 );
-    this->m_fvisited.resize( size, false );
-    this->m_fvalue.resize( 0 );
-    this->m_fadj.resize( size );
+    this->m_fregion.assign( size, uint( -1 ) );
+    this->m_fvisited.assign( size, false );
+    this->m_fvalue.assign( size, 0 );
 
-    std::vector<std::vector<TriangleIdx>> vadj( this->m_mesh.m_vertices.size() );
-    for ( uint t = 0; t < size; ++t )
+#pragma omp parallel for
+    for ( int t = 0; t < int( size ); ++t )
     {
         const Triangle& T = this->m_mesh.m_triangles[t];
-        const uint i = T[0];
-        const uint j = T[1];
-        const uint k = T[2];
-        const Math::Vector3 v[3] = {this->m_mesh.m_vertices[i], this->m_mesh.m_vertices[j],
-                              this->m_mesh.m_vertices[k]};
+        const Math::Vector3 v[3] = {this->m_mesh.m_vertices[T[0]], this->m_mesh.m_vertices[T[1]],
+                                    this->m_mesh.m_vertices[T[2]]};
         this->m_fbary[t] = triangleBarycenter( v[0], v[1], v[2] );
         this->m_fnormal[t] = triangleNormal( v[0], v[1], v[2] );
         this->m_farea[t] = triangleArea( v[0], v[1], v[2] );
-        vadj[i].push_back( t );
-        vadj[j].push_back( t );
-        vadj[k].push_back( t );
     }
 
-    for ( const auto& list : vadj )
+    // Faces of each vertex ( counting sort ).
+    std::vector<uint> voffset( vsize + 1, 0 );
+    for ( const auto& T : this->m_mesh.m_triangles )
     {
-        for ( uint i = 0; i < list.size(); ++i )
+        for ( uint i = 0; i < 3; ++i )
         {
-            for ( uint j = i + 1; j < list.size(); ++j )
+            ++voffset[T[i] + 1];
+        }
+    }
+    for ( uint v = 0; v < vsize; ++v )
+    {
+        voffset[v + 1] += voffset[v];
+    }
+    std::vector<uint> vadj( voffset[vsize] );
+    std::vector<uint> next( voffset.begin(), voffset.end() - 1 );
+    for ( uint t = 0; t < size; ++t )
+    {
+        for ( uint i = 0; i < 3; ++i )
+        {
+            vadj[next[this->m_mesh.m_triangles[t][i]]++] = t;
+        }
+    }
+
+    // Faces sharing a vertex with t, sorted.
+    auto neighbors = [this, &voffset, &vadj]( uint t, std::vector<uint>& list ) {
+        list.clear();
+        for ( uint i = 0; i < 3; ++i )
+        {
+            const uint v = this->m_mesh.m_triangles[t][i];
+            for ( uint j = voffset[v]; j < voffset[v + 1]; ++j )
             {
-                this->m_fadj[list[i]].insert( list[j] );
-                this->m_fadj[list[j]].insert( list[i] );
+                if ( vadj[j] != t )
+                {
+                    list.push_back( vadj[j] );
+                }
             }
         }
+        std::sort( list.begin(), list.end() );
+        list.erase( std::unique( list.begin(), list.end() ), list.end() );
+    };
+    this->m_fadj_offset.assign( size + 1, 0 );
+#pragma omp parallel for
+    for ( int t = 0; t < int( size ); ++t )
+    {
+        std::vector<uint> list;
+        neighbors( t, list );
+        this->m_fadj_offset[t + 1] = list.size();
+    }
+    for ( uint t = 0; t < size; ++t )
+    {
+        this->m_fadj_offset[t + 1] += this->m_fadj_offset[t];
+    }
+    this->m_fadj.resize( this->m_fadj_offset[size] );
+#pragma omp parallel for
+    for ( int t = 0; t < int( size ); ++t )
+    {
+        std::vector<uint> list;
+        neighbors( t, list );
+        std::copy( list.begin(), list.end(), this->m_fadj.begin() + this->m_fadj_offset[t] );
     }
 }
 
@@ -200,15 +317,17 @@ inline void VariationalShapeApproximationBase<K_Region>::compute_data() {
 //////////////////////////////////////////////////////////////////////////////
 template <uint K_Region>
 inline void VariationalShapeApproximationBase<K_Region>::compute_seed() {
-    std::set<TriangleIdx> t;
+    CORE_ASSERT( this->m_mesh.m_triangles.size() >= K, "Not enough triangles" );
+    std::set<uint> t;
     std::default_random_engine g( time( 0 ) );
-    std::uniform_int_distribution<TriangleIdx> rnd( 0, this->m_mesh.m_triangles.size() - 1 );
+    std::uniform_int_distribution<uint> rnd( 0, this->m_mesh.m_triangles.size() - 1 );
     while ( t.size() != K )
     {
         t.insert( rnd( g ) );
     }
     for ( uint i = 0; i < K; ++i )
     {
+        m_region[i].clear();
         m_region[i].push_back( *t.begin() );
         t.erase( t.begin() );
     }
@@ -220,20 +339,17 @@ inline void VariationalShapeApproximationBase<K_Region>::compute_seed() {
 template <uint K_Region>
 inline void VariationalShapeApproximationBase<K_Region>::geometry_partitioning() {
     // Reset the visited flag
-    for ( TriangleIdx T = 0; T < this->m_mesh.m_triangles.size(); ++T )
-    {
-        this->m_fvisited[T] = false;
-    }
-
-    // Force the queue to be empty
-    this->m_queue = PriorityQueue();
+    const uint size = this->m_mesh.m_triangles.size();
+    this->m_fvisited.assign( size, false );
 
     // Choose best triangle in each region
-    for ( uint i = 0; i < K; ++i )
+    std::array<TriangleIdx, K> seed;
+#pragma omp parallel for
+    for ( int i = 0; i < int( K ); ++i )
     {
-        assert( !this->m_region[i].empty() );
+        CORE_ASSERT( !this->m_region[i].empty(), "Empty region" );
         Energy min_e = std::numeric_limits<Energy>::max();
-        TriangleIdx T;
+        TriangleIdx T = this->m_region[i].front();
         for ( const auto& t : this->m_region[i] )
         {
             const Energy e = this->E( t, this->m_proxy[i] );
@@ -243,13 +359,34 @@ inline void VariationalShapeApproximationBase<K_Region>::geometry_partitioning()
                 T = t;
             }
         }
-        this->add_neighbors_to_queue( T, i );
+        seed[i] = T;
+    }
 
-        // Clear the region
+    // Clear the regions
+    for ( uint i = 0; i < K; ++i )
+    {
         this->m_region[i].clear();
-        this->m_region[i].push_back( T );
-        this->m_fregion[T] = i;
-        this->m_fvisited[T] = true;
+        this->m_region[i].push_back( seed[i] );
+        this->m_fregion[seed[i]] = i;
+        this->m_fvisited[seed[i]] = true;
+    }
+
+    if ( this->m_batched )
+    {
+        this->batched_growing();
+    } else
+    {
+        this->queue_growing();
+    }
+}
+
+template <uint K_Region>
+inline void VariationalShapeApproximationBase<K_Region>::queue_growing() {
+    // Force the queue to be empty
+    this->m_queue = PriorityQueue();
+    for ( uint i = 0; i < K; ++i )
+    {
+        this->add_neighbors_to_queue( this->m_region[i].front(), i );
     }
 
     // While the queue is not empty
@@ -271,12 +408,88 @@ inline void VariationalShapeApproximationBase<K_Region>::geometry_partitioning()
     }
 }
 
+template <uint K_Region>
+inline void VariationalShapeApproximationBase<K_Region>::batched_growing() {
+    // The faces next to the regions are evaluated in parallel for their best neighboring
+    // region, and the better half of them are added to their region at once. This keeps the
+    // order of the priority queue up to a batch, and each face is evaluated about twice.
+    const uint size = this->m_mesh.m_triangles.size();
+    std::vector<bool> in_front( size, false );
+    std::vector<uint> front;
+    auto add_neighbors_to_front = [this, &in_front, &front]( uint t ) {
+        for ( uint j = this->m_fadj_offset[t]; j < this->m_fadj_offset[t + 1]; ++j )
+        {
+            const uint r = this->m_fadj[j];
+            if ( !this->m_fvisited[r] && !in_front[r] )
+            {
+                in_front[r] = true;
+                front.push_back( r );
+            }
+        }
+    };
+    for ( uint i = 0; i < K; ++i )
+    {
+        add_neighbors_to_front( this->m_region[i].front() );
+    }
+
+    QueueEntryList batch;
+    while ( !front.empty() )
+    {
+        batch.resize( front.size() );
+#pragma omp parallel for
+        for ( int f = 0; f < int( front.size() ); ++f )
+        {
+            const uint t = front[f];
+            QueueEntry best( std::numeric_limits<Energy>::max(), Pair( t, K ) );
+            for ( uint j = this->m_fadj_offset[t]; j < this->m_fadj_offset[t + 1]; ++j )
+            {
+                const uint r = this->m_fadj[j];
+                if ( this->m_fvisited[r] )
+                {
+                    const uint R = this->m_fregion[r];
+                    const QueueEntry e( this->E( t, this->m_proxy[R] ), Pair( t, R ) );
+                    best = std::min( best, e );
+                }
+            }
+            batch[f] = best;
+        }
+
+        const auto nth = batch.begin() + ( batch.size() - 1 ) / 2;
+        std::nth_element( batch.begin(), nth, batch.end() );
+        const Energy threshold = nth->first;
+        front.clear();
+        for ( const auto& q : batch )
+        {
+            const uint t = q.second.first;
+            if ( q.first <= threshold )
+            {
+                const uint R = q.second.second;
+                this->m_region[R].push_back( t );
+                this->m_fregion[t] = R;
+                this->m_fvisited[t] = true;
+                in_front[t] = false;
+            } else
+            {
+                front.push_back( t );
+            }
+        }
+        for ( const auto& q : batch )
+        {
+            if ( q.first <= threshold )
+            {
+                add_neighbors_to_front( q.second.first );
+            }
+        }
+    }
+}
+
 template <uint K_Region>
 inline void
 VariationalShapeApproximationBase<K_Region>::add_neighbors_to_queue( const TriangleIdx& T,
                                                                      const uint proxy_id ) {
-    for ( const auto& r : this->m_fadj[T] )
+    for ( uint j = this->m_fadj_offset[T]; j < this->m_fadj_offset[T + 1]; ++j )
     {
+        const TriangleIdx r = this->m_fadj[j];
         this->m_queue.push(
             QueueEntry( this->E( r, this->m_proxy[proxy_id] ), Pair( r, proxy_id ) ) );
     }
@@ -298,26 +511,27 @@ VariationalShapeApproximation<K_Region, Type>::~VariationalShapeApproximation()
 template <uint K_Region, MetricType Type>
 inline void VariationalShapeApproximation<K_Region, Type>::proxy_fitting() {
     static const Scalar c = 2.0 / 72.0;
-    Matrix3 m;
+    Math::Matrix3 m;
     m << 10.0, 7.0, 0.0, 7.0, 10.0, 0.0, 0.0, 0.0, 0.0;
-    for ( uint i = 0; i < this->K; ++i )
+#pragma omp parallel for
+    for ( int i = 0; i < int( this->K ); ++i )
     {
 
         Scalar area_sum = 0;
-        this->m_proxy[i].first = Vector3::Zero();
-        Matrix3 Q = Matrix3::Zero();
+        this->m_proxy[i].first = Math::Vector3::Zero();
+        Math::Matrix3 Q = Math::Matrix3::Zero();
 
         for ( const auto& T : this->m_region[i] )
         {
             const Math::Vector3 v[3] = {this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][0]],
-                                  this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][1]],
-                                  this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][2]]};
+                                        this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][1]],
+                                        this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][2]]};
             const Math::Vector3& g = this->m_fbary[T];
 
-            Matrix3 M;
+            Math::Matrix3 M;
             M.row( 0 ) = v[1] - v[0];
             M.row( 1 ) = v[2] - v[0];
-            M.row( 2 ) = Vector3::Zero();
+            M.row( 2 ) = Math::Vector3::Zero();
 
             Q += ( c * this->m_farea[T] * M * m * M.transpose() ) +
                  ( this->m_farea[T] * g * g.transpose() );
@@ -327,8 +541,10 @@ inline void VariationalShapeApproximation<K_Region, Type>::proxy_fitting() {
         }
         this->m_proxy[i].first /= area_sum;
         Q -= area_sum * this->m_proxy[i].first * this->m_proxy[i].first.transpose();
-        this->m_proxy[i].second =
-            Eigen::SelfAdjointEigenSolver<Matrix3>( Q ).eigenvectors().col( 0 ).normalized();
+        this->m_proxy[i].second = Eigen::SelfAdjointEigenSolver<Math::Matrix3>( Q )
+                                      .eigenvectors()
+                                      .col( 0 )
+                                      .normalized();
     }
 }
 
@@ -340,8 +556,8 @@ inline Scalar VariationalShapeApproximation<K_Region, Type>::E( const TriangleId
                                                                 const Proxy& P ) const {
     static const Scalar c = 1.0 / 6.0;
     const Math::Vector3 v[3] = {this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][0]],
-                          this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][1]],
-                          this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][2]]};
+                                this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][1]],
+                                this->m_mesh.m_vertices[this->m_mesh.m_triangles[T][2]]};
     const Math::Vector3 p = P.first;
     const Math::Vector3 n = P.second;
     Scalar d[3];
@@ -369,11 +585,12 @@ VariationalShapeApproximation<K_Region, MetricType::L21>::~VariationalShapeAppro
 //////////////////////////////////////////////////////////////////////////////
 template <uint K_Region>
 inline void VariationalShapeApproximation<K_Region, MetricType::L21>::proxy_fitting() {
-    for ( uint i = 0; i < this->K; ++i )
+#pragma omp parallel for
+    for ( int i = 0; i < int( this->K ); ++i )
     {
         Scalar area_sum = 0;
-        this->m_proxy[i].first = Vector3::Zero();
-        this->m_proxy[i].second = Vector3::Zero();
+        this->m_proxy[i].first = Math::Vector3::Zero();
+        this->m_proxy[i].second = Math::Vector3::Zero();
         for ( const auto& T : this->m_region[i] )
         {
             this->m_proxy[i].first += this->m_farea[T] * this->m_fbary[T];
@@ -413,10 +630,11 @@ VariationalShapeApproximation<K_Region, MetricType::LLOYD>::~VariationalShapeApp
 //////////////////////////////////////////////////////////////////////////////
 template <uint K_Region>
 inline void VariationalShapeApproximation<K_Region, MetricType::LLOYD>::proxy_fitting() {
-    for ( uint i = 0; i < this->K; ++i )
+#pragma omp parallel for
+    for ( int i = 0; i < int( this->K ); ++i )
     {
-        this->m_proxy[i].first = Vector3::Zero();
-        this->m_proxy[i].second = Vector3::Zero();
+        this->m_proxy[i].first = Math::Vector3::Zero();
+        this->m_proxy[i].second = Math::Vector3::Zero();
         for ( const auto& T : this->m_region[i] )
         {
             this->m_proxy[i].first += this->m_fbary[T];
@@ -0,0 +1,196 @@
+#include <Core/Geometry/VertexNormals.hpp>
+
+#include <Core/Geometry/TriangleOperation.hpp>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+VertexNormals::VertexNormals( uint numVertices, const Container::VectorArray<Triangle>& T,
+                              Weighting weighting ) :
+    m_weighting( weighting ) {
+    setTopology( numVertices, T );
+}
+
+void VertexNormals::setTopology( uint numVertices, const Container::VectorArray<Triangle>& T ) {
+    std::vector<Container::Index> identity( numVertices );
+    for ( uint i = 0; i < numVertices; ++i )
+    {
+        identity[i] = i;
+    }
+    setTopology( numVertices, T, identity );
+}
+
+void VertexNormals::setTopology( uint numVertices, const Container::VectorArray<Triangle>& T,
+                                 const std::vector<Container::Index>& duplicateTable ) {
+    CORE_ASSERT( duplicateTable.size() == numVertices, "Wrong duplicate table size" );
+    m_representatives.resize( numVertices );
+    m_hasDuplicates = false;
+    for ( uint i = 0; i < numVertices; ++i )
+    {
+        m_representatives[i] = duplicateTable[i];
+        m_hasDuplicates = m_hasDuplicates || m_representatives[i] != i;
+    }
+
+    const uint numTriangles = T.size();
+    m_triangles.resize( numTriangles );
+#pragma omp parallel for
+    for ( int t = 0; t < int( numTriangles ); ++t )
+    {
+        for ( uint c = 0; c < 3; ++c )
+        {
+            m_triangles[t]( c ) = m_representatives[T[t]( c )];
+        }
+    }
+
+    // Corners of each vertex ( counting sort ), in the order of the triangles so that the
+    // sums do not depend on the number of threads.
+    m_offsets.assign( numVertices + 1, 0 );
+    for ( const auto& t : m_triangles )
+    {
+        for ( uint c = 0; c < 3; ++c )
+        {
+            ++m_offsets[t( c ) + 1];
+        }
+    }
+    for ( uint v = 0; v < numVertices; ++v )
+    {
+        m_offsets[v + 1] += m_offsets[v];
+    }
+    m_corners.resize( 3 * numTriangles );
+    std::vector<uint> next( m_offsets.begin(), m_offsets.end() - 1 );
+    for ( uint t = 0; t < numTriangles; ++t )
+    {
+        for ( uint c = 0; c < 3; ++c )
+        {
+            m_corners[next[m_triangles[t]( c )]++] = 3 * t + c;
+        }
+    }
+}
+
+Math::Vector3 VertexNormals::getCornerNormal( const Container::VectorArray<Math::Vector3>& p,
+                                              uint t, uint c ) const {
+    const Triangle& tri = m_triangles[t];
+    const Math::Vector3& pi = p[tri( c )];
+    const Math::Vector3& pj = p[tri( ( c + 1 ) % 3 )];
+    const Math::Vector3& pk = p[tri( ( c + 2 ) % 3 )];
+    const Math::Vector3 n = triangleNormal( pi, pj, pk );
+    switch ( m_weighting )
+    {
+    case WEIGHT_ANGLE:
+        return Math::Vector::angle( ( pj - pi ), ( pk - pi ) ) * n;
+    case WEIGHT_AREA:
+        return triangleArea( pi, pj, pk ) * n;
+    default:
+        return n;
+    }
+}
+
+template <typename CornerNormal>
+Math::Vector3 VertexNormals::gather( uint v, const CornerNormal& cornerNormal ) const {
+    Math::Vector3 normal = Math::Vector3::Zero();
+    for ( uint i = m_offsets[v]; i < m_offsets[v + 1]; ++i )
+    {
+        const Math::Vector3 n = cornerNormal( m_corners[i] );
+        // Degenerate triangles do not contribute.
+        if ( n.allFinite() )
+        {
+            normal += n;
+        }
+    }
+    if ( !normal.isApprox( Math::Vector3::Zero() ) )
+    {
+        normal.normalize();
+    }
+    return normal;
+}
+
+void VertexNormals::compute( const Container::VectorArray<Math::Vector3>& p,
+                             Container::VectorArray<Math::Vector3>& normals ) const {
+    const uint numVertices = m_representatives.size();
+    CORE_ASSERT( p.size() == numVertices, "Wrong number of vertices" );
+
+    // Weighted normals of the triangles, which only differ at their corners with the angle
+    // weighting.
+    const uint numTriangles = m_triangles.size();
+    const uint stride = m_weighting == WEIGHT_ANGLE ? 3 : 1;
+    Container::VectorArray<Math::Vector3> triangleNormals( stride * numTriangles );
+    switch ( m_weighting )
+    {
+    case WEIGHT_ANGLE:
+    {
+#pragma omp parallel for
+        for ( int t = 0; t < int( numTriangles ); ++t )
+        {
+            for ( uint c = 0; c < 3; ++c )
+            {
+                triangleNormals[3 * t + c] = getCornerNormal( p, t, c );
+            }
+        }
+        break;
+    }
+    case WEIGHT_AREA:
+    {
+#pragma omp parallel for
+        for ( int t = 0; t < int( numTriangles ); ++t )
+        {
+            // Twice the area times the unit normal, the factor 2 going away when normalizing.
+            const Triangle& tri = m_triangles[t];
+            triangleNormals[t] =
+                ( p[tri( 1 )] - p[tri( 0 )] ).cross( p[tri( 2 )] - p[tri( 0 )] );
+        }
+        break;
+    }
+    default:
+    {
+#pragma omp parallel for
+        for ( int t = 0; t < int( numTriangles ); ++t )
+        {
+            const Triangle& tri = m_triangles[t];
+            triangleNormals[t] = triangleNormal( p[tri( 0 )], p[tri( 1 )], p[tri( 2 )] );
+        }
+        break;
+    }
+    }
+
+    normals.resize( numVertices );
+    auto cornerNormal = [&triangleNormals, stride]( uint corner ) -> const Math::Vector3& {
+        return triangleNormals[stride == 3 ? corner : corner / 3];
+    };
+#pragma omp parallel for
+    for ( int v = 0; v < int( numVertices ); ++v )
+    {
+        if ( m_representatives[v] == uint( v ) )
+        {
+            normals[v] = gather( v, cornerNormal );
+        }
+    }
+    if ( m_hasDuplicates )
+    {
+#pragma omp parallel for
+        for ( int v = 0; v < int( numVertices ); ++v )
+        {
+            normals[v] = normals[m_representatives[v]];
+        }
+    }
+}
+
+void VertexNormals::compute( const Container::VectorArray<Math::Vector3>& p,
+                             const std::vector<uint>& vertices,
+                             Container::VectorArray<Math::Vector3>& normals ) const {
+    CORE_ASSERT( p.size() == m_representatives.size() && normals.size() == p.size(),
+                 "Wrong number of vertices" );
+    auto cornerNormal = [this, &p]( uint corner ) {
+        return getCornerNormal( p, corner / 3, corner % 3 );
+    };
+#pragma omp parallel for
+    for ( int i = 0; i < int( vertices.size() ); ++i )
+    {
+        const uint v = vertices[i];
+        normals[v] = gather( m_representatives[v], cornerNormal );
+    }
+}
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
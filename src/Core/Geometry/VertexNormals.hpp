@@ -0,0 +1,94 @@
+#ifndef RADIUMENGINE_VERTEXNORMALS_HPP
+#define RADIUMENGINE_VERTEXNORMALS_HPP
+
+#include <Core/Container/Index.hpp>
+#include <Core/Container/VectorArray.hpp>
+#include <Core/Geometry/MeshTypes.hpp>
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/RaCore.hpp>
+
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Geometry {
+
+/// Computation of the vertex normals of a mesh whose vertices move, e.g. when skinned,
+/// painted or smoothed.
+///
+/// The normal of a vertex is the normalized weighted sum of the normals of its triangles
+/// ( see uniformNormal(), angleWeightedNormal() and areaWeightedNormal() ). The triangles
+/// around each vertex are listed once for a topology, in a compressed ( CSR ) array. The
+/// normals are then computed in parallel and without write conflicts : each triangle
+/// computes its weighted normal at its corners, and each vertex sums the ones of its
+/// triangles. A subset of the vertices, e.g. the ones moved by a brush, can be updated
+/// alone.
+class RA_CORE_API VertexNormals {
+  public:
+    /// Weight of the normal of a triangle in the normal of its vertices.
+    enum Weighting : uint {
+        WEIGHT_UNIFORM = 0, ///< Same weight for all the triangles.
+        WEIGHT_ANGLE,       ///< Angle of the triangle at the vertex.
+        WEIGHT_AREA         ///< Area of the triangle.
+    };
+
+    VertexNormals() = default;
+    VertexNormals( uint numVertices, const Container::VectorArray<Triangle>& T,
+                   Weighting weighting = WEIGHT_UNIFORM );
+
+    /// Set the triangles around each vertex.
+    void setTopology( uint numVertices, const Container::VectorArray<Triangle>& T );
+
+    /// Set the triangles around each vertex, the vertices duplicated along seams ( see
+    /// findDuplicates() ) sharing the normal of their representative duplicateTable[i],
+    /// computed from the triangles of all its copies.
+    void setTopology( uint numVertices, const Container::VectorArray<Triangle>& T,
+                      const std::vector<Container::Index>& duplicateTable );
+
+    void setWeighting( Weighting weighting ) { m_weighting = weighting; }
+    Weighting getWeighting() const { return m_weighting; }
+
+    uint getNumVertices() const { return m_representatives.size(); }
+
+    /// Compute the normals of all the vertices for the positions \p p.
+    /// A vertex without triangle, or whose triangles are degenerate, gets a zero normal.
+    void compute( const Container::VectorArray<Math::Vector3>& p,
+                  Container::VectorArray<Math::Vector3>& normals ) const;
+
+    /// Update the normals of the given vertices only, for the positions \p p. The other
+    /// normals are left as they are. The copies of a duplicated vertex must all be in
+    /// \p vertices to stay equal.
+    void compute( const Container::VectorArray<Math::Vector3>& p,
+                  const std::vector<uint>& vertices,
+                  Container::VectorArray<Math::Vector3>& normals ) const;
+
+  private:
+    /// Weighted normal of the triangle t at its corner c.
+    Math::Vector3 getCornerNormal( const Container::VectorArray<Math::Vector3>& p, uint t,
+                                   uint c ) const;
+
+    /// Normalized sum of the corner normals of vertex v.
+    template <typename CornerNormal>
+    Math::Vector3 gather( uint v, const CornerNormal& cornerNormal ) const;
+
+  private:
+    Weighting m_weighting{WEIGHT_UNIFORM};
+
+    /// Triangles, with the vertices replaced by their representative.
+    Container::VectorArray<Triangle> m_triangles;
+
+    /// Representative of each vertex, itself when not duplicated.
+    std::vector<uint> m_representatives;
+    bool m_hasDuplicates{false};
+
+    /// The corners of vertex v are m_corners[m_offsets[v]] to m_corners[m_offsets[v + 1] - 1],
+    /// corner c of triangle t being 3 * t + c.
+    std::vector<uint> m_offsets;
+    std::vector<uint> m_corners;
+};
+
+} // namespace Geometry
+} // namespace Core
+} // namespace Ra
+
+#endif // RADIUMENGINE_VERTEXNORMALS_HPP
@@ -65,6 +65,10 @@ class Quadric {
     /// \deprecated Use constructor instead
     void compute( const Vector& n, double ndotp );
 
+    /// Evaluate the quadratic equation at v, e.g. the sum of the squared distances from v to the
+    /// planes the quadric has been built from.
+    inline Scalar evaluate( const Vector& v ) const;
+
     /// Computes eigen values and vectors of matrix A
     inline typename Eigen::EigenSolver<Matrix3>::EigenvalueType computeEigenValuesA();
     inline typename Eigen::EigenSolver<Matrix3>::EigenvectorsType computeEigenVectorsA();
@@ -56,6 +56,11 @@ inline void Quadric<DIM>::setC( const double& c ) {
     m_c = c;
 }
 
+template <int DIM>
+inline Scalar Quadric<DIM>::evaluate( const Vector& v ) const {
+    return v.dot( m_a * v ) + 2 * m_b.dot( v ) + Scalar( m_c );
+}
+
 template <int DIM>
 inline typename Eigen::EigenSolver<Matrix3>::EigenvalueType Quadric<DIM>::computeEigenValuesA() {
     typename Eigen::EigenSolver<Matrix3> es( m_a );
@@ -0,0 +1,94 @@
+#ifndef RADIUMENGINE_RAY_CAST_PACKET_HPP_
+#define RADIUMENGINE_RAY_CAST_PACKET_HPP_
+
+#include <Core/Math/LinearAlgebra.hpp>
+#include <Core/Math/Ray.hpp>
+#include <Core/RaCore.hpp>
+
+namespace Ra {
+namespace Core {
+namespace Math {
+
+/// Intersection of rays with N shapes at once, or of N rays with a shape.
+/// The packets store the coordinates in structure of arrays layout, as Eigen arrays of N
+/// lanes, so that the lanes are computed by the SIMD instructions enabled by the compiler,
+/// e.g. one SSE instruction for 4 floats. The functions do not allocate: they return the mask
+/// of the lanes that hit, bit i being lane i, and write the hit parameters of the lanes, the
+/// largest Scalar for the lanes that miss. As in RayCast, a ray starting inside a box hits at
+/// its origin ( t = 0 ).
+namespace RayCast {
+
+template <int N>
+using Lanes = Eigen::Array<Scalar, N, 1>;
+
+/// N rays.
+template <int N>
+struct RayPacket {
+    RA_CORE_ALIGNED_NEW
+
+    /// Set lane i to ray r.
+    inline void set( int i, const Ray& r );
+
+    Lanes<N> m_origin[3];
+    Lanes<N> m_direction[3];
+};
+
+/// N triangles, stored as a corner and the two edges from it.
+template <int N>
+struct TrianglePacket {
+    RA_CORE_ALIGNED_NEW
+
+    /// Set lane i to the triangle abc.
+    inline void set( int i, const Vector3& a, const Vector3& b, const Vector3& c );
+    /// Set all the lanes to degenerate triangles, which are never hit.
+    inline void setDegenerate();
+
+    Lanes<N> m_a[3];
+    Lanes<N> m_ab[3];
+    Lanes<N> m_ac[3];
+};
+
+/// N axis aligned boxes.
+template <int N>
+struct AabbPacket {
+    RA_CORE_ALIGNED_NEW
+
+    /// Set lane i to the box aabb.
+    inline void set( int i, const Aabb& aabb );
+    /// Set all the lanes to empty boxes, which are never hit.
+    inline void setEmpty();
+
+    Lanes<N> m_min[3];
+    Lanes<N> m_max[3];
+};
+
+/// Intersect a ray with N triangles.
+template <int N>
+inline uint vsTriangles( const Ray& r, const TrianglePacket<N>& triangles, Lanes<N>& hitsOut );
+
+/// Intersect a ray with N boxes.
+template <int N>
+inline uint vsAabbs( const Ray& r, const AabbPacket<N>& aabbs, Lanes<N>& hitsOut );
+
+/// Intersect N rays with the triangle abc.
+template <int N>
+inline uint vsTriangle( const RayPacket<N>& rays, const Vector3& a, const Vector3& b,
+                        const Vector3& c, Lanes<N>& hitsOut );
+
+/// Intersect N rays with a box.
+template <int N>
+inline uint vsAabb( const RayPacket<N>& rays, const Aabb& aabb, Lanes<N>& hitsOut );
+
+/// Intersect N rays with the infinite plane defined by point a and normal.
+template <int N>
+inline uint vsPlane( const RayPacket<N>& rays, const Vector3& a, const Vector3& normal,
+                     Lanes<N>& hitsOut );
+
+} // namespace RayCast
+} // namespace Math
+} // namespace Core
+} // namespace Ra
+
+#include <Core/Math/RayCastPacket.inl>
+
+#endif // RADIUMENGINE_RAY_CAST_PACKET_HPP_
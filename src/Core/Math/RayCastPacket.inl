@@ -0,0 +1,181 @@
+#include "RayCastPacket.hpp"
+
+#include <limits>
+
+namespace Ra {
+namespace Core {
+namespace Math {
+namespace RayCast {
+namespace PacketInternal {
+/// Returns the bit mask of the true lanes.
+template <int N, typename Mask>
+inline uint toBits( const Mask& mask ) {
+    uint bits = 0;
+    for ( int i = 0; i < N; ++i )
+    {
+        bits |= uint( mask[i] ) << i;
+    }
+    return bits;
+}
+
+/// Moller-Trumbore intersection of the lanes, without branches.
+template <int N>
+inline uint vsTriangles( const Lanes<N> o[3], const Lanes<N> d[3], const Lanes<N> a[3],
+                         const Lanes<N> ab[3], const Lanes<N> ac[3], Lanes<N>& hitsOut ) {
+    const Lanes<N> pvec[3] = {d[1] * ac[2] - d[2] * ac[1], d[2] * ac[0] - d[0] * ac[2],
+                              d[0] * ac[1] - d[1] * ac[0]};
+    const Lanes<N> det = ab[0] * pvec[0] + ab[1] * pvec[1] + ab[2] * pvec[2];
+    const Lanes<N> tvec[3] = {o[0] - a[0], o[1] - a[1], o[2] - a[2]};
+    const Lanes<N> qvec[3] = {tvec[1] * ab[2] - tvec[2] * ab[1], tvec[2] * ab[0] - tvec[0] * ab[2],
+                              tvec[0] * ab[1] - tvec[1] * ab[0]};
+    // The lanes parallel to their triangle get infinite or NaN parameters, and are rejected by
+    // the test of the determinant.
+    const Lanes<N> invDet = det.inverse();
+    const Lanes<N> u = ( tvec[0] * pvec[0] + tvec[1] * pvec[1] + tvec[2] * pvec[2] ) * invDet;
+    const Lanes<N> v = ( d[0] * qvec[0] + d[1] * qvec[1] + d[2] * qvec[2] ) * invDet;
+    const Lanes<N> t = ( ac[0] * qvec[0] + ac[1] * qvec[1] + ac[2] * qvec[2] ) * invDet;
+    // The conditions on the parameters are merged in a single comparison, which is cheaper
+    // than combining boolean lanes.
+    const Lanes<N> m = u.min( v ).min( Scalar( 1 ) - u - v ).min( t );
+    const auto hit = ( m >= Scalar( 0 ) ) && ( det != Scalar( 0 ) );
+    hitsOut = hit.select( t, std::numeric_limits<Scalar>::max() );
+    return toBits<N>( hit );
+}
+
+/// Slab intersection of the lanes, without branches.
+template <int N>
+inline uint vsAabbs( const Lanes<N> o[3], const Lanes<N> d[3], const Lanes<N> min[3],
+                     const Lanes<N> max[3], Lanes<N>& hitsOut ) {
+    Lanes<N> tNear = Lanes<N>::Zero();
+    Lanes<N> tFar = Lanes<N>::Constant( std::numeric_limits<Scalar>::max() );
+    for ( int i = 0; i < 3; ++i )
+    {
+        const Lanes<N> invD = d[i].inverse();
+        const Lanes<N> t1 = ( min[i] - o[i] ) * invD;
+        const Lanes<N> t2 = ( max[i] - o[i] ) * invD;
+        tNear = tNear.max( t1.min( t2 ) );
+        tFar = tFar.min( t1.max( t2 ) );
+    }
+    // The empty boxes are inverted, which the slabs would not detect. The conditions are
+    // merged in a single comparison, which is cheaper than combining boolean lanes.
+    const Lanes<N> m =
+        ( tFar - tNear ).min( max[0] - min[0] ).min( max[1] - min[1] ).min( max[2] - min[2] );
+    const auto hit = m >= Scalar( 0 );
+    hitsOut = hit.select( tNear, std::numeric_limits<Scalar>::max() );
+    return toBits<N>( hit );
+}
+
+/// Broadcast a vector to the lanes.
+template <int N>
+inline void broadcast( const Vector3& v, Lanes<N> lanes[3] ) {
+    for ( int i = 0; i < 3; ++i )
+    {
+        lanes[i] = Lanes<N>::Constant( v[i] );
+    }
+}
+} // namespace PacketInternal
+
+template <int N>
+inline void RayPacket<N>::set( int i, const Ray& r ) {
+    for ( int k = 0; k < 3; ++k )
+    {
+        m_origin[k][i] = r.origin()[k];
+        m_direction[k][i] = r.direction()[k];
+    }
+}
+
+template <int N>
+inline void TrianglePacket<N>::set( int i, const Vector3& a, const Vector3& b, const Vector3& c ) {
+    for ( int k = 0; k < 3; ++k )
+    {
+        m_a[k][i] = a[k];
+        m_ab[k][i] = b[k] - a[k];
+        m_ac[k][i] = c[k] - a[k];
+    }
+}
+
+template <int N>
+inline void TrianglePacket<N>::setDegenerate() {
+    for ( int k = 0; k < 3; ++k )
+    {
+        m_a[k].setZero();
+        m_ab[k].setZero();
+        m_ac[k].setZero();
+    }
+}
+
+template <int N>
+inline void AabbPacket<N>::set( int i, const Aabb& aabb ) {
+    for ( int k = 0; k < 3; ++k )
+    {
+        m_min[k][i] = aabb.min()[k];
+        m_max[k][i] = aabb.max()[k];
+    }
+}
+
+template <int N>
+inline void AabbPacket<N>::setEmpty() {
+    for ( int k = 0; k < 3; ++k )
+    {
+        m_min[k].setConstant( std::numeric_limits<Scalar>::max() );
+        m_max[k].setConstant( std::numeric_limits<Scalar>::lowest() );
+    }
+}
+
+template <int N>
+inline uint vsTriangles( const Ray& r, const TrianglePacket<N>& triangles, Lanes<N>& hitsOut ) {
+    Lanes<N> o[3], d[3];
+    PacketInternal::broadcast<N>( r.origin(), o );
+    PacketInternal::broadcast<N>( r.direction(), d );
+    return PacketInternal::vsTriangles<N>( o, d, triangles.m_a, triangles.m_ab, triangles.m_ac,
+                                           hitsOut );
+}
+
+template <int N>
+inline uint vsAabbs( const Ray& r, const AabbPacket<N>& aabbs, Lanes<N>& hitsOut ) {
+    Lanes<N> o[3], d[3];
+    PacketInternal::broadcast<N>( r.origin(), o );
+    PacketInternal::broadcast<N>( r.direction(), d );
+    return PacketInternal::vsAabbs<N>( o, d, aabbs.m_min, aabbs.m_max, hitsOut );
+}
+
+template <int N>
+inline uint vsTriangle( const RayPacket<N>& rays, const Vector3& a, const Vector3& b,
+                        const Vector3& c, Lanes<N>& hitsOut ) {
+    Lanes<N> la[3], lab[3], lac[3];
+    PacketInternal::broadcast<N>( a, la );
+    PacketInternal::broadcast<N>( b - a, lab );
+    PacketInternal::broadcast<N>( c - a, lac );
+    return PacketInternal::vsTriangles<N>( rays.m_origin, rays.m_direction, la, lab, lac,
+                                           hitsOut );
+}
+
+template <int N>
+inline uint vsAabb( const RayPacket<N>& rays, const Aabb& aabb, Lanes<N>& hitsOut ) {
+    Lanes<N> min[3], max[3];
+    PacketInternal::broadcast<N>( aabb.min(), min );
+    PacketInternal::broadcast<N>( aabb.max(), max );
+    return PacketInternal::vsAabbs<N>( rays.m_origin, rays.m_direction, min, max, hitsOut );
+}
+
+template <int N>
+inline uint vsPlane( const RayPacket<N>& rays, const Vector3& a, const Vector3& normal,
+                     Lanes<N>& hitsOut ) {
+    const Lanes<N>* o = rays.m_origin;
+    const Lanes<N>* d = rays.m_direction;
+    const Lanes<N> ddotn = d[0] * normal[0] + d[1] * normal[1] + d[2] * normal[2];
+    const Lanes<N> oadotn =
+        ( a[0] - o[0] ) * normal[0] + ( a[1] - o[1] ) * normal[1] + ( a[2] - o[2] ) * normal[2];
+    // As vsPlane, a ray in the plane hits at its origin.
+    const auto inPlane = ( ddotn == Scalar( 0 ) ) && ( oadotn == Scalar( 0 ) );
+    const auto crossing = ( ddotn != Scalar( 0 ) ) && ( ddotn * oadotn >= Scalar( 0 ) );
+    hitsOut = crossing.select( oadotn / ddotn,
+                               inPlane.select( Lanes<N>::Zero(),
+                                               std::numeric_limits<Scalar>::max() ) );
+    return PacketInternal::toBits<N>( inPlane || crossing );
+}
+
+} // namespace RayCast
+} // namespace Math
+} // namespace Core
+} // namespace Ra
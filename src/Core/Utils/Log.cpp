@@ -0,0 +1,323 @@
+#include <Core/Utils/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Ra {
+namespace Core {
+namespace Utils {
+
+namespace {
+
+struct LogMessage {
+    LogClock::time_point m_time;
+    uint64_t m_sequence;
+    TLogLevel m_level;
+    std::string m_text;
+};
+
+/// Single producer ( the owning thread ) single consumer ( the logging thread ) ring buffer.
+struct ThreadMessages {
+    static constexpr uint64_t Capacity = 1 << 12;
+
+    bool push( LogMessage&& message ) {
+        const uint64_t head = m_head.load( std::memory_order_relaxed );
+        if ( head - m_tail.load( std::memory_order_acquire ) >= Capacity )
+        {
+            m_dropped.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+        m_messages[head % Capacity] = std::move( message );
+        m_head.store( head + 1, std::memory_order_release );
+        return true;
+    }
+
+    /// Returns true if the buffer is more than half full.
+    bool isFilling() const {
+        return m_head.load( std::memory_order_relaxed ) - m_tail.load( std::memory_order_relaxed ) >
+               Capacity / 2;
+    }
+
+    void pop( std::vector<LogMessage>& messages ) {
+        const uint64_t tail = m_tail.load( std::memory_order_relaxed );
+        const uint64_t head = m_head.load( std::memory_order_acquire );
+        for ( uint64_t i = tail; i < head; ++i )
+        {
+            messages.push_back( std::move( m_messages[i % Capacity] ) );
+        }
+        m_tail.store( head, std::memory_order_release );
+    }
+
+    std::array<LogMessage, Capacity> m_messages;
+    std::atomic<uint64_t> m_head{0};
+    std::atomic<uint64_t> m_tail{0};
+    std::atomic<uint64_t> m_dropped{0};
+};
+
+/// Format the header of a message, as the previous synchronous logger did.
+std::string formatMessage( const LogMessage& message ) {
+    char time[100];
+    const std::time_t t = LogClock::to_time_t( message.m_time );
+    std::tm tm;
+#ifdef OS_WINDOWS
+    localtime_s( &tm, &t );
+#else
+    localtime_r( &t, &tm );
+#endif
+    std::strftime( time, 100, "%X", &tm );
+    std::string result = "- ";
+    result += time;
+    result += " " + FILELog::ToString( message.m_level ) + ": ";
+    result += std::string( message.m_level > logDEBUG ? message.m_level - logDEBUG : 0, '\t' );
+    result += message.m_text;
+    result += '\n';
+    return result;
+}
+
+/// Owns the ring buffers of all threads and the thread writing their messages.
+/// It is never destroyed, so that the messages logged during the destruction of the static
+/// objects are still written ( synchronously, see shutdown() ).
+class AsyncLogger {
+  public:
+    AsyncLogger() :
+        m_async( true ),
+        m_stop( false ),
+        m_sequence( 0 ),
+        m_reportedDropped( 0 ),
+        m_thread( &AsyncLogger::run, this ) {}
+
+    ThreadMessages* registerThread() {
+        std::lock_guard<std::mutex> lock( m_threadsMutex );
+        m_threads.emplace_back( new ThreadMessages );
+        return m_threads.back().get();
+    }
+
+    void output( ThreadMessages& queue, TLogLevel level, const LogClock::time_point& time,
+                 std::string&& text ) {
+        LogMessage message{time, m_sequence.fetch_add( 1, std::memory_order_relaxed ), level,
+                           std::move( text )};
+        if ( !m_async.load( std::memory_order_acquire ) )
+        {
+            write( formatMessage( message ) );
+            return;
+        }
+        if ( queue.push( std::move( message ) ) && ( level <= logWARNING || queue.isFilling() ) )
+        {
+            m_wakeUp.notify_one();
+        }
+    }
+
+    /// Write all the queued messages, in the order they were logged.
+    void drain() {
+        std::lock_guard<std::mutex> drainLock( m_drainMutex );
+        m_pending.clear();
+        uint64_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock( m_threadsMutex );
+            for ( auto& thread : m_threads )
+            {
+                thread->pop( m_pending );
+                dropped += thread->m_dropped.load( std::memory_order_relaxed );
+            }
+        }
+        if ( m_pending.empty() && dropped == m_reportedDropped )
+        {
+            return;
+        }
+        std::sort( m_pending.begin(), m_pending.end(),
+                   []( const LogMessage& a, const LogMessage& b ) {
+                       return a.m_sequence < b.m_sequence;
+                   } );
+
+        std::string text;
+        for ( const auto& message : m_pending )
+        {
+            text += formatMessage( message );
+        }
+        if ( dropped != m_reportedDropped )
+        {
+            text += formatMessage( {LogClock::now(), 0, logWARNING,
+                                    std::to_string( dropped - m_reportedDropped ) +
+                                        " log messages were dropped."} );
+            m_reportedDropped = dropped;
+        }
+        write( text );
+    }
+
+    void setAsynchronous( bool async ) {
+        std::lock_guard<std::mutex> lock( m_stateMutex );
+        if ( m_stop )
+        {
+            return;
+        }
+        m_async.store( async, std::memory_order_release );
+        drain();
+    }
+
+    bool isAsynchronous() const { return m_async.load( std::memory_order_acquire ); }
+
+    /// Stop the logging thread, and write the next messages synchronously.
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock( m_stateMutex );
+            m_stop = true;
+            m_async.store( false, std::memory_order_release );
+        }
+        m_wakeUp.notify_one();
+        m_thread.join();
+        drain();
+    }
+
+    uint64_t getNumDroppedMessages() {
+        std::lock_guard<std::mutex> lock( m_threadsMutex );
+        uint64_t dropped = 0;
+        for ( const auto& thread : m_threads )
+        {
+            dropped += thread->m_dropped.load( std::memory_order_relaxed );
+        }
+        return dropped;
+    }
+
+  private:
+    void run() {
+        std::unique_lock<std::mutex> lock( m_stateMutex );
+        while ( !m_stop )
+        {
+            m_wakeUp.wait_for( lock, std::chrono::milliseconds( 10 ) );
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    }
+
+    void write( const std::string& text ) {
+        std::lock_guard<std::mutex> lock( m_writeMutex );
+        FILE* stream = Output2FILE::Stream();
+        if ( stream != nullptr )
+        {
+            fputs( text.c_str(), stream );
+            fflush( stream );
+        }
+    }
+
+    std::atomic<bool> m_async;
+    bool m_stop;
+    std::atomic<uint64_t> m_sequence;
+
+    std::mutex m_threadsMutex;
+    std::vector<std::unique_ptr<ThreadMessages>> m_threads;
+
+    std::mutex m_drainMutex;
+    std::vector<LogMessage> m_pending;
+    uint64_t m_reportedDropped;
+
+    std::mutex m_writeMutex;
+    std::mutex m_stateMutex;
+    std::condition_variable m_wakeUp;
+    std::thread m_thread;
+};
+
+AsyncLogger& getLogger();
+
+/// Flushes the messages and stops the logging thread at exit.
+struct LoggerShutdown {
+    ~LoggerShutdown() { getLogger().shutdown(); }
+};
+
+AsyncLogger& getLogger() {
+    static AsyncLogger* logger = new AsyncLogger;
+    // Destroyed before the static objects constructed before the first message, whose
+    // destructors may still log : their messages are then written synchronously.
+    static LoggerShutdown shutdown;
+    return *logger;
+}
+
+ThreadMessages& getThreadMessages() {
+    thread_local ThreadMessages* messages = getLogger().registerThread();
+    return *messages;
+}
+
+/// Streams of the calling thread, one per nested message ( a message can be logged while
+/// building another one ).
+struct ThreadStreams {
+    std::vector<std::unique_ptr<std::ostringstream>> m_streams;
+    uint m_depth{0};
+};
+
+// A pointer, which is still usable by the destructors of the static objects after the
+// destruction of the thread_local objects of the main thread.
+thread_local ThreadStreams* threadStreams = nullptr;
+
+struct ThreadStreamsDeleter {
+    ~ThreadStreamsDeleter() {
+        delete threadStreams;
+        threadStreams = nullptr;
+    }
+};
+
+thread_local ThreadStreamsDeleter threadStreamsDeleter;
+
+ThreadStreams& getThreadStreams() {
+    if ( threadStreams == nullptr )
+    {
+        // Leaked if created after the destruction of threadStreamsDeleter.
+        threadStreams = new ThreadStreams;
+        (void)threadStreamsDeleter;
+    }
+    return *threadStreams;
+}
+
+} // namespace
+
+std::ostringstream& acquireLogStream() {
+    ThreadStreams& streams = getThreadStreams();
+    if ( streams.m_depth == streams.m_streams.size() )
+    {
+        streams.m_streams.emplace_back( new std::ostringstream );
+    }
+    std::ostringstream& stream = *streams.m_streams[streams.m_depth++];
+    stream.str( std::string() );
+    stream.clear();
+    return stream;
+}
+
+void releaseLogStream() {
+    ThreadStreams& streams = getThreadStreams();
+    CORE_ASSERT( streams.m_depth > 0, "Unbalanced log streams." );
+    --streams.m_depth;
+}
+
+FILE*& Output2FILE::Stream() {
+    static FILE* pStream = stderr;
+    return pStream;
+}
+
+void Output2FILE::Output( TLogLevel level, const LogClock::time_point& time, std::string&& msg ) {
+    getLogger().output( getThreadMessages(), level, time, std::move( msg ) );
+}
+
+void Output2FILE::SetAsynchronous( bool async ) {
+    getLogger().setAsynchronous( async );
+}
+
+bool Output2FILE::IsAsynchronous() {
+    return getLogger().isAsynchronous();
+}
+
+void Output2FILE::Flush() {
+    getLogger().drain();
+}
+
+uint64_t Output2FILE::GetNumDroppedMessages() {
+    return getLogger().getNumDroppedMessages();
+}
+
+} // namespace Utils
+} // namespace Core
+} // namespace Ra
@@ -2,6 +2,8 @@
 #define RADIUMENGINE_LOG_HPP
 
 #include <Core/RaCore.hpp>
+#include <atomic>
+#include <chrono>
 #include <sstream>
 #include <stdio.h>
 #include <string>
@@ -12,7 +14,8 @@ namespace Ra {
 namespace Core {
 namespace Utils {
 
-inline std::string NowTime();
+/// Wall clock of the log messages timestamps.
+using LogClock = std::chrono::system_clock;
 
 enum TLogLevel {
     logERROR,
@@ -25,6 +28,16 @@ enum TLogLevel {
     logDEBUG4
 };
 
+/// Return a cleared string stream of the calling thread, to build a message without
+/// allocating a new stream. Must be paired with releaseLogStream().
+RA_CORE_API std::ostringstream& acquireLogStream();
+RA_CORE_API void releaseLogStream();
+
+/**
+ * A log message, built with Get() and handed to T::Output() on destruction.
+ * Only the body of the message is formatted by the calling thread, the header ( time and
+ * level ) is formatted by T.
+ */
 template <typename T>
 class Log {
   public:
@@ -38,7 +51,9 @@ class Log {
     static TLogLevel FromString( const std::string& level );
 
   protected:
-    std::ostringstream os;
+    std::ostringstream& os;
+    TLogLevel m_level;
+    LogClock::time_point m_time;
 
   private:
     Log( const Log& );
@@ -46,20 +61,19 @@ class Log {
 };
 
 template <typename T>
-Log<T>::Log() {}
+Log<T>::Log() : os( acquireLogStream() ), m_level( logINFO ) {}
 
 template <typename T>
 std::ostringstream& Log<T>::Get( TLogLevel level ) {
-    os << "- " << NowTime();
-    os << " " << ToString( level ) << ": ";
-    os << std::string( level > logDEBUG ? level - logDEBUG : 0, '\t' );
+    m_level = level;
+    m_time = LogClock::now();
     return os;
 }
 
 template <typename T>
 Log<T>::~Log() {
-    os << std::endl;
-    T::Output( os.str() );
+    T::Output( m_level, m_time, os.str() );
+    releaseLogStream();
 }
 
 template <typename T>
@@ -114,35 +128,76 @@ TLogLevel Log<T>::FromString( const std::string& level ) {
     return logINFO;
 }
 
-class Output2FILE {
+/**
+ * Writes the log messages to a FILE*.
+ * By default, the messages are queued in a lock-free ring buffer of the calling thread and
+ * written by a background thread, so that logging never blocks. When a ring buffer is full,
+ * the messages are dropped and counted. Errors and warnings wake the background thread up
+ * immediately, the other messages are written within a few milliseconds.
+ */
+class RA_CORE_API Output2FILE {
   public:
+    /// The file messages are written to, stderr by default. Call Flush() before changing it.
     static FILE*& Stream();
-    static void Output( const std::string& msg );
-};
 
-inline FILE*& Output2FILE::Stream() {
-    static FILE* pStream = stderr;
-    return pStream;
-}
+    static void Output( TLogLevel level, const LogClock::time_point& time, std::string&& msg );
 
-inline void Output2FILE::Output( const std::string& msg ) {
-    FILE* pStream = Stream();
-    if ( !pStream )
-    {
-        return;
-    }
-    fprintf( pStream, "%s", msg.c_str() );
-    fflush( pStream );
-}
+    /// If false, messages are written by the calling thread, e.g. to debug a crash.
+    static void SetAsynchronous( bool async );
+    static bool IsAsynchronous();
+
+    /// Write all the queued messages before returning.
+    static void Flush();
+
+    /// Number of messages dropped because of full ring buffers since the beginning.
+    static uint64_t GetNumDroppedMessages();
+};
 
 class FILELog : public Log<Output2FILE> {};
 // using FILELog = Log<Output2FILE>;
 
+/// Lets at most a given number of messages through per second, see LOG_RATE_LIMITED.
+class LogRateLimiter {
+  public:
+    explicit LogRateLimiter( uint maxPerSecond ) :
+        m_maxPerSecond( maxPerSecond ),
+        m_second( 0 ),
+        m_count( 0 ),
+        m_suppressed( 0 ) {}
+
+    bool allow() {
+        const int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch() )
+                                   .count();
+        int64_t current = m_second.load( std::memory_order_relaxed );
+        if ( second != current && m_second.compare_exchange_strong( current, second ) )
+        {
+            m_count.store( 0, std::memory_order_relaxed );
+        }
+        if ( m_count.fetch_add( 1, std::memory_order_relaxed ) < m_maxPerSecond )
+        {
+            return true;
+        }
+        m_suppressed.fetch_add( 1, std::memory_order_relaxed );
+        return false;
+    }
+
+    /// Number of messages suppressed since the beginning.
+    uint64_t getNumSuppressed() const { return m_suppressed.load( std::memory_order_relaxed ); }
+
+  private:
+    const uint m_maxPerSecond;
+    std::atomic<int64_t> m_second;
+    std::atomic<uint> m_count;
+    std::atomic<uint64_t> m_suppressed;
+};
+
 } // namespace Utils
 } // namespace Core
 } // namespace Ra
 
 
+// Messages above FILELOG_MAX_LEVEL are removed at compile time ( see RADIUM_LOG_MAX_LEVEL ).
 #ifndef FILELOG_MAX_LEVEL
 #    ifdef CORE_DEBUG
 #        define FILELOG_MAX_LEVEL Ra::Core::Utils::logDEBUG4
@@ -161,26 +216,21 @@ class FILELog : public Log<Output2FILE> {};
 
 #define LOG( level ) FILE_LOG( level )
 
-#include <ctime>
-
-namespace Ra { 
-namespace Core {
-namespace Utils {
-
-inline std::string NowTime() {
-    char buffer[100];
-    std::time_t t = std::time( nullptr );
-    ON_ASSERT( int ok = ) std::strftime( buffer, 100, "%X", std::localtime( &t ) );
-    CORE_ASSERT( ok, "Increase buffer size." );
-    std::string result( buffer );
-    // This doesn't work with minGW. Maybe indicates a serious issue ?
-    // Ra::Core::Utils::stringPrintf( result, "%s", buffer );
-    return result;
-}
-
-} // namespace Utils
-} // namespace Core
-} // namespace Ra
-
+/// Same as LOG, but lets at most maxPerSecond ( a constant ) messages of this call site
+/// through per second, for logs in hot code.
+#define LOG_RATE_LIMITED( level, maxPerSecond )                                                \
+    if ( level > FILELOG_MAX_LEVEL )                                                           \
+        ;                                                                                      \
+    else if ( level > Ra::Core::Utils::FILELog::ReportingLevel() ||                            \
+              !Ra::Core::Utils::Output2FILE::Stream() )                                        \
+        ;                                                                                      \
+    else if ( ![]() -> Ra::Core::Utils::LogRateLimiter& {                                      \
+                  static Ra::Core::Utils::LogRateLimiter limiter( maxPerSecond );              \
+                  return limiter;                                                              \
+              }()                                                                              \
+                   .allow() )                                                                  \
+        ;                                                                                      \
+    else                                                                                       \
+        Ra::Core::Utils::FILELog().Get( level )
 
 #endif // RADIUMENGINE_LOG_HPP
@@ -0,0 +1,233 @@
+#include <Core/Utils/Profiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace Ra {
+namespace Core {
+namespace Utils {
+
+namespace {
+
+/// Single producer ( the owning thread ) single consumer ( collect() ) ring buffer of zones.
+struct ThreadZones {
+    static constexpr uint64_t Capacity = 1 << 13;
+
+    explicit ThreadZones( uint threadId ) : m_threadId( threadId ) {}
+
+    void push( const char* name, const TimePoint& start, const TimePoint& end ) {
+        const uint64_t head = m_head.load( std::memory_order_relaxed );
+        if ( head - m_tail.load( std::memory_order_acquire ) >= Capacity )
+        {
+            m_dropped.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+        m_zones[head % Capacity] = {name, start, end, m_threadId};
+        m_head.store( head + 1, std::memory_order_release );
+    }
+
+    void pop( std::vector<ProfileZone>& zones ) {
+        const uint64_t tail = m_tail.load( std::memory_order_relaxed );
+        const uint64_t head = m_head.load( std::memory_order_acquire );
+        for ( uint64_t i = tail; i < head; ++i )
+        {
+            zones.push_back( m_zones[i % Capacity] );
+        }
+        m_tail.store( head, std::memory_order_release );
+    }
+
+    std::array<ProfileZone, Capacity> m_zones;
+    std::atomic<uint64_t> m_head{0};
+    std::atomic<uint64_t> m_tail{0};
+    std::atomic<uint64_t> m_dropped{0};
+    uint m_threadId;
+    std::string m_name;
+};
+
+/// Registry of the ring buffers of all threads. Buffers are never released, so that zones
+/// recorded by a thread can be collected after its termination.
+struct ZoneRegistry {
+    ZoneRegistry() : m_startTime( Clock::now() ) {
+        m_threads.emplace_back( new ThreadZones( Profiler::GpuThreadId ) );
+        m_threads.back()->m_name = "GPU";
+    }
+
+    ThreadZones* registerThread() {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_threads.emplace_back( new ThreadZones( uint( m_threads.size() ) ) );
+        return m_threads.back().get();
+    }
+
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadZones>> m_threads;
+    // GPU zones may be recorded from any thread with an OpenGL context.
+    std::mutex m_gpuMutex;
+    std::unordered_set<std::string> m_internedStrings;
+    TimePoint m_startTime;
+};
+
+/// Escape the characters which cannot appear as is in a JSON string.
+std::string escapeJson( const char* str ) {
+    std::string escaped;
+    for ( const char* c = str; *c != '\0'; ++c )
+    {
+        if ( *c == '"' || *c == '\\' )
+        {
+            escaped += '\\';
+        }
+        escaped += *c;
+    }
+    return escaped;
+}
+
+ZoneRegistry& getRegistry() {
+    static ZoneRegistry registry;
+    return registry;
+}
+
+ThreadZones& getThreadZones() {
+    thread_local ThreadZones* zones = getRegistry().registerThread();
+    return *zones;
+}
+
+} // namespace
+
+std::atomic<bool> Profiler::s_enabled( false );
+
+void Profiler::setEnabled( bool enabled ) {
+    // Make sure the start time is set before recording the first zone.
+    getRegistry();
+    s_enabled.store( enabled );
+}
+
+void Profiler::recordZone( const char* name, const TimePoint& start, const TimePoint& end ) {
+    getThreadZones().push( name, start, end );
+}
+
+void Profiler::recordGpuZone( const char* name, const TimePoint& start, const TimePoint& end ) {
+    ZoneRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_gpuMutex );
+    registry.m_threads[GpuThreadId]->push( name, start, end );
+}
+
+void Profiler::setThreadName( const std::string& name ) {
+    ThreadZones& zones = getThreadZones();
+    std::lock_guard<std::mutex> lock( getRegistry().m_mutex );
+    zones.m_name = name;
+}
+
+std::string Profiler::getThreadName( uint threadId ) {
+    ZoneRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    if ( threadId >= registry.m_threads.size() || registry.m_threads[threadId]->m_name.empty() )
+    {
+        return "Thread " + std::to_string( threadId );
+    }
+    return registry.m_threads[threadId]->m_name;
+}
+
+const char* Profiler::intern( const std::string& str ) {
+    ZoneRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    // Elements of an unordered_set are never moved by a rehash.
+    return registry.m_internedStrings.insert( str ).first->c_str();
+}
+
+void Profiler::collect( std::vector<ProfileZone>& zones ) {
+    ZoneRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    for ( auto& thread : registry.m_threads )
+    {
+        thread->pop( zones );
+    }
+}
+
+uint64_t Profiler::getNumDroppedZones() {
+    ZoneRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    uint64_t dropped = 0;
+    for ( const auto& thread : registry.m_threads )
+    {
+        dropped += thread->m_dropped.load( std::memory_order_relaxed );
+    }
+    return dropped;
+}
+
+TimePoint Profiler::getStartTime() {
+    return getRegistry().m_startTime;
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() {
+    close();
+}
+
+bool ChromeTraceWriter::open( const std::string& filename ) {
+    close();
+    m_file.open( filename );
+    m_first = true;
+    m_namedThreads.clear();
+    if ( !m_file.is_open() )
+    {
+        return false;
+    }
+    m_file << "{\"traceEvents\":[\n";
+    return true;
+}
+
+void ChromeTraceWriter::write( const std::vector<ProfileZone>& zones ) {
+    if ( !m_file.is_open() )
+    {
+        return;
+    }
+    const TimePoint origin = Profiler::getStartTime();
+    for ( const auto& zone : zones )
+    {
+        if ( zone.threadId >= m_namedThreads.size() )
+        {
+            m_namedThreads.resize( zone.threadId + 1, false );
+        }
+        if ( !m_namedThreads[zone.threadId] )
+        {
+            m_file << ( m_first ? "" : ",\n" )
+                   << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << zone.threadId
+                   << ",\"args\":{\"name\":\""
+                   << escapeJson( Profiler::getThreadName( zone.threadId ).c_str() )
+                   << "\"}}";
+            m_namedThreads[zone.threadId] = true;
+            m_first = false;
+        }
+        m_file << ( m_first ? "" : ",\n" ) << "{\"name\":\"" << escapeJson( zone.name )
+               << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << zone.threadId
+               << ",\"ts\":" << getIntervalMicro( origin, zone.start )
+               << ",\"dur\":" << getIntervalMicro( zone.start, zone.end ) << "}";
+        m_first = false;
+    }
+}
+
+void ChromeTraceWriter::close() {
+    if ( m_file.is_open() )
+    {
+        m_file << "\n]}\n";
+        m_file.close();
+    }
+}
+
+MicroSeconds getPercentile( std::vector<MicroSeconds> durations, Scalar p ) {
+    if ( durations.empty() )
+    {
+        return 0;
+    }
+    // Nearest rank, in [1, size].
+    size_t rank = size_t( std::ceil( p * Scalar( durations.size() ) ) );
+    rank = std::min( std::max( rank, size_t( 1 ) ), durations.size() ) - 1;
+    std::nth_element( durations.begin(), durations.begin() + rank, durations.end() );
+    return durations[rank];
+}
+
+} // namespace Utils
+} // namespace Core
+} // namespace Ra
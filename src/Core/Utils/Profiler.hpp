@@ -0,0 +1,137 @@
+#ifndef RADIUMENGINE_PROFILER_HPP_
+#define RADIUMENGINE_PROFILER_HPP_
+
+#include <Core/RaCore.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Core/Utils/Timer.hpp>
+
+namespace Ra {
+namespace Core {
+namespace Utils {
+
+/// A timed zone of the execution of a thread.
+struct ProfileZone {
+    /// Name of the zone. Must be a string literal or a string returned by Profiler::intern().
+    const char* name;
+    TimePoint start;
+    TimePoint end;
+    /// Index of the thread which executed the zone, see Profiler::getThreadName().
+    uint threadId;
+};
+
+/**
+ * Low overhead profiler of scoped zones.
+ * Each thread records its zones in its own lock-free ring buffer, which is drained by
+ * collect(). When a ring buffer is full, the zones are dropped until the next collect().
+ * Zones are only recorded when the profiler is enabled, and the RA_PROFILE_* macros are
+ * compiled to nothing unless ALLOW_PROFILING is defined (see RADIUM_WITH_PROFILING).
+ */
+class RA_CORE_API Profiler {
+  public:
+    /// Index of the pseudo-thread holding the zones recorded with recordGpuZone().
+    enum { GpuThreadId = 0 };
+
+    static void setEnabled( bool enabled );
+    static bool isEnabled() { return s_enabled.load( std::memory_order_relaxed ); }
+
+    /// Record a zone of the calling thread.
+    static void recordZone( const char* name, const TimePoint& start, const TimePoint& end );
+
+    /// Record a zone executed by the GPU, whose timestamps are expressed with the CPU clock.
+    static void recordGpuZone( const char* name, const TimePoint& start, const TimePoint& end );
+
+    /// Name the calling thread in the exported traces.
+    static void setThreadName( const std::string& name );
+
+    static std::string getThreadName( uint threadId );
+
+    /// Return a copy of str which lives as long as the program, to be used as a zone name.
+    /// Calling intern() twice with the same string returns the same pointer.
+    static const char* intern( const std::string& str );
+
+    /// Move the zones recorded since the last call at the end of zones.
+    static void collect( std::vector<ProfileZone>& zones );
+
+    /// Number of zones dropped because of full ring buffers since the beginning.
+    static uint64_t getNumDroppedZones();
+
+    /// Origin of the timestamps of the exported traces.
+    static TimePoint getStartTime();
+
+  private:
+    static std::atomic<bool> s_enabled;
+};
+
+/// Records the lifetime of a scope as a zone. Prefer the RA_PROFILE_SCOPE macro.
+class ScopedZone {
+  public:
+    explicit ScopedZone( const char* name ) : m_name( Profiler::isEnabled() ? name : nullptr ) {
+        if ( m_name != nullptr )
+        {
+            m_start = Clock::now();
+        }
+    }
+
+    ~ScopedZone() {
+        if ( m_name != nullptr )
+        {
+            Profiler::recordZone( m_name, m_start, Clock::now() );
+        }
+    }
+
+    ScopedZone( const ScopedZone& ) = delete;
+    ScopedZone& operator=( const ScopedZone& ) = delete;
+
+  private:
+    const char* m_name;
+    TimePoint m_start;
+};
+
+/**
+ * Writes profiled zones to a file in the Chrome trace event format, which can be opened with
+ * chrome://tracing or https://ui.perfetto.dev.
+ * Zones can be written as they are collected, the file is completed by close().
+ */
+class RA_CORE_API ChromeTraceWriter {
+  public:
+    ChromeTraceWriter() = default;
+    ~ChromeTraceWriter();
+
+    bool open( const std::string& filename );
+    bool isOpen() const { return m_file.is_open(); }
+    void write( const std::vector<ProfileZone>& zones );
+    void close();
+
+  private:
+    std::ofstream m_file;
+    std::vector<bool> m_namedThreads;
+    bool m_first{true};
+};
+
+/// Return the p-th percentile ( p in [0, 1] ) of the given durations, using the nearest rank.
+RA_CORE_API MicroSeconds getPercentile( std::vector<MicroSeconds> durations, Scalar p );
+
+} // namespace Utils
+} // namespace Core
+} // namespace Ra
+
+#define RA_PROFILE_CONCAT_IMPL( a, b ) a##b
+#define RA_PROFILE_CONCAT( a, b ) RA_PROFILE_CONCAT_IMPL( a, b )
+
+#ifdef ALLOW_PROFILING
+/// Profile the enclosing scope under the given name (a string literal or an interned string).
+#    define RA_PROFILE_SCOPE( name ) \
+        ::Ra::Core::Utils::ScopedZone RA_PROFILE_CONCAT( raProfileZone, __LINE__ )( name )
+/// Profile the enclosing function.
+#    define RA_PROFILE_FUNCTION() RA_PROFILE_SCOPE( __func__ )
+#else
+#    define RA_PROFILE_SCOPE( name )
+#    define RA_PROFILE_FUNCTION()
+#endif
+
+#endif // RADIUMENGINE_PROFILER_HPP_
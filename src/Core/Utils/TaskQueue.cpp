@@ -1,3 +1,4 @@
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Task.hpp>
 #include <Core/Utils/TaskQueue.hpp>
 
@@ -35,6 +36,13 @@ TaskQueue::TaskId TaskQueue::registerTask( Task* task ) {
     TimerData tdata;
     tdata.taskName = task->getName();
     m_timerData.push_back( tdata );
+    m_zoneNames.push_back( nullptr );
+#ifdef ALLOW_PROFILING
+    if ( Profiler::isEnabled() )
+    {
+        m_zoneNames.back() = Profiler::intern( task->getName() );
+    }
+#endif
 
     CORE_ASSERT( m_tasks.size() == m_dependencies.size(), "Inconsistent task list" );
     CORE_ASSERT( m_tasks.size() == m_remainingDependencies.size(), "Inconsistent task list" );
@@ -195,10 +203,15 @@ void TaskQueue::flushTaskQueue() {
     m_tasks.clear();
     m_dependencies.clear();
     m_timerData.clear();
+    m_zoneNames.clear();
     m_remainingDependencies.clear();
 }
 
 void TaskQueue::runThread( uint id ) {
+#ifdef ALLOW_PROFILING
+    // Naming the thread allocates its ring buffer, so wait for the profiler to be used.
+    bool isNamed = false;
+#endif
     while ( true )
     {
         TaskId task = InvalidTaskId;
@@ -233,6 +246,18 @@ void TaskQueue::runThread( uint id ) {
         m_timerData[task].threadId = id;
         m_tasks[task]->process();
         m_timerData[task].end = Clock::now();
+#ifdef ALLOW_PROFILING
+        if ( Profiler::isEnabled() && m_zoneNames[task] != nullptr )
+        {
+            if ( !isNamed )
+            {
+                Profiler::setThreadName( "TaskQueue worker " + std::to_string( id ) );
+                isNamed = true;
+            }
+            Profiler::recordZone( m_zoneNames[task], m_timerData[task].start,
+                                  m_timerData[task].end );
+        }
+#endif
 
         // Critical section : mark task as finished and en-queue dependencies.
         uint newTasks = 0;
@@ -119,6 +119,10 @@ class RA_CORE_API TaskQueue {
     /// Stores the timings of each frame after execution.
     std::vector<TimerData> m_timerData;
 
+    /// Name of the profiler zone of each task (see Profiler::intern()), null for the tasks
+    /// registered while the profiler was disabled.
+    std::vector<const char*> m_zoneNames;
+
     //
     // mutex protected variables.
     //
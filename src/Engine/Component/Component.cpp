@@ -78,12 +78,12 @@ void Component::rayCastQuery( const Core::Math::Ray& ray ) const {
                 const Ra::Core::Math::Vector3 pEntity = t * pLocal;
                 const Ra::Core::Math::Vector3 pWorld = getEntity()->getTransform() * pEntity;
 
-                LOG( Core::Utils::logINFO ) << " Ray cast vs " << ro->getName();
-                LOG( Core::Utils::logINFO ) << " Hit triangle " << tidx;
-                LOG( Core::Utils::logINFO ) << " Nearest vertex " << result.m_nearestVertex;
-                LOG( Core::Utils::logINFO ) << "Hit position (RO): " << pLocal.transpose();
-                LOG( Core::Utils::logINFO ) << "Hit position (Comp): " << pEntity.transpose();
-                LOG( Core::Utils::logINFO ) << "Hit position (World): " << pWorld.transpose();
+                LOG_RATE_LIMITED( Core::Utils::logINFO, 10 )
+                    << " Ray cast vs " << ro->getName() << "\n\t Hit triangle " << tidx
+                    << "\n\t Nearest vertex " << result.m_nearestVertex
+                    << "\n\tHit position (RO): " << pLocal.transpose()
+                    << "\n\tHit position (Comp): " << pEntity.transpose()
+                    << "\n\tHit position (World): " << pWorld.transpose();
             }
         }
     }
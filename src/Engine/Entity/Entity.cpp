@@ -12,10 +12,10 @@ namespace Engine {
 
 Entity::Entity( const std::string& name ) :
     Core::Container::IndexedObject(),
-    m_transform( Core::Math::Transform::Identity() ),
-    m_doubleBufferedTransform( Core::Math::Transform::Identity() ),
     m_name( name ),
-    m_transformChanged( false ) {}
+    m_transformStore( nullptr ),
+    m_transformNode( TransformStore::InvalidNode ),
+    m_initialTransform( Core::Math::Transform::Identity() ) {}
 
 Entity::~Entity() {
     // Ensure components are deleted before the entity for consistent
@@ -62,10 +62,9 @@ void Entity::removeComponent( const std::string& name ) {
 }
 
 void Entity::swapTransformBuffers() {
-    if ( m_transformChanged )
+    if ( m_transformStore != nullptr )
     {
-        m_transform = m_doubleBufferedTransform;
-        m_transformChanged = false;
+        m_transformStore->applyNode( m_transformNode );
     }
 }
 
@@ -75,7 +74,7 @@ EntityManager* Entity::getEntityMgr(){
 
 void Entity::rayCastQuery( const Core::Math::Ray& r ) const {
     // put ray in local frame.
-    Core::Math::Ray transformedRay = Ra::Core::Math::transformRay( r, m_transform.inverse() );
+    Core::Math::Ray transformedRay = Ra::Core::Math::transformRay( r, getTransform().inverse() );
     for ( const auto& c : m_components )
     {
         c->rayCastQuery( transformedRay );
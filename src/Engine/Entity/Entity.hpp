@@ -13,6 +13,7 @@
 #include <Core/Math/Ray.hpp>
 
 #include <Engine/Managers/EntityManager/EntityManager.hpp>
+#include <Engine/Managers/EntityManager/TransformStore.hpp>
 
 namespace Ra {
 namespace Engine {
@@ -42,13 +43,28 @@ class RA_ENGINE_API Entity : public Core::Container::IndexedObject {
     inline void rename( const std::string& name );
 
     // Transform
+    /// Set the transform of the entity. It is applied at the end of the frame,
+    /// when the entity manager swaps the transform buffers. Before the entity is added to an
+    /// entity manager, the transform is kept and becomes its initial transform.
     inline void setTransform( const Core::Math::Transform& transform );
     inline void setTransform( const Core::Math::Matrix4& transform );
-    Core::Math::Transform getTransform() const;
-    Core::Math::Matrix4 getTransformAsMatrix() const;
 
+    /// Return the transform of the entity, as applied at the last buffer swap.
+    /// These are read from the TransformStore of the entity manager without lock.
+    inline Core::Math::Transform getTransform() const;
+    inline Core::Math::Matrix4 getTransformAsMatrix() const;
+
+    /// Apply immediatly the pending transform of the entity, e.g. after setting its
+    /// initial transform or editing it from the UI. The other entities are not affected, and
+    /// the render objects of the entity follow at the end of the frame.
+    /// Must be called from the main thread, outside of the tasks and rendering.
     void swapTransformBuffers();
 
+    /// Access to the node of the entity in the transform hierarchy.
+    /// The store is null as long as the entity has not been added to an EntityManager.
+    inline TransformStore* getTransformStore() const;
+    inline TransformStore::NodeIdx getTransformNode() const;
+
     // Components
     /// Add a component to the given entity. Component ownership is transfered to the entity.
     void addComponent( Component* component );
@@ -74,16 +90,18 @@ class RA_ENGINE_API Entity : public Core::Container::IndexedObject {
     static EntityManager* getEntityMgr();
 
   private:
-    Core::Math::Transform m_transform;
-    Core::Math::Transform m_doubleBufferedTransform;
+    // The entity manager registers the entity in its transform store.
+    friend class EntityManager;
 
     std::string m_name;
 
     std::vector<std::unique_ptr<Component>> m_components;
 
-    bool m_transformChanged;
-    mutable std::mutex m_transformMutex;
+    TransformStore* m_transformStore;
+    TransformStore::NodeIdx m_transformNode;
 
+    /// Transform set before the registration in the transform store.
+    Core::Math::Transform m_initialTransform;
 };
 
 } // namespace Engine
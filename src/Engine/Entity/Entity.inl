@@ -12,8 +12,12 @@ inline void Entity::rename( const std::string& name ) {
 }
 
 inline void Entity::setTransform( const Core::Math::Transform& transform ) {
-    m_transformChanged = true;
-    m_doubleBufferedTransform = transform;
+    if ( m_transformStore == nullptr )
+    {
+        m_initialTransform = transform;
+        return;
+    }
+    m_transformStore->setLocalTransform( m_transformNode, transform );
 }
 
 inline void Entity::setTransform( const Core::Math::Matrix4& transform ) {
@@ -21,13 +25,23 @@ inline void Entity::setTransform( const Core::Math::Matrix4& transform ) {
 }
 
 inline Core::Math::Transform Entity::getTransform() const {
-    std::lock_guard<std::mutex> lock( m_transformMutex );
-    return m_transform;
+    return Core::Math::Transform( getTransformAsMatrix() );
 }
 
 inline Core::Math::Matrix4 Entity::getTransformAsMatrix() const {
-    std::lock_guard<std::mutex> lock( m_transformMutex );
-    return m_transform.matrix();
+    if ( m_transformStore == nullptr )
+    {
+        return m_initialTransform.matrix();
+    }
+    return m_transformStore->getWorldMatrix( m_transformNode );
+}
+
+inline TransformStore* Entity::getTransformStore() const {
+    return m_transformStore;
+}
+
+inline TransformStore::NodeIdx Entity::getTransformNode() const {
+    return m_transformNode;
 }
 
 inline uint Entity::getNumComponents() const {
@@ -3,6 +3,7 @@
 
 #include <Engine/RaEngine.hpp>
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -35,6 +36,11 @@ class Component;
 /// and rw() functions.
 /// For more efficiency the underlying function pointers are directly accessible
 /// as well and can be queried with the same identifiers.
+/// For per-frame accesses, getHandle() resolves the (entity, id, type) key once
+/// and returns a Handle which gives direct access to the data without any lookup.
+/// Each data also carries a version counter, incremented by the producer through
+/// Handle::notifyChanged() (and by Handle::set() and Handle::rw()), so that consumers
+/// can skip their work when the data has not changed since their last access.
 class RA_ENGINE_API ComponentMessenger {
     RA_SINGLETON_INTERFACE( ComponentMessenger );
 
@@ -50,8 +56,19 @@ class RA_ENGINE_API ComponentMessenger {
         /// Function pointer for a read/write getter.
         using ReadWrite = std::function<T*( void )>;
 
+        /// Pointer to the data itself, for outputs which can be read directly.
+        using Data = const T*;
+
         /// Calls the callback and retrieves the object
         static const T& getHelper( const Getter& g ) { return *( g() ); }
+
+        /// Retrieves the object, bypassing the callback if the data is directly accessible.
+        static const T& getHelper( const Getter& g, Data d ) { return d ? *d : *( g() ); }
+
+        /// Creates a getter returning the given data.
+        static Getter makeGetter( Data d ) {
+            return [d]() { return d; };
+        }
     };
 
     template <typename T>
@@ -59,8 +76,17 @@ class RA_ENGINE_API ComponentMessenger {
         using Getter = std::function<std::shared_ptr<const T>( void )>;
         using Setter = std::function<void( std::shared_ptr<const T> )>;
         using ReadWrite = std::function<std::shared_ptr<T>( void )>;
+        using Data = const std::shared_ptr<const T>*;
 
         static const std::shared_ptr<const T>& getHelper( const Getter& g ) { return ( g() ); }
+
+        static std::shared_ptr<const T> getHelper( const Getter& g, Data d ) {
+            return d ? *d : g();
+        }
+
+        static Getter makeGetter( Data d ) {
+            return [d]() { return *d; };
+        }
     };
 
   private:
@@ -77,27 +103,79 @@ class RA_ENGINE_API ComponentMessenger {
         inline std::size_t operator()( const Key& k ) const;
     };
 
-    /// Class hierarchy for polymorphic storage of callback functions.
-    struct CallbackBase {};
-    template <typename T>
-    struct GetterCallback : public CallbackBase {
-        typename CallbackTypes<T>::Getter m_cb;
-    };
-    template <typename T>
-    struct SetterCallback : public CallbackBase {
-        typename CallbackTypes<T>::Setter m_cb;
+    /// Class hierarchy for polymorphic storage of the callback functions.
+    /// A slot holds all the callbacks registered with a given key, and is never
+    /// moved nor deleted once created, so that handles can point to it.
+    struct SlotBase {
+        virtual ~SlotBase() = default;
+        /// Version of the data, incremented each time it is notified as changed.
+        std::atomic<uint> m_version{0};
     };
     template <typename T>
-    struct RwCallback : public CallbackBase {
-        typename CallbackTypes<T>::ReadWrite m_cb;
+    struct Slot : public SlotBase {
+        typename CallbackTypes<T>::Getter m_getter;
+        typename CallbackTypes<T>::Setter m_setter;
+        typename CallbackTypes<T>::ReadWrite m_rw;
+        /// Direct pointer to the data if it was registered as such, nullptr otherwise.
+        typename CallbackTypes<T>::Data m_data{nullptr};
     };
 
     /// A dictionary of callback entries identified with the key.
-    using CallbackMap = std::unordered_map<Key, std::unique_ptr<CallbackBase>, HashFunc>;
+    using CallbackMap = std::unordered_map<Key, std::unique_ptr<SlotBase>, HashFunc>;
 
   public:
+    /// Stable typed access to the data registered for a given (entity, id, type) key.
+    /// A handle can be obtained before the data is registered, and stays valid
+    /// as long as the messenger exists. Accessors assert when the corresponding
+    /// callback is not registered (e.g. get() asserts if canGet() is false).
+    template <typename T>
+    class Handle
+    {
+      public:
+        /// Create an invalid handle, which cannot access any data.
+        Handle() = default;
+
+        /// Returns true if the handle refers to a key of the messenger.
+        inline bool isValid() const { return m_slot != nullptr; }
+
+        inline bool canGet() const { return m_slot && m_slot->m_getter; }
+        inline bool canSet() const { return m_slot && m_slot->m_setter; }
+        inline bool canRw() const { return m_slot && m_slot->m_rw; }
+
+        /// Read the data.
+        inline decltype( auto ) get() const;
+
+        /// Access the data for writing, and mark it as changed.
+        inline decltype( auto ) rw() const;
+
+        /// Give the data to the registered input, and mark it as changed.
+        template <typename Arg>
+        inline void set( Arg&& arg ) const;
+
+        /// Returns the current version of the data.
+        inline uint getVersion() const;
+
+        /// Mark the data as changed, to be called by producers after each modification.
+        inline void notifyChanged() const;
+
+      private:
+        friend class ComponentMessenger;
+        explicit Handle( Slot<T>* slot ) : m_slot( slot ) {}
+
+        Slot<T>* m_slot{nullptr};
+    };
+
     ComponentMessenger() {}
 
+    //
+    // Pre-resolved access
+    //
+
+    /// Resolve the given key and returns a handle on it. The key does not need
+    /// to be registered yet : the handle can be queried once the data is available.
+    template <typename ReturnType>
+    inline Handle<ReturnType> getHandle( const Entity* entity, const std::string& id );
+
     //
     // Direct access to function pointers
     //
@@ -145,6 +223,13 @@ class RA_ENGINE_API ComponentMessenger {
     inline void registerOutput( const Entity* entity, Component* comp, const std::string& id,
                                 const typename CallbackTypes<ReturnType>::Getter& cb );
 
+    /// Register an output directly readable through the given pointer, which
+    /// must stay valid as long as the entity exists. This avoids calling a
+    /// function for each access.
+    template <typename ReturnType>
+    inline void registerOutput( const Entity* entity, Component* comp, const std::string& id,
+                                typename CallbackTypes<ReturnType>::Data data );
+
     template <typename ReturnType>
     inline void registerReadWrite( const Entity* entity, Component* comp, const std::string& id,
                                    const typename CallbackTypes<ReturnType>::ReadWrite& cb );
@@ -153,13 +238,18 @@ class RA_ENGINE_API ComponentMessenger {
     inline void registerInput( const Entity* entity, Component* comp, const std::string& id,
                                const typename CallbackTypes<ReturnType>::Setter& cb );
 
+  private:
+    /// Returns the slot of the given key, or nullptr if it does not exist.
+    template <typename ReturnType>
+    inline Slot<ReturnType>* findSlot( const Entity* entity, const std::string& id ) const;
+
+    /// Returns the slot of the given key, creating it if needed.
+    template <typename ReturnType>
+    inline Slot<ReturnType>* getOrCreateSlot( const Entity* entity, const std::string& id );
+
   private:
     std::unordered_map<const Entity*, CallbackMap>
-        m_entityGetLists; /// Per-entity callback get list.
-    std::unordered_map<const Entity*, CallbackMap>
-        m_entitySetLists; /// Per-entity callback set list.
-    std::unordered_map<const Entity*, CallbackMap>
-        m_entityRwLists; /// Per-entity callback read-write list.
+        m_entityLists; /// Per-entity callback list.
 };
 
 } // namespace Engine
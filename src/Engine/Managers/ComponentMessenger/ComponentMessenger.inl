@@ -7,36 +7,105 @@ inline std::size_t ComponentMessenger::HashFunc::operator()( const Key& k ) cons
     return Core::Utils::hash( k );
 }
 
+template <typename T>
+inline decltype( auto ) ComponentMessenger::Handle<T>::get() const {
+    CORE_ASSERT( canGet(), "Unregistered callback" );
+    return CallbackTypes<T>::getHelper( m_slot->m_getter, m_slot->m_data );
+}
+
+template <typename T>
+inline decltype( auto ) ComponentMessenger::Handle<T>::rw() const {
+    CORE_ASSERT( canRw(), "Unregistered callback" );
+    notifyChanged();
+    return m_slot->m_rw();
+}
+
+template <typename T>
+template <typename Arg>
+inline void ComponentMessenger::Handle<T>::set( Arg&& arg ) const {
+    CORE_ASSERT( canSet(), "Unregistered callback" );
+    m_slot->m_setter( std::forward<Arg>( arg ) );
+    notifyChanged();
+}
+
+template <typename T>
+inline uint ComponentMessenger::Handle<T>::getVersion() const {
+    CORE_ASSERT( isValid(), "Invalid handle" );
+    return m_slot->m_version.load( std::memory_order_acquire );
+}
+
+template <typename T>
+inline void ComponentMessenger::Handle<T>::notifyChanged() const {
+    CORE_ASSERT( isValid(), "Invalid handle" );
+    m_slot->m_version.fetch_add( 1, std::memory_order_acq_rel );
+}
+
+template <typename ReturnType>
+inline ComponentMessenger::Slot<ReturnType>*
+ComponentMessenger::findSlot( const Entity* entity, const std::string& id ) const {
+    // Attempt to find the given entity list.
+    const auto& entityListPos = m_entityLists.find( entity );
+    if ( entityListPos == m_entityLists.end() )
+        return nullptr; // Entity has no registered component
+
+    Key key( id, std::type_index( typeid( ReturnType ) ) );
+    const CallbackMap& entityList = entityListPos->second;
+
+    // Check if there are components exporting the given type,
+    // so let's try to find if there is one with the requested id.
+    const auto& callbackEntry = entityList.find( key );
+    if ( callbackEntry == entityList.end() )
+        return nullptr;
+    return static_cast<Slot<ReturnType>*>( callbackEntry->second.get() );
+}
+
+template <typename ReturnType>
+inline ComponentMessenger::Slot<ReturnType>*
+ComponentMessenger::getOrCreateSlot( const Entity* entity, const std::string& id ) {
+    // Will insert a new entity entry if it doesn't exist.
+    CallbackMap& entityList = m_entityLists[entity];
+
+    std::unique_ptr<SlotBase>& slot =
+        entityList[Key( id, std::type_index( typeid( ReturnType ) ) )];
+    if ( !slot )
+    {
+        slot.reset( new Slot<ReturnType>() );
+    }
+    return static_cast<Slot<ReturnType>*>( slot.get() );
+}
+
+template <typename ReturnType>
+inline ComponentMessenger::Handle<ReturnType>
+ComponentMessenger::getHandle( const Entity* entity, const std::string& id ) {
+    return Handle<ReturnType>( getOrCreateSlot<ReturnType>( entity, id ) );
+}
+
 template <typename ReturnType>
 inline typename ComponentMessenger::CallbackTypes<ReturnType>::Getter
 ComponentMessenger::getterCallback( const Entity* entity, const std::string& id ) {
     CORE_ASSERT( canGet<ReturnType>( entity, id ), "Unregistered callback" );
-    return static_cast<GetterCallback<ReturnType>*>(
-               m_entityGetLists[entity][Key( id, std::type_index( typeid( ReturnType ) ) )].get() )
-        ->m_cb;
+    return findSlot<ReturnType>( entity, id )->m_getter;
 }
 
 template <typename ReturnType>
 inline typename ComponentMessenger::CallbackTypes<ReturnType>::ReadWrite
 ComponentMessenger::rwCallback( const Entity* entity, const std::string& id ) {
     CORE_ASSERT( canRw<ReturnType>( entity, id ), "Unregistered callback" );
-    return static_cast<RwCallback<ReturnType>*>(
-               m_entityRwLists[entity][Key( id, std::type_index( typeid( ReturnType ) ) )].get() )
-        ->m_cb;
+    return findSlot<ReturnType>( entity, id )->m_rw;
 }
 
 template <typename ReturnType>
 inline typename ComponentMessenger::CallbackTypes<ReturnType>::Setter
 ComponentMessenger::setterCallback( const Entity* entity, const std::string& id ) {
     CORE_ASSERT( canSet<ReturnType>( entity, id ), "Unregistered callback" );
-    return static_cast<SetterCallback<ReturnType>*>(
-               m_entitySetLists[entity][Key( id, std::type_index( typeid( ReturnType ) ) )].get() )
-        ->m_cb;
+    return findSlot<ReturnType>( entity, id )->m_setter;
 }
 
 template <typename ReturnType>
 inline const ReturnType& ComponentMessenger::get( const Entity* entity, const std::string& id ) {
-    return CallbackTypes<ReturnType>::getHelper( getterCallback<ReturnType>( entity, id ) );
+    CORE_ASSERT( canGet<ReturnType>( entity, id ), "Unregistered callback" );
+    const Slot<ReturnType>* slot = findSlot<ReturnType>( entity, id );
+    return CallbackTypes<ReturnType>::getHelper( slot->m_getter, slot->m_data );
 }
 /*
         template<typename ReturnType>
@@ -48,53 +117,20 @@ inline const ReturnType& ComponentMessenger::get( const Entity* entity, const st
 */
 template <typename ReturnType>
 inline bool ComponentMessenger::canGet( const Entity* entity, const std::string& id ) {
-    // Attempt to find the given entity list.
-    const auto& entityListPos = m_entityGetLists.find( entity );
-    if ( entityListPos == m_entityGetLists.end() )
-        return false; // Entity has no registered component
-
-    Key key( id, std::type_index( typeid( ReturnType ) ) );
-    const CallbackMap& entityList = entityListPos->second;
-
-    // Check if there are components exporting the given type,
-    // so let's try to find if there is one with the requested id.
-    const auto& callbackEntry = entityList.find( key );
-    const bool found = ( callbackEntry != entityList.end() );
-    return found;
+    const Slot<ReturnType>* slot = findSlot<ReturnType>( entity, id );
+    return slot && slot->m_getter;
 }
 
 template <typename ReturnType>
 inline bool ComponentMessenger::canSet( const Entity* entity, const std::string& id ) {
-    // Attempt to find the given entity list.
-    auto entityListPos = m_entitySetLists.find( entity );
-    if ( entityListPos == m_entitySetLists.end() )
-        return false; // Entity has no registered component
-
-    Key key( id, std::type_index( typeid( ReturnType ) ) );
-    const CallbackMap& entityList = entityListPos->second;
-
-    // Check if there are components exporting the given type,
-    // so let's try to find if there is one with the requested id.
-    const auto& callbackEntry = entityList.find( key );
-    const bool found = ( callbackEntry != entityList.end() );
-    return found;
+    const Slot<ReturnType>* slot = findSlot<ReturnType>( entity, id );
+    return slot && slot->m_setter;
 }
 
 template <typename ReturnType>
 inline bool ComponentMessenger::canRw( const Entity* entity, const std::string& id ) {
-    // Attempt to find the given entity list.
-    const auto& entityListPos = m_entityRwLists.find( entity );
-    if ( entityListPos == m_entityRwLists.end() )
-        return false; // Entity has no registered component
-
-    Key key( id, std::type_index( typeid( ReturnType ) ) );
-    const CallbackMap& entityList = entityListPos->second;
-
-    // Check if there are components exporting the given type,
-    // so let's try to find if there is one with the requested id.
-    const auto& callbackEntry = entityList.find( key );
-    const bool found = ( callbackEntry != entityList.end() );
-    return found;
+    const Slot<ReturnType>* slot = findSlot<ReturnType>( entity, id );
+    return slot && slot->m_rw;
 }
 
 template <typename ReturnType>
@@ -102,15 +138,21 @@ inline void
 ComponentMessenger::registerOutput( const Entity* entity, Component* comp, const std::string& id,
                                     const typename CallbackTypes<ReturnType>::Getter& cb ) {
     CORE_ASSERT( entity && comp->getEntity() == entity, "Component not added to entity" );
-    // Will insert a new entity entry if it doesn't exist.
-    CallbackMap& entityList = m_entityGetLists[entity];
-
-    Key key( id, std::type_index( typeid( ReturnType ) ) );
-    CORE_ASSERT( entityList.find( key ) == entityList.end(), "Output function already registered" );
+    Slot<ReturnType>* slot = getOrCreateSlot<ReturnType>( entity, id );
+    CORE_ASSERT( !slot->m_getter, "Output function already registered" );
+    slot->m_getter = cb;
+}
 
-    GetterCallback<ReturnType>* getter = new GetterCallback<ReturnType>();
-    getter->m_cb = cb;
-    entityList[key].reset( getter );
+template <typename ReturnType>
+inline void
+ComponentMessenger::registerOutput( const Entity* entity, Component* comp, const std::string& id,
+                                    typename CallbackTypes<ReturnType>::Data data ) {
+    CORE_ASSERT( entity && comp->getEntity() == entity, "Component not added to entity" );
+    CORE_ASSERT( data, "Invalid output data" );
+    Slot<ReturnType>* slot = getOrCreateSlot<ReturnType>( entity, id );
+    CORE_ASSERT( !slot->m_getter, "Output function already registered" );
+    slot->m_getter = CallbackTypes<ReturnType>::makeGetter( data );
+    slot->m_data = data;
 }
 
 template <typename ReturnType>
@@ -118,15 +160,9 @@ inline void
 ComponentMessenger::registerReadWrite( const Entity* entity, Component* comp, const std::string& id,
                                        const typename CallbackTypes<ReturnType>::ReadWrite& cb ) {
     CORE_ASSERT( entity && comp->getEntity() == entity, "Component not added to entity" );
-    // Will insert a new entity entry if it doesn't exist.
-    CallbackMap& entityList = m_entityRwLists[entity];
-
-    Key key( id, std::type_index( typeid( ReturnType ) ) );
-    CORE_ASSERT( entityList.find( key ) == entityList.end(), "Rw function already registered" );
-
-    RwCallback<ReturnType>* rw = new RwCallback<ReturnType>();
-    rw->m_cb = cb;
-    entityList[key].reset( rw );
+    Slot<ReturnType>* slot = getOrCreateSlot<ReturnType>( entity, id );
+    CORE_ASSERT( !slot->m_rw, "Rw function already registered" );
+    slot->m_rw = cb;
 }
 
 template <typename ReturnType>
@@ -134,15 +170,9 @@ inline void
 ComponentMessenger::registerInput( const Entity* entity, Component* comp, const std::string& id,
                                    const typename CallbackTypes<ReturnType>::Setter& cb ) {
     CORE_ASSERT( entity && comp->getEntity() == entity, "Component not added to entity" );
-    // Will insert a new entity entry if it doesn't exist.
-    CallbackMap& entityList = m_entitySetLists[entity];
-
-    Key key( id, std::type_index( typeid( ReturnType ) ) );
-    CORE_ASSERT( entityList.find( key ) == entityList.end(), "Input function already registered" );
-
-    SetterCallback<ReturnType>* setter = new SetterCallback<ReturnType>();
-    setter->m_cb = cb;
-    entityList[key].reset( setter );
+    Slot<ReturnType>* slot = getOrCreateSlot<ReturnType>( entity, id );
+    CORE_ASSERT( !slot->m_setter, "Input function already registered" );
+    slot->m_setter = cb;
 }
 
 } // namespace Engine
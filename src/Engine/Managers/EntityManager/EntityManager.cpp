@@ -12,6 +12,7 @@ namespace Engine {
 
 EntityManager::EntityManager() {
     Entity* ent( SystemEntity::createInstance() );
+    registerTransform( ent );
     ent->idx = m_entities.emplace( std::move( ent ) );
     CORE_ASSERT( ent == SystemEntity::getInstance(), "Invalid singleton instanciation" );
     m_entitiesName.insert( std::pair<std::string, Core::Container::Index>( ent->getName(), ent->idx ) );
@@ -25,6 +26,7 @@ Entity* EntityManager::createEntity( const std::string& name ) {
     Core::Container::Index idx = m_entities.emplace( new Entity( name ) );
     auto& ent = m_entities[idx];
     ent->idx = idx;
+    registerTransform( ent.get() );
 
     std::string entityName = name;
     if ( name == "" )
@@ -63,7 +65,10 @@ void EntityManager::removeEntity( Core::Container::Index idx ) {
 
     auto& ent = m_entities[idx];
     std::string name = ent->getName();
+    const TransformStore::NodeIdx node = ent->m_transformNode;
+    // Deleting the entity releases the transform nodes of its render objects.
     m_entities.remove( idx );
+    m_transformStore.removeNode( node );
     m_entitiesName.erase( name );
 }
 
@@ -104,10 +109,16 @@ Entity* EntityManager::getEntity( const std::string& name ) const {
 }
 
 void EntityManager::swapBuffers() {
-    for ( auto& e : m_entities )
-    {
-        e->swapTransformBuffers();
-    }
+    m_transformStore.swapBuffers();
+}
+
+TransformStore* EntityManager::getTransformStore() {
+    return &m_transformStore;
+}
+
+void EntityManager::registerTransform( Entity* entity ) {
+    entity->m_transformStore = &m_transformStore;
+    entity->m_transformNode = m_transformStore.addNode( entity->m_initialTransform );
 }
 
 void EntityManager::deleteEntities() {
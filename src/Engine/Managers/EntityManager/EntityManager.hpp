@@ -11,6 +11,8 @@
 #include <Core/Container/IndexMap.hpp>
 #include <Core/Utils/Singleton.hpp>
 
+#include <Engine/Managers/EntityManager/TransformStore.hpp>
+
 namespace Ra {
 namespace Engine {
 class Entity;
@@ -74,8 +76,13 @@ class RA_ENGINE_API EntityManager {
      */
     std::vector<Entity*> getEntities() const;
 
+    /// Apply the transforms set during the frame : world and normal matrices of
+    /// the entities and of their render objects are computed once here.
     void swapBuffers();
 
+    /// Access the transform hierarchy of the entities and their render objects.
+    TransformStore* getTransformStore();
+
     /**
      * @brief Get an entity given its name.
      * @param name Name of the entity to retrieve.
@@ -89,6 +96,13 @@ class RA_ENGINE_API EntityManager {
     void deleteEntities();
 
   private:
+    /// Add the entity to the transform hierarchy.
+    void registerTransform( Entity* entity );
+
+  private:
+    // Declared first so that it outlives the entities (and their render objects).
+    TransformStore m_transformStore;
+
     Core::Container::IndexMap<std::unique_ptr<Entity>> m_entities;
     std::map<std::string, Core::Container::Index> m_entitiesName;
 };
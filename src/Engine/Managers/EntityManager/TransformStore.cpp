@@ -0,0 +1,182 @@
+#include <Engine/Managers/EntityManager/TransformStore.hpp>
+
+namespace Ra {
+namespace Engine {
+
+TransformStore::TransformStore() : m_numSlots( 0 ), m_isDirty( false ), m_front( 0 ) {}
+
+TransformStore::~TransformStore() {}
+
+TransformStore::NodeIdx TransformStore::addNode( const Core::Math::Transform& local,
+                                                 NodeIdx parent ) {
+    std::lock_guard<std::mutex> lock( m_nodesMutex );
+    CORE_ASSERT( parent == InvalidNode ||
+                     getChunk( parent ).m_depths[getSlot( parent )] != InvalidDepth,
+                 "Invalid parent node" );
+
+    NodeIdx node;
+    if ( m_freeNodes.empty() )
+    {
+        node = m_numSlots;
+        if ( getSlot( node ) == 0 )
+        {
+            CORE_ASSERT( node / ChunkSize < MaxChunks, "Too many transform nodes" );
+            m_chunks[node / ChunkSize].reset( new Chunk );
+        }
+    } else
+    {
+        node = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+
+    Chunk& chunk = *m_chunks[node / ChunkSize];
+    const uint slot = getSlot( node );
+    const uint depth =
+        parent == InvalidNode ? 0 : getChunk( parent ).m_depths[getSlot( parent )] + 1;
+    if ( depth == m_levels.size() )
+    {
+        m_levels.emplace_back();
+    }
+    chunk.m_levelPositions[slot] = uint( m_levels[depth].size() );
+    m_levels[depth].push_back( node );
+
+    chunk.m_parents[slot] = parent;
+    chunk.m_depths[slot] = depth;
+    chunk.m_dirty[slot] = 0;
+    chunk.m_updated[0][slot] = 0;
+    chunk.m_updated[1][slot] = 0;
+    chunk.m_moved[slot] = 0;
+    chunk.m_localMatrices[slot] = local.matrix();
+
+    // Fill both buffers so that the node is consistent until the next swap.
+    Core::Math::Matrix4 world = local.matrix();
+    if ( parent != InvalidNode )
+    {
+        world = getWorldMatrix( parent ) * world;
+    }
+    const Core::Math::Matrix4 normal = world.inverse().transpose();
+    for ( uint b = 0; b < 2; ++b )
+    {
+        chunk.m_worldMatrices[b][slot] = world;
+        chunk.m_normalMatrices[b][slot] = normal;
+    }
+
+    // The node is published once initialized.
+    if ( node == m_numSlots )
+    {
+        ++m_numSlots;
+    }
+    return node;
+}
+
+void TransformStore::removeNode( NodeIdx node ) {
+    std::lock_guard<std::mutex> lock( m_nodesMutex );
+    Chunk& chunk = getChunk( node );
+    const uint slot = getSlot( node );
+    CORE_ASSERT( chunk.m_depths[slot] != InvalidDepth, "Removing an invalid node" );
+
+    // Replace the node by the last one of its level.
+    std::vector<NodeIdx>& level = m_levels[chunk.m_depths[slot]];
+    const uint position = chunk.m_levelPositions[slot];
+    const NodeIdx last = level.back();
+    level[position] = last;
+    getChunk( last ).m_levelPositions[getSlot( last )] = position;
+    level.pop_back();
+
+    chunk.m_parents[slot] = InvalidNode;
+    chunk.m_depths[slot] = InvalidDepth;
+    chunk.m_dirty[slot] = 0;
+    chunk.m_updated[0][slot] = 0;
+    chunk.m_updated[1][slot] = 0;
+    chunk.m_moved[slot] = 0;
+    m_freeNodes.push_back( node );
+}
+
+void TransformStore::applyNode( NodeIdx node ) {
+    Chunk& chunk = getChunk( node );
+    const uint slot = getSlot( node );
+    CORE_ASSERT( chunk.m_depths[slot] != InvalidDepth, "Invalid node" );
+    Core::Math::Matrix4 world = chunk.m_localMatrices[slot];
+    const NodeIdx parent = chunk.m_parents[slot];
+    if ( parent != InvalidNode )
+    {
+        world = getWorldMatrix( parent ) * world;
+    }
+    const Core::Math::Matrix4 normal = world.inverse().transpose();
+    for ( uint b = 0; b < 2; ++b )
+    {
+        chunk.m_worldMatrices[b][slot] = world;
+        chunk.m_normalMatrices[b][slot] = normal;
+    }
+    chunk.m_moved[slot] = 1;
+    // The node stays dirty so that the next swap updates its descendants.
+}
+
+void TransformStore::swapBuffers() {
+    // Nothing to do, the back buffer is kept as is until a node changes.
+    if ( !m_isDirty.exchange( false, std::memory_order_acquire ) )
+    {
+        return;
+    }
+    const uint back = 1 - m_front;
+
+    // Parents are always processed before their children, one level at a time,
+    // so that dirtiness propagates down the hierarchy.
+    for ( const auto& level : m_levels )
+    {
+        const int numNodes = int( level.size() );
+#pragma omp parallel for if ( numNodes > 512 )
+        for ( int i = 0; i < numNodes; ++i )
+        {
+            const NodeIdx node = level[i];
+            Chunk& chunk = getChunk( node );
+            const uint slot = getSlot( node );
+            const NodeIdx parent = chunk.m_parents[slot];
+            // The dirty flag is consumed before the local transform is read : a transform
+            // set from now on flags the node again for the next swap.
+            const bool dirty = chunk.m_dirty[slot].exchange( 0, std::memory_order_acquire );
+            const bool updated =
+                dirty ||
+                ( parent != InvalidNode && getChunk( parent ).m_updated[back][getSlot( parent )] );
+            chunk.m_updated[back][slot] = updated;
+
+            auto& backWorld = chunk.m_worldMatrices[back][slot];
+            auto& backNormal = chunk.m_normalMatrices[back][slot];
+            if ( updated )
+            {
+                if ( parent == InvalidNode )
+                {
+                    backWorld = chunk.m_localMatrices[slot];
+                } else
+                {
+                    backWorld = getChunk( parent ).m_worldMatrices[back][getSlot( parent )] *
+                                chunk.m_localMatrices[slot];
+                }
+                backNormal = backWorld.inverse().transpose();
+                chunk.m_moved[slot] = 1;
+            } else if ( chunk.m_updated[m_front][slot] )
+            {
+                // The back buffer is two frames old for this node.
+                backWorld = chunk.m_worldMatrices[m_front][slot];
+                backNormal = chunk.m_normalMatrices[m_front][slot];
+            }
+        }
+    }
+    m_front = back;
+}
+
+void TransformStore::getMovedNodes( std::vector<NodeIdx>& nodesOut ) {
+    const uint numNodes = m_numSlots;
+    for ( NodeIdx node = 0; node < numNodes; ++node )
+    {
+        char& moved = getChunk( node ).m_moved[getSlot( node )];
+        if ( moved )
+        {
+            nodesOut.push_back( node );
+            moved = 0;
+        }
+    }
+}
+
+} // namespace Engine
+} // namespace Ra
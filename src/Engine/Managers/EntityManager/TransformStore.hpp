@@ -0,0 +1,142 @@
+#ifndef RADIUMENGINE_TRANSFORMSTORE_HPP
+#define RADIUMENGINE_TRANSFORMSTORE_HPP
+
+#include <Engine/RaEngine.hpp>
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Core/Math/LinearAlgebra.hpp>
+
+namespace Ra {
+namespace Engine {
+
+/**
+ * Storage for the transform hierarchy of the engine (entities, and render
+ * objects attached below them).
+ * Local transforms, world matrices and normal matrices are stored in contiguous
+ * arrays, indexed by node. World and normal matrices are double buffered :
+ * setLocalTransform() only marks the node as dirty, and the new world matrices
+ * are computed in parallel by swapBuffers(), once per frame, for the dirty nodes
+ * and their descendants only. The nodes are bucketed by depth, so that a swap
+ * visits each node once, and a swap without any dirty node does nothing.
+ * Readers (e.g. the renderers) access the front buffer without any lock.
+ * The nodes are allocated by chunks which never move, so that nodes can be added
+ * or removed, e.g. by the tasks creating render objects, while other nodes are
+ * read. Adding or removing nodes must not happen concurrently with swapBuffers().
+ */
+class RA_ENGINE_API TransformStore final {
+  public:
+    using NodeIdx = uint;
+
+    /// Index of "no node", used for roots.
+    static constexpr NodeIdx InvalidNode = std::numeric_limits<NodeIdx>::max();
+
+    TransformStore();
+    ~TransformStore();
+
+    TransformStore( const TransformStore& ) = delete;
+    TransformStore& operator=( const TransformStore& ) = delete;
+
+    /// Add a node with the given local transform, below \p parent if any.
+    /// The world and normal matrices of the new node are immediatly available.
+    NodeIdx addNode( const Core::Math::Transform& local, NodeIdx parent = InvalidNode );
+
+    /// Release a node. Its children must have been removed before.
+    void removeNode( NodeIdx node );
+
+    /// Set the local transform of a node. The corresponding world matrix is
+    /// updated at the next call to swapBuffers().
+    /// Can be called concurrently for different nodes, and with swapBuffers() :
+    /// a transform set during a swap is applied either by this swap or by the next one.
+    inline void setLocalTransform( NodeIdx node, const Core::Math::Transform& local );
+
+    /// Return the local transform of a node, as last set with setLocalTransform().
+    inline const Core::Math::Matrix4& getLocalMatrix( NodeIdx node ) const;
+
+    /// Return the world matrix of a node, as computed by the last swapBuffers().
+    inline const Core::Math::Matrix4& getWorldMatrix( NodeIdx node ) const;
+
+    /// Return the transpose of the inverse of the world matrix of a node, as
+    /// computed by the last swapBuffers().
+    inline const Core::Math::Matrix4& getNormalMatrix( NodeIdx node ) const;
+
+    /// Return the number of valid nodes.
+    inline uint getNumNodes() const;
+
+    /// Get the nodes whose world matrix changed since the last call, and clear them.
+    /// Must not be called concurrently with swapBuffers() or applyNode().
+    void getMovedNodes( std::vector<NodeIdx>& nodesOut );
+
+    /// Compute the world and normal matrices of the dirty nodes into the back
+    /// buffer, then make it the front buffer.
+    void swapBuffers();
+
+    /// Apply immediatly the local transform of a single node : its world and
+    /// normal matrices are computed into both buffers. Its descendants are
+    /// updated at the next swapBuffers(). Must not be called concurrently with
+    /// the readers of the node, e.g. only from the main thread between frames.
+    void applyNode( NodeIdx node );
+
+  private:
+    /// Depth of removed nodes, which are skipped by swapBuffers().
+    static constexpr uint InvalidDepth = std::numeric_limits<uint>::max();
+
+    /// Number of nodes of a chunk, and maximum number of chunks.
+    static constexpr uint ChunkSize = 1024;
+    static constexpr uint MaxChunks = 4096;
+
+    /// Storage of ChunkSize consecutive nodes.
+    struct Chunk {
+        RA_CORE_ALIGNED_NEW
+
+        /// Local transforms, as set by setLocalTransform().
+        std::array<Core::Math::Matrix4, ChunkSize> m_localMatrices;
+
+        /// Double buffered world and normal matrices.
+        std::array<Core::Math::Matrix4, ChunkSize> m_worldMatrices[2];
+        std::array<Core::Math::Matrix4, ChunkSize> m_normalMatrices[2];
+
+        std::array<NodeIdx, ChunkSize> m_parents; /// Parent of each node (InvalidNode for roots).
+        std::array<uint, ChunkSize> m_depths;     /// Depth of each node in the hierarchy.
+        std::array<uint, ChunkSize> m_levelPositions; /// Index of each node in its level.
+
+        /// Local transform changed since the node was last consumed by a swap.
+        std::array<std::atomic<char>, ChunkSize> m_dirty;
+
+        // Stored as chars (not bool) since nodes are written concurrently.
+        /// World matrix recomputed by the swap which computed each buffer.
+        std::array<char, ChunkSize> m_updated[2];
+        /// World matrix changed since the last getMovedNodes().
+        std::array<char, ChunkSize> m_moved;
+    };
+
+    /// Chunk and index in the chunk of a node.
+    inline Chunk& getChunk( NodeIdx node ) const;
+    static inline uint getSlot( NodeIdx node );
+
+    /// The chunks are allocated on demand, the array itself never grows.
+    std::array<std::unique_ptr<Chunk>, MaxChunks> m_chunks;
+    std::atomic<uint> m_numSlots; /// Number of nodes ever allocated, including the free ones.
+
+    std::vector<NodeIdx> m_freeNodes; /// Removed nodes, available for reuse.
+
+    /// Valid nodes of each depth of the hierarchy.
+    std::vector<std::vector<NodeIdx>> m_levels;
+
+    std::mutex m_nodesMutex; /// Protects node creation and removal.
+
+    std::atomic<bool> m_isDirty; /// A local transform changed since the last swap.
+    uint m_front;                /// Index of the buffer to read from.
+};
+
+} // namespace Engine
+} // namespace Ra
+
+#include <Engine/Managers/EntityManager/TransformStore.inl>
+
+#endif // RADIUMENGINE_TRANSFORMSTORE_HPP
@@ -0,0 +1,43 @@
+#include <Engine/Managers/EntityManager/TransformStore.hpp>
+
+namespace Ra {
+namespace Engine {
+
+inline TransformStore::Chunk& TransformStore::getChunk( NodeIdx node ) const {
+    CORE_ASSERT( node < m_numSlots, "Invalid node" );
+    return *m_chunks[node / ChunkSize];
+}
+
+inline uint TransformStore::getSlot( NodeIdx node ) {
+    return node % ChunkSize;
+}
+
+inline void TransformStore::setLocalTransform( NodeIdx node, const Core::Math::Transform& local ) {
+    Chunk& chunk = getChunk( node );
+    const uint slot = getSlot( node );
+    CORE_ASSERT( chunk.m_depths[slot] != InvalidDepth, "Invalid node" );
+    chunk.m_localMatrices[slot] = local.matrix();
+    // The node is flagged first : if a concurrent swap misses the node, m_isDirty
+    // is set again after the swap cleared it, and the next swap applies the node.
+    chunk.m_dirty[slot].store( 1, std::memory_order_release );
+    m_isDirty.store( true, std::memory_order_release );
+}
+
+inline const Core::Math::Matrix4& TransformStore::getLocalMatrix( NodeIdx node ) const {
+    return getChunk( node ).m_localMatrices[getSlot( node )];
+}
+
+inline const Core::Math::Matrix4& TransformStore::getWorldMatrix( NodeIdx node ) const {
+    return getChunk( node ).m_worldMatrices[m_front][getSlot( node )];
+}
+
+inline const Core::Math::Matrix4& TransformStore::getNormalMatrix( NodeIdx node ) const {
+    return getChunk( node ).m_normalMatrices[m_front][getSlot( node )];
+}
+
+inline uint TransformStore::getNumNodes() const {
+    return uint( m_numSlots - m_freeNodes.size() );
+}
+
+} // namespace Engine
+} // namespace Ra
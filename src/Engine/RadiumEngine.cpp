@@ -11,6 +11,7 @@
 
 #include <Core/Asset/FileData.hpp>
 #include <Core/Asset/FileLoaderInterface.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 #include <Engine/FrameInfo.hpp>
 #include <Engine/System/System.hpp>
@@ -62,6 +63,7 @@ void RadiumEngine::cleanup() {
 
 void RadiumEngine::endFrameSync() {
     m_entityManager->swapBuffers();
+    m_renderObjectManager->updateSceneAabb();
     m_signalManager->fireFrameEnded();
 }
 
@@ -131,12 +133,14 @@ Mesh* RadiumEngine::getMesh( const std::string& entityName, const std::string& c
 }
 
 bool RadiumEngine::loadFile( const std::string& filename ) {
+    RA_PROFILE_SCOPE( "RadiumEngine::loadFile" );
     std::string extension = Core::Utils::getFileExt( filename );
 
     for ( auto& l : m_fileLoaders )
     {
         if ( l->handleFileExtension( extension ) )
         {
+            RA_PROFILE_SCOPE( "FileLoaderInterface::loadFile" );
             Core::Asset::FileData* data = l->loadFile( filename );
             if ( data != nullptr )
             {
@@ -160,6 +164,7 @@ bool RadiumEngine::loadFile( const std::string& filename ) {
 
     for ( auto& system : m_systems )
     {
+        RA_PROFILE_SCOPE( "System::handleAssetLoading" );
         system.second->handleAssetLoading( entity, m_loadedFile.get() );
     }
 
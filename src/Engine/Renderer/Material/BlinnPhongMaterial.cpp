@@ -71,8 +71,9 @@ void BlinnPhongMaterial::bind( const ShaderProgram* shader ) {
     } else
     { shader->setUniform( "material.tex.hasKs", 0 ); }
 
+    // A placeholder is not a valid normal map, ignore it until the texture is loaded.
     tex = getTexture( BlinnPhongMaterial::TextureSemantic::TEX_NORMAL );
-    if ( tex != nullptr )
+    if ( tex != nullptr && !tex->isPlaceholder() )
     {
         tex->bind( texUnit );
         shader->setUniform( "material.tex.normal", tex, texUnit );
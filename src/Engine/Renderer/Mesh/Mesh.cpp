@@ -1,8 +1,12 @@
 #include <Engine/Renderer/Mesh/Mesh.hpp>
 
-#include <numeric>
+#include <algorithm>
 
+#include <Core/Geometry/MeshUtils.hpp>
+
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
 #include <Engine/Renderer/OpenGL/OpenGL.hpp>
+#include <Engine/Renderer/RenderObject/RenderObject.hpp>
 
 namespace Ra {
 namespace Engine {
@@ -14,7 +18,11 @@ Mesh::Mesh( const std::string& name, MeshRenderMode renderMode ) :
     m_vao( 0 ),
     m_renderMode( renderMode ),
     m_numElements( 0 ),
-    m_isDirty( false ) {
+    m_glNumElements( 0 ),
+    m_glRenderMode( renderMode ),
+    m_isDirty( false ),
+    m_isAabbValid( false ),
+    m_isEvicted( false ) {
     CORE_ASSERT( m_renderMode == RM_POINTS || m_renderMode == RM_LINES ||
                      m_renderMode == RM_LINE_LOOP || m_renderMode == RM_LINE_STRIP ||
                      m_renderMode == RM_TRIANGLES || m_renderMode == RM_TRIANGLE_STRIP ||
@@ -36,19 +44,95 @@ Mesh::~Mesh() {
             }
         }
     }
+    GpuMemoryTracker::release( this );
+}
+
+void Mesh::evictGL() {
+    if ( m_vao == 0 )
+    {
+        return;
+    }
+    GL_ASSERT( glDeleteVertexArrays( 1, &m_vao ) );
+    m_vao = 0;
+    for ( auto& vbo : m_vbos )
+    {
+        if ( vbo != 0 )
+        {
+            GL_ASSERT( glDeleteBuffers( 1, &vbo ) );
+            vbo = 0;
+        }
+    }
+    m_vboSizes.fill( 0 );
+
+    // The vertex buffers are created again with their data by sendGLData(), only the index
+    // buffer needs to be marked.
+    m_dataDirty[INDEX] = true;
+    m_isDirty = true;
+    m_isEvicted = true;
+    GpuMemoryTracker::setEvicted( this );
 }
 
-void Mesh::render() {
+void Mesh::render( uint level ) {
+    if ( m_isEvicted )
+    {
+        updateGL();
+    }
     if ( m_vao != 0 )
     {
+        GpuMemoryTracker::markUsed( this );
         GL_ASSERT( glBindVertexArray( m_vao ) );
-        GL_ASSERT( glDrawElements( static_cast<GLenum>( m_renderMode ), m_numElements,
-                                   GL_UNSIGNED_INT, (void*)0 ) );
+        if ( m_glRenderMode == RM_POINTS )
+        {
+            GL_ASSERT( glDrawArrays( GL_POINTS, 0, m_glNumElements ) );
+        } else if ( level > 0 && level <= m_lodRanges.size() )
+        {
+            const LodRange& lod = m_lodRanges[level - 1];
+            GL_ASSERT( glDrawElements( GL_TRIANGLES, lod.m_numElements, GL_UNSIGNED_INT,
+                                       (void*)( lod.m_offset * sizeof( GLuint ) ) ) );
+        } else
+        {
+            GL_ASSERT( glDrawElements( static_cast<GLenum>( m_glRenderMode ), m_glNumElements,
+                                       GL_UNSIGNED_INT, (void*)0 ) );
+        }
+    }
+}
+
+void Mesh::attachRenderObject( RenderObject* renderObject ) {
+    std::lock_guard<std::mutex> lock( m_renderObjectsMutex );
+    m_renderObjects.push_back( renderObject );
+}
+
+void Mesh::detachRenderObject( RenderObject* renderObject ) {
+    std::lock_guard<std::mutex> lock( m_renderObjectsMutex );
+    m_renderObjects.erase(
+        std::remove( m_renderObjects.begin(), m_renderObjects.end(), renderObject ),
+        m_renderObjects.end() );
+}
+
+void Mesh::notifyRenderObjects() {
+    // Held while notifying, so that a render object cannot be destroyed meanwhile.
+    std::lock_guard<std::mutex> lock( m_renderObjectsMutex );
+    for ( auto ro : m_renderObjects )
+    {
+        ro->setDirty();
+    }
+}
+
+Core::Math::Aabb Mesh::getAabb() const {
+    // The writers mark the positions dirty before writing them (e.g. the rw getters of the
+    // components), so the box is only cached once updateGL() has sent them.
+    if ( !m_isAabbValid || m_dataDirty[VERTEX_POSITION] )
+    {
+        m_aabb = Core::Geometry::getAabb( m_mesh );
+        m_isAabbValid = !m_dataDirty[VERTEX_POSITION];
     }
+    return m_aabb;
 }
 
 void Mesh::loadGeometry( const Core::Geometry::TriangleMesh& mesh ) {
     m_mesh = mesh;
+    m_isAabbValid = false;
+    m_lods.clear();
 
     if ( m_mesh.m_triangles.empty() )
     {
@@ -62,15 +146,20 @@ void Mesh::loadGeometry( const Core::Geometry::TriangleMesh& mesh ) {
         m_dataDirty[i] = true;
     }
     m_isDirty = true;
+    notifyRenderObjects();
 }
 
 void Mesh::updateMeshGeometry( MeshData type, const Core::Container::Vector3Array& data ) {
     if ( type == VERTEX_POSITION )
+    {
         m_mesh.m_vertices = data;
+        m_isAabbValid = false;
+    }
     if ( type == VERTEX_NORMAL )
         m_mesh.m_normals = data;
     m_dataDirty[static_cast<uint>( type )] = true;
     m_isDirty = true;
+    notifyRenderObjects();
 }
 
 void Mesh::loadGeometry( const Core::Container::Vector3Array& vertices, const std::vector<uint>& indices ) {
@@ -85,6 +174,8 @@ void Mesh::loadGeometry( const Core::Container::Vector3Array& vertices, const st
     } else
         m_numElements = nIdx;
     m_mesh.m_vertices = vertices;
+    m_isAabbValid = false;
+    m_lods.clear();
 
     // Check that when loading a triangle mesh we actually have triangles or lines.
     CORE_ASSERT( m_renderMode != GL_TRIANGLES || nIdx % 3 == 0,
@@ -107,18 +198,29 @@ void Mesh::loadGeometry( const Core::Container::Vector3Array& vertices, const st
         m_dataDirty[i] = true;
     }
     m_isDirty = true;
+    notifyRenderObjects();
+}
+
+void Mesh::setLods( const std::vector<Core::Geometry::MeshLod>& lods ) {
+    CORE_ASSERT( m_renderMode == RM_TRIANGLES, "Levels of detail need a triangle mesh." );
+    m_lods = lods;
+    m_dataDirty[INDEX] = true;
+    m_isDirty = true;
+    notifyRenderObjects();
 }
 
 void Mesh::addData( const Vec3Data& type, const Core::Container::Vector3Array& data ) {
     m_v3Data[static_cast<uint>( type )] = data;
     m_dataDirty[MAX_MESH + static_cast<uint>( type )] = true;
     m_isDirty = true;
+    notifyRenderObjects();
 }
 
 void Mesh::addData( const Vec4Data& type, const Core::Container::Vector4Array& data ) {
     m_v4Data[static_cast<uint>( type )] = data;
     m_dataDirty[MAX_MESH + MAX_VEC3 + static_cast<uint>( type )] = true;
     m_isDirty = true;
+    notifyRenderObjects();
 }
 
 // Template parameter must be a Core::Math::VectorNArray
@@ -152,8 +254,9 @@ void Mesh::sendGLData( const VecArray& arr, const uint vboIdx ) {
     if ( m_dataDirty[vboIdx] == true && m_vbos[vboIdx] != 0 && arr.size() > 0 )
     {
         GL_ASSERT( glBindBuffer( GL_ARRAY_BUFFER, m_vbos[vboIdx] ) );
-        GL_ASSERT( glBufferData( GL_ARRAY_BUFFER, arr.size() * sizeof( typename VecArray::Vector ),
-                                 arr.data(), GL_DYNAMIC_DRAW ) );
+        m_vboSizes[vboIdx] = arr.size() * sizeof( typename VecArray::Vector );
+        GL_ASSERT( glBufferData( GL_ARRAY_BUFFER, m_vboSizes[vboIdx], arr.data(),
+                                 GL_DYNAMIC_DRAW ) );
         m_dataDirty[vboIdx] = false;
     }
 }
@@ -168,7 +271,8 @@ void Mesh::updateGL() {
 
         CORE_ASSERT( !( m_mesh.m_vertices.empty() ), "No vertex." );
 
-        if ( m_vao == 0 )
+        const bool created = m_vao == 0;
+        if ( created )
         {
             // Create VAO if it does not exist
             GL_ASSERT( glGenVertexArrays( 1, &m_vao ) );
@@ -177,27 +281,43 @@ void Mesh::updateGL() {
         // Bind it
         GL_ASSERT( glBindVertexArray( m_vao ) );
 
-        if ( m_vbos[INDEX] == 0 )
+        // Point meshes are drawn in vertex order, without index buffer (see render()).
+        if ( m_dataDirty[INDEX] && m_renderMode != RM_POINTS )
         {
-            GL_ASSERT( glGenBuffers( 1, &m_vbos[INDEX] ) );
-            GL_ASSERT( glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, m_vbos[INDEX] ) );
-        }
-        if ( m_dataDirty[INDEX] )
-        {
-            if ( m_renderMode == RM_POINTS )
+            if ( m_vbos[INDEX] == 0 )
+            {
+                GL_ASSERT( glGenBuffers( 1, &m_vbos[INDEX] ) );
+                GL_ASSERT( glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, m_vbos[INDEX] ) );
+            }
+            // The levels of detail follow the triangles of the geometry.
+            uint numTriangles = m_mesh.m_triangles.size();
+            m_lodRanges.clear();
+            for ( const auto& lod : m_lods )
             {
-                std::vector<int> indices( m_numElements );
-                std::iota( indices.begin(), indices.end(), 0 );
-                GL_ASSERT( glBufferData( GL_ELEMENT_ARRAY_BUFFER, m_numElements * sizeof( int ),
-                                         indices.data(), GL_DYNAMIC_DRAW ) );
-            } else
+                m_lodRanges.push_back( {3 * numTriangles, 3 * uint( lod.m_triangles.size() ),
+                                        lod.m_error} );
+                numTriangles += lod.m_triangles.size();
+            }
+            m_vboSizes[INDEX] = numTriangles * sizeof( Ra::Core::Geometry::Triangle );
+            GL_ASSERT( glBufferData( GL_ELEMENT_ARRAY_BUFFER, m_vboSizes[INDEX],
+                                     m_lods.empty() ? m_mesh.m_triangles.data() : nullptr,
+                                     GL_DYNAMIC_DRAW ) );
+            if ( !m_lods.empty() )
+            {
+                GL_ASSERT( glBufferSubData(
+                    GL_ELEMENT_ARRAY_BUFFER, 0,
+                    m_mesh.m_triangles.size() * sizeof( Ra::Core::Geometry::Triangle ),
+                    m_mesh.m_triangles.data() ) );
+            }
+            for ( uint i = 0; i < m_lods.size(); ++i )
             {
-                GL_ASSERT( glBufferData( GL_ELEMENT_ARRAY_BUFFER,
-                                         m_mesh.m_triangles.size() * sizeof( Ra::Core::Geometry::Triangle ),
-                                         m_mesh.m_triangles.data(), GL_DYNAMIC_DRAW ) );
+                GL_ASSERT( glBufferSubData(
+                    GL_ELEMENT_ARRAY_BUFFER, m_lodRanges[i].m_offset * sizeof( GLuint ),
+                    m_lods[i].m_triangles.size() * sizeof( Ra::Core::Geometry::Triangle ),
+                    m_lods[i].m_triangles.data() ) );
             }
-            m_dataDirty[INDEX] = false;
         }
+        m_dataDirty[INDEX] = false;
 
         // Geometry data
         sendGLData( m_mesh.m_vertices, VERTEX_POSITION );
@@ -215,7 +335,21 @@ void Mesh::updateGL() {
 
         GL_ASSERT( glBindVertexArray( 0 ) );
         GL_CHECK_ERROR;
+        m_glNumElements = m_numElements;
+        m_glRenderMode = m_renderMode;
         m_isDirty = false;
+        m_isEvicted = false;
+
+        std::size_t size = 0;
+        for ( auto s : m_vboSizes )
+        {
+            size += s;
+        }
+        GpuMemoryTracker::setSize( this, GpuMemoryTracker::RESOURCE_MESH, m_name, size );
+        if ( created )
+        {
+            GpuMemoryTracker::setEvictable( this, [this]() { evictGL(); } );
+        }
     }
 }
 
@@ -4,12 +4,16 @@
 #include <Engine/RaEngine.hpp>
 
 #include <array>
+#include <mutex>
+#include <vector>
 
 #include <Core/Container/VectorArray.hpp>
+#include <Core/Geometry/Decimation.hpp>
 #include <Core/Geometry/TriangleMesh.hpp>
 
 namespace Ra {
 namespace Engine {
+class RenderObject;
 
 // FIXME(Charly): If I want to draw a mesh as lines, points, etc,
 //                should I send lines, ... to the GPU, or handle the way
@@ -26,6 +30,8 @@ namespace Engine {
 /// It maintains the attributes and keeps them in sync with the GPU.
 class RA_ENGINE_API Mesh final {
   public:
+    RA_CORE_ALIGNED_NEW
+
     /// List of all possible vertex attributes.
 
     // This is also the layout of the "dirty bit" and "vbo" arrays.
@@ -96,6 +102,12 @@ class RA_ENGINE_API Mesh final {
     inline const Core::Geometry::TriangleMesh& getGeometry() const;
     inline Core::Geometry::TriangleMesh& getGeometry();
 
+    /// Returns the bounding box of the vertices, in mesh space.
+    /// The box is computed from the vertices as long as their positions are dirty (see
+    /// setDirty(), loadGeometry() and updateMeshGeometry()), and cached once updateGL() has
+    /// sent them.
+    Core::Math::Aabb getAabb() const;
+
     /// Use the given geometry as base for a display mesh. Normals are optionnal.
     void loadGeometry( const Core::Geometry::TriangleMesh& mesh );
 
@@ -115,6 +127,7 @@ class RA_ENGINE_API Mesh final {
     inline Core::Container::Vector4Array& getData( const Vec4Data& type );
 
     /// Mark one of the data types as dirty, forcing an update of the openGL buffer.
+    /// The render objects drawing the mesh are marked dirty as well (see RenderObject::setDirty()).
     inline void setDirty( const MeshData& type );
     inline void setDirty( const Vec3Data& type );
     inline void setDirty( const Vec4Data& type );
@@ -123,8 +136,34 @@ class RA_ENGINE_API Mesh final {
     /// necessary openGL buffers.
     void updateGL();
 
-    /// Draw the mesh.
-    void render();
+    /// Set the levels of detail of a triangle mesh (see Core::Geometry::computeLods()), whose
+    /// triangles index the vertices of the geometry. They share its vertex buffers, and are
+    /// removed by loadGeometry().
+    void setLods( const std::vector<Core::Geometry::MeshLod>& lods );
+
+    /// Number of levels of detail sent to the GPU, the level 0 being the geometry itself.
+    inline uint getNumLods() const;
+
+    /// Geometric error of a level of detail sent to the GPU, in mesh space.
+    inline Scalar getLodError( uint level ) const;
+
+    /// Draw the mesh, at the given level of detail, as sent by the last updateGL().
+    /// The renderer sends the evicted meshes of its queues again before the tasks of the frame
+    /// start, the OpenGL buffers of other evicted meshes are sent again here.
+    void render( uint level = 0 );
+
+    /// Free the OpenGL buffers of the mesh, keeping its data. Called by the GpuMemoryTracker
+    /// budget policy when the mesh has not been drawn for a while.
+    void evictGL();
+
+    /// Returns true if the OpenGL buffers of the mesh have been freed by evictGL().
+    bool isEvicted() const { return m_isEvicted; }
+
+    /// Register a render object drawing this mesh, to notify it each time the mesh becomes dirty.
+    /// Called by RenderObject::setMesh(). Thread safe, render objects may be created and
+    /// destroyed by the tasks while other tasks modify the mesh.
+    void attachRenderObject( RenderObject* renderObject );
+    void detachRenderObject( RenderObject* renderObject );
 
   private:
     Mesh( const Mesh& rhs ) = delete;
@@ -134,7 +173,12 @@ class RA_ENGINE_API Mesh final {
     template <typename VecArray>
     void sendGLData( const VecArray& arr, const uint vboIdx );
 
+    /// Mark the attached render objects as dirty.
+    void notifyRenderObjects();
+
   private:
+    mutable Core::Math::Aabb m_aabb; /// Cached bounding box of the vertices.
+
     std::string m_name; /// Name of the mesh.
 
     uint m_vao;                  /// Index of our openGL VAO
@@ -154,13 +198,37 @@ class RA_ENGINE_API Mesh final {
 
     std::array<uint, MAX_DATA> m_vbos = {{0}};          /// Indices of our openGL VBOs.
     std::array<bool, MAX_DATA> m_dataDirty = {{false}}; /// Dirty bits of our vertex data.
+    std::array<std::size_t, MAX_DATA> m_vboSizes = {{0}}; /// Size in bytes of our openGL VBOs.
 
     uint m_numElements; /// number of elements to draw. For triangles this is 3*numTriangles but not
                         /// for lines.
     // (val) : this is a bit hacky.
 
+    /// Element count and render mode of the buffers sent by updateGL(), used by render().
+    /// The tasks may change the geometry while the frame is drawn in pipelined mode.
+    uint m_glNumElements;
+    MeshRenderMode m_glRenderMode;
+
     bool m_isDirty; /// General dirty bit of the mesh.
     // TODO (Val) this flag could just be replaced by an efficient "or" of the other flags.
+
+    mutable bool m_isAabbValid; /// False when m_aabb must be recomputed from the vertices.
+
+    bool m_isEvicted; /// True when the openGL buffers have been freed by evictGL().
+
+    std::vector<RenderObject*> m_renderObjects; /// Render objects drawing this mesh.
+    std::mutex m_renderObjectsMutex;            /// Protects m_renderObjects.
+
+    std::vector<Core::Geometry::MeshLod> m_lods; /// Levels of detail, see setLods().
+
+    /// Range of the index buffer and error of each level of detail sent to the GPU.
+    /// The levels follow the triangles of the geometry in the index buffer.
+    struct LodRange {
+        uint m_offset;
+        uint m_numElements;
+        Scalar m_error;
+    };
+    std::vector<LodRange> m_lodRanges;
 };
 
 } // namespace Engine
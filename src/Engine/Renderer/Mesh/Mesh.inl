@@ -8,6 +8,19 @@ const std::string& Mesh::getName() const {
 
 void Mesh::setRenderMode( MeshRenderMode mode ) {
     m_renderMode = mode;
+    // Point meshes have no index buffer, see updateGL().
+    if ( !m_mesh.m_vertices.empty() )
+    {
+        setDirty( INDEX );
+    }
+}
+
+uint Mesh::getNumLods() const {
+    return m_lodRanges.size() + 1;
+}
+
+Scalar Mesh::getLodError( uint level ) const {
+    return level == 0 ? 0 : m_lodRanges[level - 1].m_error;
 }
 
 const Core::Geometry::TriangleMesh& Mesh::getGeometry() const {
@@ -34,16 +47,23 @@ Core::Container::Vector4Array& Mesh::getData( const Mesh::Vec4Data& type ) {
 }
 
 void Mesh::setDirty( const Mesh::MeshData& type ) {
+    if ( type == VERTEX_POSITION )
+    {
+        m_isAabbValid = false;
+    }
     m_dataDirty[type] = true;
     m_isDirty = true;
+    notifyRenderObjects();
 }
 void Mesh::setDirty( const Mesh::Vec3Data& type ) {
     m_dataDirty[MAX_MESH + type] = true;
     m_isDirty = true;
+    notifyRenderObjects();
 }
 void Mesh::setDirty( const Mesh::Vec4Data& type ) {
     m_dataDirty[MAX_MESH + MAX_VEC3 + type] = true;
     m_isDirty = true;
+    notifyRenderObjects();
 }
 
 } // namespace Engine
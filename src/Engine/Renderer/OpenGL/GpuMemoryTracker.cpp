@@ -0,0 +1,275 @@
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace Ra {
+namespace Engine {
+
+namespace {
+struct Resource {
+    std::string m_name;
+    GpuMemoryTracker::ResourceType m_type;
+    std::size_t m_size;
+    bool m_evicted;
+    uint m_lastUse;
+    std::function<void()> m_evict;
+};
+
+struct Registry {
+    std::unordered_map<const void*, Resource> m_resources;
+    std::size_t m_budget{0};
+    uint m_frame{0};
+    std::mutex m_mutex;
+};
+
+Registry& getRegistry() {
+    static Registry registry;
+    return registry;
+}
+} // namespace
+
+void GpuMemoryTracker::setSize( const void* resource, ResourceType type, const std::string& name,
+                                std::size_t size ) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    auto it = registry.m_resources.find( resource );
+    if ( it == registry.m_resources.end() )
+    {
+        it = registry.m_resources.emplace( resource, Resource() ).first;
+    }
+    Resource& res = it->second;
+    res.m_name = name;
+    res.m_type = type;
+    res.m_size = size;
+    res.m_evicted = false;
+    res.m_lastUse = registry.m_frame;
+}
+
+void GpuMemoryTracker::release( const void* resource ) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    registry.m_resources.erase( resource );
+}
+
+void GpuMemoryTracker::setEvictable( const void* resource, std::function<void()> evict ) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    auto it = registry.m_resources.find( resource );
+    CORE_ASSERT( it != registry.m_resources.end(), "Resource not registered" );
+    it->second.m_evict = std::move( evict );
+}
+
+void GpuMemoryTracker::setEvicted( const void* resource ) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    auto it = registry.m_resources.find( resource );
+    if ( it != registry.m_resources.end() )
+    {
+        it->second.m_evicted = true;
+    }
+}
+
+void GpuMemoryTracker::markUsed( const void* resource ) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    auto it = registry.m_resources.find( resource );
+    if ( it != registry.m_resources.end() )
+    {
+        it->second.m_lastUse = registry.m_frame;
+    }
+}
+
+void GpuMemoryTracker::newFrame() {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    ++registry.m_frame;
+}
+
+void GpuMemoryTracker::setBudget( std::size_t bytes ) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    registry.m_budget = bytes;
+}
+
+std::size_t GpuMemoryTracker::getBudget() {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    return registry.m_budget;
+}
+
+std::size_t GpuMemoryTracker::enforceBudget() {
+    // The eviction functions call setEvicted(), the victims are chosen before calling them.
+    std::vector<std::function<void()>> victims;
+    std::size_t evicted = 0;
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock( registry.m_mutex );
+        if ( registry.m_budget == 0 )
+        {
+            return 0;
+        }
+        std::size_t resident = 0;
+        std::vector<const Resource*> candidates;
+        for ( const auto& res : registry.m_resources )
+        {
+            if ( !res.second.m_evicted )
+            {
+                resident += res.second.m_size;
+                if ( res.second.m_evict && res.second.m_lastUse != registry.m_frame )
+                {
+                    candidates.push_back( &res.second );
+                }
+            }
+        }
+        if ( resident <= registry.m_budget )
+        {
+            return 0;
+        }
+        std::sort( candidates.begin(), candidates.end(),
+                   []( const Resource* a, const Resource* b ) {
+                       return a->m_lastUse < b->m_lastUse ||
+                              ( a->m_lastUse == b->m_lastUse && a->m_size > b->m_size );
+                   } );
+        for ( uint i = 0; i < candidates.size() && resident - evicted > registry.m_budget; ++i )
+        {
+            victims.push_back( candidates[i]->m_evict );
+            evicted += candidates[i]->m_size;
+        }
+    }
+    for ( const auto& evict : victims )
+    {
+        evict();
+    }
+    return evicted;
+}
+
+std::array<GpuMemoryTracker::Usage, GpuMemoryTracker::MAX_RESOURCE> GpuMemoryTracker::getUsage() {
+    std::array<Usage, MAX_RESOURCE> usage;
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    for ( const auto& res : registry.m_resources )
+    {
+        Usage& u = usage[res.second.m_type];
+        ++u.m_numResources;
+        if ( res.second.m_evicted )
+        {
+            u.m_evictedSize += res.second.m_size;
+            ++u.m_numEvicted;
+        } else
+        { u.m_residentSize += res.second.m_size; }
+    }
+    return usage;
+}
+
+std::size_t GpuMemoryTracker::getResidentSize() {
+    std::size_t size = 0;
+    for ( const auto& u : getUsage() )
+    {
+        size += u.m_residentSize;
+    }
+    return size;
+}
+
+std::vector<GpuMemoryTracker::ResourceInfo> GpuMemoryTracker::getResources() {
+    std::vector<ResourceInfo> resources;
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock( registry.m_mutex );
+    resources.reserve( registry.m_resources.size() );
+    for ( const auto& res : registry.m_resources )
+    {
+        const Resource& r = res.second;
+        resources.push_back( {r.m_name, r.m_type, r.m_size, r.m_evicted, r.m_lastUse} );
+    }
+    return resources;
+}
+
+const char* GpuMemoryTracker::getTypeName( ResourceType type ) {
+    switch ( type )
+    {
+    case RESOURCE_MESH:
+        return "Meshes";
+    case RESOURCE_TEXTURE:
+        return "Textures";
+    case RESOURCE_RENDER_TARGET:
+        return "Render targets";
+    case RESOURCE_BUFFER:
+        return "Buffers";
+    default:
+        return "Unknown";
+    }
+}
+
+std::size_t GpuMemoryTracker::getTexelSize( GLenum internalFormat ) {
+    switch ( internalFormat )
+    {
+    case GL_RED:
+    case GL_R8:
+        return 1;
+    case GL_RG:
+    case GL_RG8:
+    case GL_R16F:
+    case GL_DEPTH_COMPONENT16:
+        return 2;
+    case GL_RGB:
+    case GL_RGB8:
+    case GL_SRGB8:
+        return 3;
+    case GL_RGB16F:
+        return 6;
+    case GL_RG32F:
+    case GL_RGBA16F:
+    case GL_DEPTH32F_STENCIL8:
+        return 8;
+    case GL_RGB32F:
+        return 12;
+    case GL_RGBA32F:
+    case GL_RGBA32I:
+    case GL_RGBA32UI:
+        return 16;
+    default:
+        // RGBA8, 32 bits single channel and depth formats.
+        return 4;
+    }
+}
+
+std::size_t GpuMemoryTracker::getPixelSize( GLenum format, GLenum type ) {
+    std::size_t components = 4;
+    switch ( format )
+    {
+    case GL_RED:
+    case GL_RED_INTEGER:
+    case GL_DEPTH_COMPONENT:
+        components = 1;
+        break;
+    case GL_RG:
+    case GL_RG_INTEGER:
+        components = 2;
+        break;
+    case GL_RGB:
+    case GL_BGR:
+    case GL_RGB_INTEGER:
+        components = 3;
+        break;
+    default:
+        break;
+    }
+    switch ( type )
+    {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+        return components;
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:
+        return 2 * components;
+    case GL_UNSIGNED_INT_24_8:
+        return 4;
+    default:
+        return 4 * components;
+    }
+}
+
+} // namespace Engine
+} // namespace Ra
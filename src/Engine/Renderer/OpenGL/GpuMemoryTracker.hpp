@@ -0,0 +1,111 @@
+#ifndef RADIUMENGINE_GPUMEMORYTRACKER_HPP
+#define RADIUMENGINE_GPUMEMORYTRACKER_HPP
+
+#include <Engine/RaEngine.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <Engine/Renderer/OpenGL/OpenGL.hpp>
+
+namespace Ra {
+namespace Engine {
+
+/**
+ * Accounting of the memory allocated by the OpenGL objects of the engine : vertex and index
+ * buffers of the meshes, textures, renderers' framebuffer attachments and other buffers.
+ * Each resource is identified by the address of the object owning it, and reports its size
+ * each time it (re)allocates its storage.
+ *
+ * Resources registered with an eviction function can be moved out of the GPU when the
+ * memory used exceeds the budget : enforceBudget() evicts the least recently used ones
+ * which were not used during the current frame, i.e. which belong to hidden or culled
+ * objects. They are restored by their owner the next time they are used (see markUsed()).
+ *
+ * The sizes are the ones requested to OpenGL, drivers may allocate a bit more (e.g. for
+ * alignment).
+ */
+class RA_ENGINE_API GpuMemoryTracker {
+  public:
+    /// Category of a resource.
+    enum ResourceType : uint {
+        RESOURCE_MESH = 0,       /// Vertex and index buffers of the meshes.
+        RESOURCE_TEXTURE,        /// Textures managed by the TextureManager.
+        RESOURCE_RENDER_TARGET,  /// Other textures, e.g. the renderers' framebuffer attachments.
+        RESOURCE_BUFFER,         /// Other buffers, e.g. pixel transfer buffers.
+
+        MAX_RESOURCE
+    };
+
+    /// Memory used by the resources of a category.
+    struct Usage {
+        std::size_t m_residentSize{0}; ///< Bytes allocated on the GPU.
+        std::size_t m_evictedSize{0};  ///< Bytes of the evicted resources.
+        uint m_numResources{0};
+        uint m_numEvicted{0};
+    };
+
+    /// State of a resource, see getResources().
+    struct ResourceInfo {
+        std::string m_name;
+        ResourceType m_type;
+        std::size_t m_size;
+        bool m_evicted;
+        uint m_lastUse; ///< Last frame the resource has been used.
+    };
+
+    /// Set the size of a resource, registering it if needed.
+    /// A resource reporting its size is resident.
+    static void setSize( const void* resource, ResourceType type, const std::string& name,
+                         std::size_t size );
+
+    /// Unregister a resource whose OpenGL storage has been deleted.
+    static void release( const void* resource );
+
+    /// Allow the eviction of a resource by the budget policy. evict() must free its GPU
+    /// storage and call setEvicted(), it is called with the OpenGL context bound.
+    static void setEvictable( const void* resource, std::function<void()> evict );
+
+    /// Mark a resource as evicted : its storage has been moved to the CPU memory.
+    static void setEvicted( const void* resource );
+
+    /// Mark a resource as used during the current frame, so that it is not evicted.
+    static void markUsed( const void* resource );
+
+    /// Start a new frame. Called by the renderer.
+    static void newFrame();
+
+    /// Set the number of bytes the tracked resources should fit in, 0 to disable eviction.
+    static void setBudget( std::size_t bytes );
+    static std::size_t getBudget();
+
+    /// Evict the least recently used evictable resources, until the resident ones fit in
+    /// the budget or no unused resource is left. Called by the renderer at the end of each
+    /// frame, with the OpenGL context bound. Returns the number of evicted bytes.
+    static std::size_t enforceBudget();
+
+    /// Memory used by each category of resources.
+    static std::array<Usage, MAX_RESOURCE> getUsage();
+
+    /// Bytes allocated on the GPU by all the resources.
+    static std::size_t getResidentSize();
+
+    static std::vector<ResourceInfo> getResources();
+
+    /// Human readable name of a category.
+    static const char* getTypeName( ResourceType type );
+
+    /// Bytes per texel of an uncompressed texture internal format.
+    static std::size_t getTexelSize( GLenum internalFormat );
+
+    /// Bytes per pixel of client pixel data of the given format and type.
+    static std::size_t getPixelSize( GLenum format, GLenum type );
+};
+
+} // namespace Engine
+} // namespace Ra
+
+#endif // RADIUMENGINE_GPUMEMORYTRACKER_HPP
@@ -2,7 +2,6 @@
 
 #include <Engine/RadiumEngine.hpp>
 
-#include <Core/Geometry/MeshUtils.hpp>
 #include <Engine/Component/Component.hpp>
 #include <Engine/Renderer/Material/Material.hpp>
 #include <Engine/Renderer/Mesh/Mesh.hpp>
@@ -22,12 +21,16 @@ RenderObject::RenderObject( const std::string& name, Component* comp, const Rend
                             int lifetime ) :
     Core::Container::IndexedObject(),
     m_localTransform( Core::Math::Transform::Identity() ),
+    m_worldAabbTransform( Core::Math::Transform::Identity() ),
     m_component( comp ),
     m_name( name ),
+    m_transformStore( nullptr ),
+    m_transformNode( TransformStore::InvalidNode ),
     m_type( type ),
     m_renderTechnique( nullptr ),
     m_mesh( nullptr ),
     m_lifetime( lifetime ),
+    m_lod( 0 ),
     m_visible( true ),
     m_pickable( true ),
     m_xray( false ),
@@ -35,7 +38,12 @@ RenderObject::RenderObject( const std::string& name, Component* comp, const Rend
     m_dirty( true ),
     m_hasLifetime( lifetime > 0 ) {}
 
-RenderObject::~RenderObject() {}
+RenderObject::~RenderObject() {
+    if ( m_mesh )
+    {
+        m_mesh->detachRenderObject( this );
+    }
+}
 
 RenderObject* RenderObject::createRenderObject( const std::string& name, Component* comp,
                                                 const RenderObjectType& type,
@@ -62,6 +70,9 @@ void RenderObject::updateGL() {
     // Do not update while we are cloning
     std::lock_guard<std::mutex> lock( m_updateMutex );
 
+    // Cleared first : a change made during the update is sent at the next frame.
+    m_dirty = false;
+
     if ( m_renderTechnique )
     {
         m_renderTechnique->updateGL();
@@ -71,8 +82,6 @@ void RenderObject::updateGL() {
     {
         m_mesh->updateGL();
     }
-
-    m_dirty = false;
 }
 
 const RenderObjectType& RenderObject::getType() const {
@@ -90,10 +99,14 @@ const std::string& RenderObject::getName() const {
 
 void RenderObject::setVisible( bool visible ) {
     m_visible = visible;
+    if ( idx.isValid() )
+    {
+        RadiumEngine::getInstance()->getRenderObjectManager()->setSceneAabbDirty( idx );
+    }
 }
 
 void RenderObject::toggleVisible() {
-    m_visible = !m_visible;
+    setVisible( !m_visible );
 }
 
 bool RenderObject::isVisible() const {
@@ -136,10 +149,26 @@ bool RenderObject::isTransparent() const {
     return m_transparent;
 }
 
+void RenderObject::setLod( uint level ) {
+    m_lod = level;
+}
+
+uint RenderObject::getLod() const {
+    return m_lod;
+}
+
 bool RenderObject::isDirty() const {
     return m_dirty;
 }
 
+void RenderObject::setDirty() {
+    // Objects not yet added to the manager are dirty, and added to the dirty set with them.
+    if ( !m_dirty.exchange( true ) )
+    {
+        RadiumEngine::getInstance()->getRenderObjectManager()->setDirty( idx );
+    }
+}
+
 const Component* RenderObject::getComponent() const {
     return m_component;
 }
@@ -151,6 +180,7 @@ Component* RenderObject::getComponent() {
 void RenderObject::setRenderTechnique( const std::shared_ptr<RenderTechnique>& technique ) {
     CORE_ASSERT( technique, "Passing a nullptr as render technique" );
     m_renderTechnique = technique;
+    setDirty();
 }
 
 std::shared_ptr<const RenderTechnique> RenderObject::getRenderTechnique() const {
@@ -162,7 +192,16 @@ std::shared_ptr<RenderTechnique> RenderObject::getRenderTechnique() {
 }
 
 void RenderObject::setMesh( const std::shared_ptr<Mesh>& mesh ) {
+    if ( m_mesh )
+    {
+        m_mesh->detachRenderObject( this );
+    }
     m_mesh = mesh;
+    if ( m_mesh )
+    {
+        m_mesh->attachRenderObject( this );
+    }
+    setDirty();
 }
 
 std::shared_ptr<const Mesh> RenderObject::getMesh() const {
@@ -174,35 +213,80 @@ const std::shared_ptr<Mesh>& RenderObject::getMesh() {
 }
 
 Core::Math::Transform RenderObject::getTransform() const {
-    return m_component->getEntity()->getTransform() * m_localTransform;
+    return Core::Math::Transform( getTransformAsMatrix() );
 }
 
 Core::Math::Matrix4 RenderObject::getTransformAsMatrix() const {
-    return getTransform().matrix();
+    if ( m_transformStore != nullptr )
+    {
+        return m_transformStore->getWorldMatrix( m_transformNode );
+    }
+    return ( m_component->getEntity()->getTransform() * m_localTransform ).matrix();
 }
 
-Core::Math::Aabb RenderObject::getAabb() const {
-    Core::Math::Aabb aabb = Core::Geometry::getAabb( m_mesh->getGeometry() );
-    Core::Math::Aabb result;
+Core::Math::Matrix4 RenderObject::getNormalMatrix() const {
+    if ( m_transformStore != nullptr )
+    {
+        return m_transformStore->getNormalMatrix( m_transformNode );
+    }
+    return getTransformAsMatrix().inverse().transpose();
+}
 
-    for ( int i = 0; i < 8; ++i )
+Core::Math::Aabb RenderObject::getAabb() const {
+    const Core::Math::Aabb aabb = m_mesh->getAabb();
+    const Core::Math::Transform tr = getTransform();
+
+    // Both members start as an empty box / identity, so a mesh without vertices
+    // correctly yields an empty world box without any computation.
+    if ( ( aabb.min() != m_worldAabbMeshAabb.min() ) ||
+         ( aabb.max() != m_worldAabbMeshAabb.max() ) ||
+         ( tr.matrix() != m_worldAabbTransform.matrix() ) )
     {
-        result.extend( getTransform() * aabb.corner( (Core::Math::Aabb::CornerType)i ) );
+        m_worldAabb.setEmpty();
+        for ( int i = 0; i < 8; ++i )
+        {
+            m_worldAabb.extend( tr * aabb.corner( (Core::Math::Aabb::CornerType)i ) );
+        }
+        m_worldAabbMeshAabb = aabb;
+        m_worldAabbTransform = tr;
     }
 
-    return result;
+    return m_worldAabb;
 }
 
 Core::Math::Aabb RenderObject::getMeshAabb() const {
-    return Core::Geometry::getAabb( m_mesh->getGeometry() );
+    return m_mesh->getAabb();
 }
 
 void RenderObject::setLocalTransform( const Core::Math::Transform& transform ) {
     m_localTransform = transform;
+    if ( m_transformStore != nullptr )
+    {
+        m_transformStore->setLocalTransform( m_transformNode, m_localTransform );
+    }
 }
 
 void RenderObject::setLocalTransform( const Core::Math::Matrix4& transform ) {
-    m_localTransform = Core::Math::Transform( transform );
+    setLocalTransform( Core::Math::Transform( transform ) );
+}
+
+void RenderObject::attachTransform( TransformStore* store, TransformStore::NodeIdx parent ) {
+    CORE_ASSERT( m_transformStore == nullptr, "Render object already attached" );
+    m_transformStore = store;
+    m_transformNode = m_transformStore->addNode( m_localTransform, parent );
+}
+
+void RenderObject::detachTransform() {
+    if ( m_transformStore != nullptr )
+    {
+        m_transformStore->removeNode( m_transformNode );
+        m_transformStore = nullptr;
+        m_transformNode = TransformStore::InvalidNode;
+    }
+}
+
+TransformStore::NodeIdx RenderObject::getTransformNode() const {
+    return m_transformNode;
 }
 
 const Core::Math::Transform& RenderObject::getLocalTransform() const {
@@ -237,7 +321,7 @@ void RenderObject::render( const RenderParameters& lightParams, const RenderData
         }
 
         Core::Math::Matrix4 M = getTransformAsMatrix();
-        Core::Math::Matrix4 N = M.inverse().transpose();
+        Core::Math::Matrix4 N = getNormalMatrix();
 
         // bind data
         shader->bind();
@@ -250,7 +334,7 @@ void RenderObject::render( const RenderParameters& lightParams, const RenderData
         m_renderTechnique->getMaterial()->bind( shader );
 
         // render
-        getMesh()->render();
+        getMesh()->render( m_lod );
     }
 }
 
@@ -3,6 +3,7 @@
 
 #include <Engine/RaEngine.hpp>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -10,6 +11,7 @@
 #include <Core/Container/IndexedObject.hpp>
 #include <Core/Math/LinearAlgebra.hpp>
 
+#include <Engine/Managers/EntityManager/TransformStore.hpp>
 #include <Engine/Renderer/RenderObject/RenderObjectTypes.hpp>
 #include <Engine/Renderer/RenderTechnique/RenderTechnique.hpp>
 
@@ -66,7 +68,8 @@ class RA_ENGINE_API RenderObject final : public Core::Container::IndexedObject {
         const RenderTechnique& techniqueConfig = RenderTechnique::createDefaultRenderTechnique(),
         const std::shared_ptr<Material>& material = nullptr );
 
-    // FIXME(Charly): Remove this
+    /// Update the OpenGL data of the technique and the mesh.
+    /// Only called by the renderer on the render objects marked dirty.
     void updateGL();
 
     //
@@ -79,6 +82,7 @@ class RA_ENGINE_API RenderObject final : public Core::Container::IndexedObject {
     const RenderObjectType& getType() const;
     void setType( const RenderObjectType& t );
 
+    /// The visibility changes update the scene box, see RenderObjectManager::updateSceneAabb().
     void setVisible( bool visible );
     void toggleVisible();
     bool isVisible() const;
@@ -97,6 +101,12 @@ class RA_ENGINE_API RenderObject final : public Core::Container::IndexedObject {
 
     bool isDirty() const;
 
+    /// Mark the object as needing an update of its OpenGL data at the next frame.
+    /// Changes of the mesh data (see Mesh::setDirty()), of the mesh and of the technique mark
+    /// the object dirty, but in place changes of its technique or material need this call.
+    /// Thread safe.
+    void setDirty();
+
     void setRenderTechnique( const std::shared_ptr<RenderTechnique>& technique );
     std::shared_ptr<const RenderTechnique> getRenderTechnique() const;
     std::shared_ptr<RenderTechnique> getRenderTechnique();
@@ -105,17 +115,46 @@ class RA_ENGINE_API RenderObject final : public Core::Container::IndexedObject {
     std::shared_ptr<const Mesh> getMesh() const;
     const std::shared_ptr<Mesh>& getMesh();
 
+    /// Level of detail of the mesh to draw (see Mesh::render()), chosen by the renderer
+    /// for each frame. The picking always uses the full resolution mesh.
+    void setLod( uint level );
+    uint getLod() const;
+
+    /// World transform of the object (entity transform * local transform).
+    /// Once the object is attached to the transform hierarchy (see attachTransform()),
+    /// these are precomputed at the end of each frame and read without lock.
     Core::Math::Transform getTransform() const;
     Core::Math::Matrix4 getTransformAsMatrix() const;
 
+    /// Transpose of the inverse of getTransformAsMatrix(), to transform normals.
+    Core::Math::Matrix4 getNormalMatrix() const;
+
+    /// Returns the bounding box of the object in world space.
+    /// The box is cached and only updated when the mesh bounding box or the
+    /// world transform (entity and local transforms) changed since the last call.
     Core::Math::Aabb getAabb() const;
+
+    /// Returns the bounding box of the mesh in mesh space (see Mesh::getAabb()).
     Core::Math::Aabb getMeshAabb() const;
 
+    /// Set the local transform of the object. When the object is attached to the
+    /// transform hierarchy, the world transform is updated at the next buffer swap.
     void setLocalTransform( const Core::Math::Transform& transform );
     void setLocalTransform( const Core::Math::Matrix4& transform );
     const Core::Math::Transform& getLocalTransform() const;
     const Core::Math::Matrix4& getLocalTransformAsMatrix() const;
 
+    /// Add the object to the transform hierarchy \p store, below the node \p parent.
+    /// Called by the RenderObjectManager when the object is added.
+    void attachTransform( TransformStore* store, TransformStore::NodeIdx parent );
+
+    /// Remove the object from the transform hierarchy.
+    /// Called by the RenderObjectManager when the object is removed.
+    void detachTransform();
+
+    /// Node of the object in the transform hierarchy, TransformStore::InvalidNode if detached.
+    TransformStore::NodeIdx getTransformNode() const;
+
     /// Basically just decreases lifetime counter.
     /// If it goes to zero, then render object notifies the manager that it needs to be deleted.
     /// Does nothing if lifetime is set to -1
@@ -131,9 +170,17 @@ class RA_ENGINE_API RenderObject final : public Core::Container::IndexedObject {
   private:
     Core::Math::Transform m_localTransform;
 
+    /// World transform and mesh box m_worldAabb has been computed from.
+    mutable Core::Math::Transform m_worldAabbTransform;
+    mutable Core::Math::Aabb m_worldAabbMeshAabb;
+    mutable Core::Math::Aabb m_worldAabb;
+
     Component* m_component;
     std::string m_name;
 
+    TransformStore* m_transformStore;
+    TransformStore::NodeIdx m_transformNode;
+
     RenderObjectType m_type;
     std::shared_ptr<RenderTechnique> m_renderTechnique;
     std::shared_ptr<Mesh> m_mesh;
@@ -141,12 +188,13 @@ class RA_ENGINE_API RenderObject final : public Core::Container::IndexedObject {
     mutable std::mutex m_updateMutex;
 
     int m_lifetime;
+    uint m_lod;
 
     bool m_visible;
     bool m_pickable;
     bool m_xray;
     bool m_transparent;
-    bool m_dirty;
+    std::atomic<bool> m_dirty; /// True if the object is in the dirty set of the manager.
     bool m_hasLifetime;
 };
 
@@ -4,6 +4,7 @@
 
 #include <Engine/Component/Component.hpp>
 #include <Engine/Entity/Entity.hpp>
+#include <Engine/Managers/EntityManager/EntityManager.hpp>
 
 #include <Engine/Managers/SystemDisplay/SystemDisplay.hpp>
 #include <Engine/Renderer/Mesh/Mesh.hpp>
@@ -13,7 +14,17 @@
 
 namespace Ra {
 namespace Engine {
-RenderObjectManager::RenderObjectManager() {}
+
+namespace {
+// Returns true if the box does not touch the border of the scene box, so that it cannot
+// shrink it.
+bool isInsideScene( const Core::Math::Aabb& box, const Core::Math::Aabb& scene ) {
+    return ( box.min().array() > scene.min().array() ).all() &&
+           ( box.max().array() < scene.max().array() ).all();
+}
+} // namespace
+
+RenderObjectManager::RenderObjectManager() : m_isSceneAabbValid( false ) {}
 
 RenderObjectManager::~RenderObjectManager() {}
 
@@ -30,10 +41,26 @@ Core::Container::Index RenderObjectManager::addRenderObject( RenderObject* rende
 
     newRenderObject->idx = index;
 
+    Entity* entity = renderObject->getComponent()->getEntity();
+    if ( entity->getTransformStore() != nullptr )
+    {
+        newRenderObject->attachTransform( entity->getTransformStore(),
+                                          entity->getTransformNode() );
+        const TransformStore::NodeIdx node = newRenderObject->getTransformNode();
+        if ( node >= m_nodeRenderObjects.size() )
+        {
+            m_nodeRenderObjects.resize( node + 1 );
+        }
+        m_nodeRenderObjects[node] = index;
+    }
+
     auto type = renderObject->getType();
 
     m_renderObjectByType[(int)type].insert( index );
 
+    // New objects always need to be sent to the GPU.
+    setDirty( index );
+
     Engine::RadiumEngine::getInstance()->getSignalManager()->fireRenderObjectAdded( ItemEntry(
         renderObject->getComponent()->getEntity(), renderObject->getComponent(), index ) );
     return index;
@@ -54,6 +81,12 @@ void RenderObjectManager::removeRenderObject( const Core::Container::Index& inde
 
     auto type = renderObject->getType();
     m_renderObjectByType[(int)type].erase( index );
+    removeSceneAabb( index );
+    if ( renderObject->getTransformNode() != TransformStore::InvalidNode )
+    {
+        m_nodeRenderObjects[renderObject->getTransformNode()] = Core::Container::Index();
+    }
+    renderObject->detachTransform();
     renderObject.reset();
 }
 
@@ -98,11 +131,53 @@ void RenderObjectManager::renderObjectExpired( const Core::Container::Index& idx
 
     m_renderObjectByType[(int)type].erase( idx );
 
+    removeSceneAabb( idx );
+    if ( ro->getTransformNode() != TransformStore::InvalidNode )
+    {
+        m_nodeRenderObjects[ro->getTransformNode()] = Core::Container::Index();
+    }
+    ro->detachTransform();
     ro->hasExpired();
 
     ro.reset();
 }
 
+void RenderObjectManager::setDirty( const Core::Container::Index& index ) {
+    {
+        std::lock_guard<std::mutex> lock( m_dirtyMutex );
+        m_dirtyRenderObjects.push_back( index );
+    }
+    // The mesh of the object may have changed.
+    setSceneAabbDirty( index );
+}
+
+void RenderObjectManager::setAllDirty() {
+    std::lock_guard<std::mutex> lock( m_doubleBufferMutex );
+    for ( const auto& ro : m_renderObjects )
+    {
+        ro->setDirty();
+    }
+}
+
+void RenderObjectManager::getDirtyRenderObjects(
+    std::vector<std::shared_ptr<RenderObject>>& objectsOut ) {
+    std::vector<Core::Container::Index> dirty;
+    {
+        std::lock_guard<std::mutex> lock( m_dirtyMutex );
+        std::swap( dirty, m_dirtyRenderObjects );
+    }
+
+    // Objects removed since they were marked are skipped.
+    std::lock_guard<std::mutex> lock( m_doubleBufferMutex );
+    for ( const auto& idx : dirty )
+    {
+        if ( m_renderObjects.contains( idx ) )
+        {
+            objectsOut.push_back( m_renderObjects.at( idx ) );
+        }
+    }
+}
+
 uint RenderObjectManager::getNumFaces() const {
     uint result = 0;
     for ( const auto& ro : m_renderObjects )
@@ -127,31 +202,89 @@ uint RenderObjectManager::getNumVertices() const {
     return result;
 }
 
+void RenderObjectManager::setSceneAabbDirty( const Core::Container::Index& index ) {
+    std::lock_guard<std::mutex> lock( m_sceneAabbMutex );
+    m_sceneAabbDirty.insert( index );
+}
+
+void RenderObjectManager::removeSceneAabb( const Core::Container::Index& index ) {
+    std::lock_guard<std::mutex> lock( m_sceneAabbMutex );
+    m_sceneAabbDirty.erase( index );
+    auto it = m_sceneAabbs.find( index );
+    if ( it == m_sceneAabbs.end() )
+    {
+        return;
+    }
+    if ( !it->second.isEmpty() && !isInsideScene( it->second, m_sceneAabb ) )
+    {
+        m_isSceneAabbValid = false;
+    }
+    m_sceneAabbs.erase( it );
+}
+
 Core::Math::Aabb RenderObjectManager::getSceneAabb() const {
-    using Ra::Core::Math::Transform;
-    Core::Math::Aabb aabb;
+    std::lock_guard<std::mutex> lock( m_sceneAabbMutex );
+    return m_sceneAabb;
+}
+
+void RenderObjectManager::updateSceneAabb() {
+    std::lock_guard<std::mutex> lock( m_doubleBufferMutex );
+    std::lock_guard<std::mutex> sceneLock( m_sceneAabbMutex );
+
+    // The objects whose box may have changed : modified, shown or hidden, or moved.
+    std::set<Core::Container::Index> dirty;
+    std::swap( dirty, m_sceneAabbDirty );
+    std::vector<TransformStore::NodeIdx> movedNodes;
+    RadiumEngine::getInstance()->getEntityManager()->getTransformStore()->getMovedNodes(
+        movedNodes );
+    for ( const auto& node : movedNodes )
+    {
+        // The entity nodes have no render object, their render objects moved with them.
+        if ( node < m_nodeRenderObjects.size() && m_nodeRenderObjects[node].isValid() )
+        {
+            dirty.insert( m_nodeRenderObjects[node] );
+        }
+    }
 
     const auto& systemEntity = Engine::SystemEntity::getInstance();
-    const auto& comps = systemEntity->getComponents();
-    uint nUiRO = 0;
-    std::for_each( comps.begin(), comps.end(),
-                   [&nUiRO]( const auto& c ) { nUiRO += c->m_renderObjects.size(); } );
-    if ( m_renderObjects.size() == nUiRO )
-        return aabb;
-
-    for ( auto ro : m_renderObjects )
+    auto getBox = [&systemEntity]( const RenderObject& ro ) {
+        return ro.isVisible() && ro.getComponent()->getEntity() != systemEntity
+                   ? ro.getAabb()
+                   : Core::Math::Aabb();
+    };
+
+    if ( m_isSceneAabbValid )
     {
-        auto entity = ro->getComponent()->getEntity();
-        if ( ro->isVisible() && ( entity != systemEntity ) )
+        for ( const auto& idx : dirty )
         {
-            Core::Math::Transform tr = entity->getTransform() * ro->getLocalTransform();
-            for ( const auto& p : ro->getMesh()->getGeometry().m_vertices )
+            if ( !m_renderObjects.contains( idx ) )
             {
-                aabb.extend( tr * p );
+                continue;
             }
+            Core::Math::Aabb& box = m_sceneAabbs[idx];
+            const Core::Math::Aabb newBox = getBox( *m_renderObjects.at( idx ) );
+            if ( !box.isEmpty() && !newBox.contains( box ) && !isInsideScene( box, m_sceneAabb ) )
+            {
+                m_isSceneAabbValid = false;
+                break;
+            }
+            box = newBox;
+            m_sceneAabb.extend( newBox );
+        }
+    }
+
+    if ( !m_isSceneAabbValid )
+    {
+        m_sceneAabb.setEmpty();
+        m_sceneAabbs.clear();
+        for ( const auto& ro : m_renderObjects )
+        {
+            const Core::Math::Aabb box = getBox( *ro );
+            m_sceneAabbs[ro->idx] = box;
+            m_sceneAabb.extend( box );
         }
+        m_isSceneAabbValid = true;
     }
-    return aabb;
 }
 } // namespace Engine
 } // namespace Ra
@@ -4,6 +4,7 @@
 #include <Engine/RaEngine.hpp>
 
 #include <array>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -53,15 +54,64 @@ class RA_ENGINE_API RenderObjectManager final {
     /// Return the total number of vertices drawn
     uint getNumVertices() const;
 
-    /// Return the AABB of all visible render objects
+    /// Return the AABB of all visible render objects, as the union of their boxes (see
+    /// RenderObject::getAabb()), as computed by the last call to updateSceneAabb().
     Core::Math::Aabb getSceneAabb() const;
 
+    /// Update the scene AABB returned by getSceneAabb(). The box is maintained incrementally :
+    /// only the objects added, moved, modified or whose visibility changed since the last call
+    /// are visited, unless an object on the border of the scene moved inwards or was removed.
+    /// Called once per frame by RadiumEngine::endFrameSync(), and by the users which need the
+    /// box of a scene they just changed. Must be called from the main thread, outside of the
+    /// transform buffers swap.
+    void updateSceneAabb();
+
+    /// Mark the box of the render object as changed for updateSceneAabb().
+    /// Thread safe. Called by setDirty() and when the visibility of the object changes,
+    /// the moves are given by the transform hierarchy.
+    void setSceneAabbDirty( const Core::Container::Index& index );
+
+    /// Add the render object to the dirty set, see RenderObject::setDirty().
+    /// Thread safe, so that the tasks of the frame can modify their meshes.
+    void setDirty( const Core::Container::Index& index );
+
+    /// Mark all the render objects as dirty, e.g. when the shaders have been reloaded.
+    void setAllDirty();
+
+    /**
+     * @brief Get the render objects marked dirty since the last call and empty the dirty set.
+     * Only these objects need an update of their OpenGL data (see RenderObject::updateGL()).
+     * @param Empty vector that will receive the dirty render objects
+     */
+    void getDirtyRenderObjects( std::vector<std::shared_ptr<RenderObject>>& objectsOut );
+
   private:
     Core::Container::IndexMap<std::shared_ptr<RenderObject>> m_renderObjects;
 
     std::array<std::set<Core::Container::Index>, (int)RenderObjectType::Count> m_renderObjectByType;
 
     mutable std::mutex m_doubleBufferMutex;
+
+    /// Render objects marked dirty since the last call to getDirtyRenderObjects().
+    /// Each object is added once, see RenderObject::setDirty().
+    std::vector<Core::Container::Index> m_dirtyRenderObjects;
+    std::mutex m_dirtyMutex;
+
+    /// Forget the box of a removed object in the scene box.
+    void removeSceneAabb( const Core::Container::Index& index );
+
+    /// Scene box and box of each render object in it (empty if it is hidden or belongs to the
+    /// system entity). Invalid when it must be computed again from all the objects.
+    Core::Math::Aabb m_sceneAabb;
+    std::map<Core::Container::Index, Core::Math::Aabb> m_sceneAabbs;
+    bool m_isSceneAabbValid;
+
+    /// Render objects whose box changed since the last call to updateSceneAabb().
+    std::set<Core::Container::Index> m_sceneAabbDirty;
+    mutable std::mutex m_sceneAabbMutex;
+
+    /// Render object attached to each transform node, to map the moved nodes to the objects.
+    std::vector<Core::Container::Index> m_nodeRenderObjects;
 };
 
 } // namespace Engine
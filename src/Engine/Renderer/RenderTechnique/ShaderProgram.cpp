@@ -2,13 +2,18 @@
 
 #include <globjects/NamedString.h>
 #include <globjects/Program.h>
+#include <globjects/ProgramBinary.h>
 #include <globjects/Shader.h>
 #include <globjects/Texture.h>
 
 #include <globjects/base/File.h>
 #include <globjects/base/StaticStringSource.h>
 
-#include <regex>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
 
 #ifdef OS_WINDOWS
 #    include <direct.h>
@@ -27,6 +32,60 @@
 namespace Ra {
 namespace Engine {
 
+namespace {
+// Named strings with their includes expanded, shared by all the programs.
+// Only accessed from the thread owning the OpenGL context.
+std::unordered_map<std::string, std::string> s_expandedIncludes;
+
+// 64 bits FNV-1a hash, which unlike std::hash is stable across runs and platforms.
+const uint64_t s_hashSeed = 14695981039346656037ull;
+void hashString( uint64_t& hash, const std::string& str ) {
+    for ( unsigned char c : str )
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+}
+
+// Checks if the line [begin, end) of the shader is an include directive, and gives the
+// name of the included file.
+bool parseInclude( const std::string& shader, size_t begin, size_t end, std::string& includeName ) {
+    static const std::string directive = "include";
+    auto skipSpaces = [&shader, end]( size_t i ) {
+        while ( i < end && ( shader[i] == ' ' || shader[i] == '\t' ) )
+        {
+            ++i;
+        }
+        return i;
+    };
+
+    size_t i = skipSpaces( begin );
+    if ( i >= end || shader[i] != '#' )
+    {
+        return false;
+    }
+    i = skipSpaces( i + 1 );
+    if ( i + directive.size() >= end || shader.compare( i, directive.size(), directive ) != 0 )
+    {
+        return false;
+    }
+    i += directive.size();
+    const size_t nameStart = skipSpaces( i );
+    if ( nameStart == i || nameStart >= end ||
+         ( shader[nameStart] != '"' && shader[nameStart] != '<' ) )
+    {
+        return false;
+    }
+    const size_t nameEnd = shader.find_first_of( "\">", nameStart + 1 );
+    if ( nameEnd >= end )
+    {
+        return false;
+    }
+    includeName = shader.substr( nameStart + 1, nameEnd - nameStart - 1 );
+    return true;
+}
+} // namespace
+
 ShaderProgram::ShaderProgram() : m_program( nullptr ) {
     for ( uint i = 0; i < m_shaderObjects.size(); ++i )
     {
@@ -34,13 +93,17 @@ ShaderProgram::ShaderProgram() : m_program( nullptr ) {
     }
 }
 
-ShaderProgram::ShaderProgram( const ShaderConfiguration& config ) : ShaderProgram() {
+ShaderProgram::ShaderProgram( const ShaderConfiguration& config,
+                              const std::string& binaryCacheDirectory ) :
+    ShaderProgram() {
+    m_binaryCacheDirectory = binaryCacheDirectory;
     load( config );
 }
 
 ShaderProgram::~ShaderProgram() {}
 
-void ShaderProgram::loadShader( ShaderType type, const std::string& name,
+std::string
+ShaderProgram::getShaderSource( ShaderType type, const std::string& name,
                                 const std::set<std::string>& props,
                                 const std::vector<std::pair<std::string, ShaderType>>& includes,
                                 const std::string& version ) {
@@ -48,7 +111,7 @@ void ShaderProgram::loadShader( ShaderType type, const std::string& name,
     if ( type == ShaderType_COMPUTE )
     {
         LOG( Core::Utils::logERROR ) << "No compute shader on OsX <= El Capitan";
-        return;
+        return std::string();
     }
 #endif
     // FIXME : --> for the moment : standard includepaths. Might be controlled per shader ...
@@ -93,13 +156,16 @@ void ShaderProgram::loadShader( ShaderType type, const std::string& name,
     // FIXME Where are defined the global replacement?
     auto shaderSource = globjects::Shader::applyGlobalReplacements( fullsource.get() );
 
+    // Workaround globject #include bug ...
+    return preprocessIncludes( name, shaderSource->string(), 0 );
+}
+
+void ShaderProgram::loadShader( ShaderType type, const std::string& name,
+                                const std::string& source ) {
     auto shader = globjects::Shader::create( getTypeAsGLEnum( type ) );
     shader->setIncludePaths( {std::string( "/" )} );
 
-    // Workaround globject #include bug ...
-    std::string preprocessedSource = preprocessIncludes( name, shaderSource->string(), 0 );
-
-    auto ptrSource = globjects::Shader::sourceFromString( preprocessedSource );
+    auto ptrSource = globjects::Shader::sourceFromString( source );
 
     shader->setSource( ptrSource.get() );
 
@@ -171,18 +237,139 @@ void ShaderProgram::load( const ShaderConfiguration& shaderConfig ) {
 
     m_program = globjects::Program::create();
 
+    build();
+}
+
+void ShaderProgram::build() {
+    // Release the previous shaders and binary, if any.
+    for ( auto& shader : m_shaderObjects )
+    {
+        if ( shader != nullptr )
+        {
+            m_program->detach( shader.get() );
+            shader.reset();
+        }
+    }
+    m_program->setBinary( nullptr );
+    m_binary.reset();
+
+    std::array<std::string, ShaderType_COUNT> sources;
     for ( size_t i = 0; i < ShaderType_COUNT; ++i )
     {
         if ( m_configuration.m_shaders[i] != "" )
         {
             LOG( Core::Utils::logDEBUG ) << "Loading shader " << m_configuration.m_shaders[i];
-            loadShader( ShaderType( i ), m_configuration.m_shaders[i],
-                        m_configuration.getProperties(), m_configuration.getIncludes(),
-                        m_configuration.m_version );
+            sources[i] = getShaderSource( ShaderType( i ), m_configuration.m_shaders[i],
+                                          m_configuration.getProperties(),
+                                          m_configuration.getIncludes(), m_configuration.m_version );
+        }
+    }
+
+    const std::string cacheFile = getBinaryCacheFile( sources );
+    if ( !cacheFile.empty() && loadBinary( cacheFile ) )
+    {
+        LOG( Core::Utils::logDEBUG ) << "Program " << m_configuration.m_name
+                                     << " loaded from binary cache.";
+        return;
+    }
+
+    for ( size_t i = 0; i < ShaderType_COUNT; ++i )
+    {
+        if ( !sources[i].empty() )
+        {
+            loadShader( ShaderType( i ), m_configuration.m_shaders[i], sources[i] );
         }
     }
 
     link();
+
+    if ( !cacheFile.empty() && m_program->isLinked() )
+    {
+        saveBinary( cacheFile );
+    }
+}
+
+std::string ShaderProgram::getBinaryCacheFile(
+    const std::array<std::string, ShaderType_COUNT>& sources ) const {
+    if ( m_binaryCacheDirectory.empty() )
+    {
+        return std::string();
+    }
+
+    // Program binaries are only valid for the driver which produced them.
+    uint64_t hash = s_hashSeed;
+    for ( GLenum param : {GL_VENDOR, GL_RENDERER, GL_VERSION} )
+    {
+        const GLubyte* str = glGetString( param );
+        if ( str != nullptr )
+        {
+            hashString( hash, reinterpret_cast<const char*>( str ) );
+        }
+    }
+    for ( size_t i = 0; i < sources.size(); ++i )
+    {
+        hashString( hash, std::to_string( i ) + ":" + std::to_string( sources[i].size() ) );
+        hashString( hash, sources[i] );
+    }
+
+    char name[17];
+    std::snprintf( name, sizeof( name ), "%016llx", static_cast<unsigned long long>( hash ) );
+    return m_binaryCacheDirectory + "/" + name + ".bin";
+}
+
+bool ShaderProgram::loadBinary( const std::string& file ) {
+    std::ifstream input( file, std::ios::binary );
+    uint32_t format = 0;
+    if ( !input || !input.read( reinterpret_cast<char*>( &format ), sizeof( format ) ) )
+    {
+        return false;
+    }
+    const std::vector<char> data( ( std::istreambuf_iterator<char>( input ) ),
+                                  std::istreambuf_iterator<char>() );
+    if ( data.empty() )
+    {
+        return false;
+    }
+
+    m_binary = globjects::ProgramBinary::create( static_cast<GLenum>( format ), data );
+    m_program->setParameter( GL_PROGRAM_SEPARABLE, GL_TRUE );
+    m_program->setBinary( m_binary.get() );
+    m_program->link();
+    // An unsupported binary format is reported as an error, ignore it and compile instead.
+    glFlushError();
+
+    if ( !m_program->isLinked() )
+    {
+        // The binary has been rejected (e.g. after a driver update).
+        m_program->setBinary( nullptr );
+        m_binary.reset();
+        return false;
+    }
+    return true;
+}
+
+void ShaderProgram::saveBinary( const std::string& file ) const {
+    auto binary = m_program->getBinary();
+    if ( binary == nullptr || binary->length() <= 0 )
+    {
+        return;
+    }
+
+    // Write in a temporary file first, so that other instances never read a partial binary.
+    const std::string tmpFile = file + ".tmp";
+    {
+        std::ofstream output( tmpFile, std::ios::binary );
+        const uint32_t format = static_cast<uint32_t>( binary->format() );
+        output.write( reinterpret_cast<const char*>( &format ), sizeof( format ) );
+        output.write( static_cast<const char*>( binary->data() ), binary->length() );
+        if ( !output )
+        {
+            LOG( Core::Utils::logWARNING ) << "Cannot write program binary " << tmpFile;
+            return;
+        }
+    }
+    std::remove( file.c_str() );
+    std::rename( tmpFile.c_str(), file.c_str() );
 }
 
 void ShaderProgram::link() {
@@ -195,6 +382,10 @@ void ShaderProgram::link() {
     }
 
     m_program->setParameter( GL_PROGRAM_SEPARABLE, GL_TRUE );
+    if ( !m_binaryCacheDirectory.empty() )
+    {
+        m_program->setParameter( GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+    }
 
     m_program->link();
     GL_CHECK_ERROR;
@@ -217,19 +408,8 @@ void ShaderProgram::unbind() const {
 }
 
 void ShaderProgram::reload() {
-    for ( unsigned int i = 0; i < m_shaderObjects.size(); ++i )
-    {
-        if ( m_shaderObjects[i] != nullptr )
-        {
-            LOG( Core::Utils::logDEBUG ) << "Reloading shader " << m_shaderObjects[i]->name();
-
-            m_program->detach( m_shaderObjects[i].get() );
-            loadShader( getGLenumAsType( m_shaderObjects[i]->type() ), m_shaderObjects[i]->name(),
-                        m_configuration.getProperties(), m_configuration.getIncludes() );
-        }
-    }
-
-    link();
+    LOG( Core::Utils::logDEBUG ) << "Reloading program " << m_configuration.m_name;
+    build();
 }
 
 ShaderConfiguration ShaderProgram::getBasicConfiguration() const {
@@ -352,70 +532,64 @@ std::string ShaderProgram::preprocessIncludes( const std::string& name, const st
                                                int level, int line ) {
     CORE_ERROR_IF( level < 32, "Shader inclusion depth limit reached." );
 
-    std::string result = "";
-    std::vector<std::string> finalStrings;
-    auto shaderLines = Core::Utils::splitString( shader, '\n' );
-    finalStrings.reserve( shaderLines.size() );
+    std::string result;
+    result.reserve( shader.size() );
 
     uint nline = 0;
-
-    static const std::regex reg( "^[ ]*#[ ]*include[ ]+[\"<](.*)[\">].*" );
-
-    for ( const auto& l : shaderLines )
+    std::string includeName;
+    for ( size_t begin = 0; begin < shader.size(); )
     {
-        std::string line = l;
-        std::smatch match;
-        if ( std::regex_search( l, match, reg ) )
+        size_t end = shader.find( '\n', begin );
+        if ( end == std::string::npos )
         {
-            // FIXME : use the includePaths set elsewhere.
-            auto includeNameString =
-                globjects::NamedString::getFromRegistry( std::string( "/" ) + match[1].str() );
-            if ( includeNameString != nullptr )
-            {
-
-                line =
-                    preprocessIncludes( match[1].str(), includeNameString->string(), level + 1, 0 );
+            end = shader.size();
+        }
 
+        if ( parseInclude( shader, begin, end, includeName ) )
+        {
+            const std::string* include = getExpandedInclude( includeName, level + 1 );
+            if ( include != nullptr )
+            {
+                result.append( *include );
             } else
             {
-                LOG( Core::Utils::logWARNING ) << "Cannot open included file " << match[1].str() << " at line"
-                                  << nline << " of file " << name << ". Ignored.";
+                LOG( Core::Utils::logWARNING ) << "Cannot open included file " << includeName
+                                               << " at line" << nline << " of file " << name
+                                               << ". Ignored.";
+                begin = end + 1;
                 continue;
             }
-            /*
-             std::string inc;
-             std::string file = m_filepath + match[1].str();
-             if (parseFile(file, inc))
-             {
-             sublerr.start = nline;
-             sublerr.name  = file;
-             lerr.subfiles.push_back(sublerr);
-
-             line  = preprocessIncludes(inc, level + 1, lerr.subfiles.back());
-             nline = lerr.subfiles.back().end;
-             }
-             else
-             {
-             LOG(Core::Utils::logWARNING) << "Cannot open included file " << file << " from " << m_filename << ".
-             Ignored."; continue;
-             }
-             */
-        }
+        } else
+        { result.append( shader, begin, end - begin ); }
+        result.append( "\n" );
 
-        finalStrings.push_back( line );
         ++nline;
+        begin = end + 1;
     }
 
-    // Build final shader string
-    for ( const auto& l : finalStrings )
+    return result;
+}
+
+const std::string* ShaderProgram::getExpandedInclude( const std::string& name, int level ) {
+    auto found = s_expandedIncludes.find( name );
+    if ( found != s_expandedIncludes.end() )
     {
-        result.append( l );
-        result.append( "\n" );
+        return &found->second;
+    }
+
+    // FIXME : use the includePaths set elsewhere.
+    auto includeNameString = globjects::NamedString::getFromRegistry( std::string( "/" ) + name );
+    if ( includeNameString == nullptr )
+    {
+        return nullptr;
     }
 
-    result.append( "\0" );
+    std::string expanded = preprocessIncludes( name, includeNameString->string(), level, 0 );
+    return &( s_expandedIncludes[name] = std::move( expanded ) );
+}
 
-    return result;
+void ShaderProgram::clearIncludeCache() {
+    s_expandedIncludes.clear();
 }
 
 } // namespace Engine
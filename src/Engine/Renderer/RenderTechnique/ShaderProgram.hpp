@@ -16,6 +16,7 @@ namespace globjects {
 class File;
 class Shader;
 class Program;
+class ProgramBinary;
 class NamedString;
 } // namespace globjects
 
@@ -26,7 +27,14 @@ class Texture;
 class RA_ENGINE_API ShaderProgram final {
   public:
     ShaderProgram();
-    explicit ShaderProgram( const ShaderConfiguration& shaderConfig );
+    /**
+     * Create and load a program.
+     * @param shaderConfig Configuration of the program.
+     * @param binaryCacheDirectory Existing directory in which the linked program binaries are
+     * stored and looked for, to skip compilation. The cache is disabled if empty.
+     */
+    explicit ShaderProgram( const ShaderConfiguration& shaderConfig,
+                            const std::string& binaryCacheDirectory = "" );
     ~ShaderProgram();
 
     void load( const ShaderConfiguration& shaderConfig );
@@ -65,10 +73,25 @@ class RA_ENGINE_API ShaderProgram final {
 
     globjects::Program* getProgramObject() const;
 
+    /// Clear the expanded include files, to be called when the include files change.
+    static void clearIncludeCache();
+
   private:
-    void loadShader( ShaderType type, const std::string& name, const std::set<std::string>& props,
-                     const std::vector<std::pair<std::string, ShaderType>>& includes,
-                     const std::string& version = "#version 410" );
+    /// Returns the full source of a shader, with its properties and includes expanded.
+    std::string getShaderSource( ShaderType type, const std::string& name,
+                                 const std::set<std::string>& props,
+                                 const std::vector<std::pair<std::string, ShaderType>>& includes,
+                                 const std::string& version = "#version 410" );
+
+    void loadShader( ShaderType type, const std::string& name, const std::string& source );
+
+    /// Compile and link the program from the configuration, or load it from the binary cache.
+    void build();
+
+    /// Returns the binary cache file of the program with the given sources.
+    std::string getBinaryCacheFile( const std::array<std::string, ShaderType_COUNT>& sources ) const;
+    bool loadBinary( const std::string& file );
+    void saveBinary( const std::string& file ) const;
 
     GLenum getTypeAsGLEnum( ShaderType type ) const;
     ShaderType getGLenumAsType( GLenum type ) const;
@@ -78,12 +101,19 @@ class RA_ENGINE_API ShaderProgram final {
     std::string preprocessIncludes( const std::string& name, const std::string& shader, int level,
                                     int line = 0 );
 
+    /// Returns the content of a named string with its own includes expanded.
+    const std::string* getExpandedInclude( const std::string& name, int level );
+
   private:
     ShaderConfiguration m_configuration;
 
+    std::string m_binaryCacheDirectory;
+
     std::array<std::unique_ptr<globjects::Shader>, ShaderType_COUNT> m_shaderObjects;
 
     std::unique_ptr<globjects::Program> m_program;
+
+    std::unique_ptr<globjects::ProgramBinary> m_binary;
 };
 
 } // namespace Engine
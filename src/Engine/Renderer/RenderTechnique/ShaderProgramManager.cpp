@@ -13,9 +13,11 @@ namespace Ra {
 namespace Engine {
 using ShaderProgramPtr = std::shared_ptr<ShaderProgram>;
 
-ShaderProgramManager::ShaderProgramManager( const std::string& vs, const std::string& fs ) :
+ShaderProgramManager::ShaderProgramManager( const std::string& vs, const std::string& fs,
+                                            const std::string& programCacheDirectory ) :
     m_defaultVsName( vs ),
-    m_defaultFsName( fs ) {
+    m_defaultFsName( fs ),
+    m_programCacheDirectory( programCacheDirectory ) {
     initialize();
 }
 
@@ -73,6 +75,7 @@ void ShaderProgramManager::updateNamedString() {
         m_namedStrings[i].reset( nullptr );
         m_namedStrings[i].reset( globjects::NamedString::create( id, m_files[i].get() ).release() );
     }
+    ShaderProgram::clearIncludeCache();
 }
 
 const ShaderProgram* ShaderProgramManager::addShaderProgram( const std::string& name,
@@ -95,7 +98,7 @@ const ShaderProgram* ShaderProgramManager::addShaderProgram( const ShaderConfigu
     }
 
     // Try to load the shader
-    auto prog = Core::Container::make_shared<ShaderProgram>( config );
+    auto prog = Core::Container::make_shared<ShaderProgram>( config, m_programCacheDirectory );
 
     // FIXED : use isLinked not isValid
     if ( prog->getProgramObject()->isLinked() )
@@ -152,7 +155,7 @@ void ShaderProgramManager::reloadNotCompiledShaderPrograms() {
     for ( std::vector<ShaderConfiguration>::iterator conf = m_shaderFailedConfs.begin();
           conf != m_shaderFailedConfs.end(); ++conf )
     {
-        auto prog = Core::Container::make_shared<ShaderProgram>( *conf );
+        auto prog = Core::Container::make_shared<ShaderProgram>( *conf, m_programCacheDirectory );
 
         if ( prog->getProgramObject()->isValid() )
         {
@@ -46,7 +46,10 @@ class RA_ENGINE_API ShaderProgramManager final {
 
   private:
     /// need Initialization after ctr and before use
-    ShaderProgramManager( const std::string& vs, const std::string& fs );
+    /// If programCacheDirectory is not empty, it must be an existing directory in which the
+    /// linked programs are cached, so that they are not compiled again on the next runs.
+    ShaderProgramManager( const std::string& vs, const std::string& fs,
+                          const std::string& programCacheDirectory = "" );
     ~ShaderProgramManager();
     void initialize();
     void insertShader( const ShaderConfiguration& config,
@@ -63,6 +66,8 @@ class RA_ENGINE_API ShaderProgramManager final {
     std::string m_defaultVsName;
     std::string m_defaultFsName;
 
+    std::string m_programCacheDirectory;
+
     const ShaderProgram* m_defaultShaderProgram;
 };
 
@@ -3,8 +3,10 @@
 #include <globjects/Framebuffer.h>
 
 #include <iostream>
+#include <limits>
 
 #include <Core/Utils/Log.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 #include <Core/Geometry/MeshPrimitives.hpp>
 #include <Core/Asset/FileData.hpp>
@@ -12,6 +14,7 @@
 #include <Engine/RadiumEngine.hpp>
 #include <Engine/Managers/LightManager/LightManager.hpp>
 
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
 #include <Engine/Renderer/OpenGL/OpenGL.hpp>
 #include <Engine/Renderer/RenderTechnique/ShaderConfigFactory.hpp>
 #include <Engine/Renderer/RenderTechnique/ShaderProgram.hpp>
@@ -31,6 +34,116 @@ const GLenum buffers[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_A
                           GL_COLOR_ATTACHMENT6, GL_COLOR_ATTACHMENT7};
 }
 
+struct Renderer::PickingReadback {
+    ~PickingReadback() {
+        if ( m_fence != nullptr )
+        {
+            glDeleteSync( m_fence );
+        }
+        if ( m_buffer != 0 )
+        {
+            glDeleteBuffers( 1, &m_buffer );
+            GpuMemoryTracker::release( this );
+        }
+    }
+
+    GLuint m_buffer{0};
+    GLsizeiptr m_bufferSize{0};
+    GLsync m_fence{nullptr};
+    std::array<int, 4> m_region;
+    std::vector<PickingQuery> m_queries;
+};
+
+/// Timestamp queries of the render stages of the last frames. The results of a frame are read
+/// when its queries are reused, so that waiting for them does not stall the pipeline.
+struct Renderer::GpuTimer {
+    static constexpr uint NumFrames = 3;
+    static constexpr uint MaxStages = 16;
+
+    struct Frame {
+        std::array<GLuint, MaxStages + 1> m_queries;
+        std::array<const char*, MaxStages> m_stages;
+        uint m_numStages{0};
+        bool m_pending{false};
+        // Reference point to convert GPU timestamps to the CPU clock.
+        GLint64 m_gpuReference{0};
+        Core::Utils::TimePoint m_cpuReference;
+    };
+
+    ~GpuTimer() {
+        if ( m_initialized )
+        {
+            for ( auto& frame : m_frames )
+            {
+                glDeleteQueries( frame.m_queries.size(), frame.m_queries.data() );
+            }
+        }
+    }
+
+    void beginFrame() {
+        if ( !m_initialized )
+        {
+            for ( auto& frame : m_frames )
+            {
+                glGenQueries( frame.m_queries.size(), frame.m_queries.data() );
+            }
+            m_initialized = true;
+        }
+        m_current = ( m_current + 1 ) % NumFrames;
+        Frame& frame = m_frames[m_current];
+        if ( frame.m_pending )
+        {
+            resolve( frame );
+        }
+        frame.m_numStages = 0;
+        glGetInteger64v( GL_TIMESTAMP, &frame.m_gpuReference );
+        frame.m_cpuReference = Core::Utils::Clock::now();
+    }
+
+    // Mark the end of the previous stage, and the beginning of the given one if not null.
+    void mark( const char* stage ) {
+        Frame& frame = m_frames[m_current];
+        if ( frame.m_numStages == MaxStages && stage != nullptr )
+        {
+            return;
+        }
+        glQueryCounter( frame.m_queries[frame.m_numStages], GL_TIMESTAMP );
+        if ( stage != nullptr )
+        {
+            frame.m_stages[frame.m_numStages++] = stage;
+        } else
+        {
+            frame.m_pending = frame.m_numStages > 0;
+        }
+    }
+
+    void resolve( Frame& frame ) {
+        std::array<GLuint64, MaxStages + 1> timestamps;
+        for ( uint i = 0; i <= frame.m_numStages; ++i )
+        {
+            glGetQueryObjectui64v( frame.m_queries[i], GL_QUERY_RESULT, &timestamps[i] );
+        }
+        for ( uint i = 0; i < frame.m_numStages; ++i )
+        {
+            const auto start = std::chrono::nanoseconds( GLint64( timestamps[i] ) -
+                                                         frame.m_gpuReference );
+            const auto end = std::chrono::nanoseconds( GLint64( timestamps[i + 1] ) -
+                                                       frame.m_gpuReference );
+            Core::Utils::Profiler::recordGpuZone(
+                frame.m_stages[i],
+                frame.m_cpuReference +
+                    std::chrono::duration_cast<Core::Utils::Clock::duration>( start ),
+                frame.m_cpuReference +
+                    std::chrono::duration_cast<Core::Utils::Clock::duration>( end ) );
+        }
+        frame.m_pending = false;
+    }
+
+    std::array<Frame, NumFrames> m_frames;
+    uint m_current{0};
+    bool m_initialized{false};
+};
+
 Renderer::Renderer() :
     m_width( 0 ),
     m_height( 0 ),
@@ -41,7 +154,12 @@ Renderer::Renderer() :
     m_drawDebug( true ),
     m_wireframe( false ),
     m_postProcessEnabled( true ),
-    m_brushRadius( 0 ) {
+    m_lodPixelError( 1 ),
+    m_brushRadius( 0 ),
+    m_asyncPicking( false ),
+    m_pickingReadback( new PickingReadback ),
+    m_gpuTimer( new GpuTimer ),
+    m_profileStage( nullptr ) {
     GL_CHECK_ERROR;
 }
 
@@ -126,18 +244,20 @@ void Renderer::initialize( uint width, uint height ) {
     resize( m_width, m_height );
 }
 
-void Renderer::render( const RenderData& data ) {
+void Renderer::render( const RenderData& data, const std::function<void()>& objectsUpdated ) {
     CORE_ASSERT( RadiumEngine::getInstance() != nullptr, "Engine is not initialized." );
 
     std::lock_guard<std::mutex> renderLock( m_renderMutex );
     CORE_UNUSED( renderLock );
 
     m_timerData.renderStart = Core::Utils::Clock::now();
+    GpuMemoryTracker::newFrame();
 
     // 0. Save eventual already bound FBO (e.g. QtOpenGLWidget) and viewport
     saveExternalFBOInternal();
 
     // 1. Gather render objects if needed
+    beginProfileStage( "Renderer::feedRenderQueues" );
     feedRenderQueuesInternal( data );
 
     m_timerData.feedRenderQueuesEnd = Core::Utils::Clock::now();
@@ -145,40 +265,87 @@ void Renderer::render( const RenderData& data ) {
     // 2. Update them (from an opengl point of view)
     // FIXME(Charly): Maybe we could just update objects if they need it
     // before drawing them, that would be cleaner (performance problem ?)
+    beginProfileStage( "Renderer::updateRenderObjects" );
+    TextureManager::getInstance()->updatePendingTextures();
     updateRenderObjectsInternal( data );
+    selectLodsInternal( data );
     m_timerData.updateEnd = Core::Utils::Clock::now();
 
+    // Tell renderobjects they are drawn this frame (to decrease the counter). The expired
+    // ones are still in the render queues, but removed before the tasks of the next frame.
+    notifyRenderObjectsRenderingInternal();
+    if ( objectsUpdated )
+    {
+        objectsUpdated();
+    }
+
     // 3. Do picking if needed
+    // Results of asynchronous picking are available one frame after the queries.
+    beginProfileStage( "Renderer::picking" );
     m_pickingResults.clear();
+    m_lastFramePickingQueries.clear();
+    if ( m_pickingReadback->m_fence != nullptr )
+    {
+        resolvePendingPicking();
+    }
     if ( !m_pickingQueries.empty() )
     {
         doPicking( data );
     }
-    m_lastFramePickingQueries = m_pickingQueries;
     m_pickingQueries.clear();
 
+    beginProfileStage( "Renderer::updateStep" );
     updateStepInternal( data );
 
     // 4. Do the rendering.
+    beginProfileStage( "Renderer::render" );
     renderInternal( data );
     m_timerData.mainRenderEnd = Core::Utils::Clock::now();
 
     // 5. Post processing
+    beginProfileStage( "Renderer::postProcess" );
     postProcessInternal( data );
     m_timerData.postProcessEnd = Core::Utils::Clock::now();
 
     // 6. Debug
+    beginProfileStage( "Renderer::debug" );
     debugInternal( data );
 
     // 7. Draw UI
+    beginProfileStage( "Renderer::ui" );
     uiInternal( data );
 
     // 8. Write image to Qt framebuffer.
+    beginProfileStage( "Renderer::drawScreen" );
     drawScreenInternal();
+
+    // 9. Move the resources unused this frame out of the GPU if over the memory budget.
+    beginProfileStage( "Renderer::evictResources" );
+    GpuMemoryTracker::enforceBudget();
+    beginProfileStage( nullptr );
     m_timerData.renderEnd = Core::Utils::Clock::now();
+}
 
-    // 9. Tell renderobjects they have been drawn (to decreaase the counter)
-    notifyRenderObjectsRenderingInternal();
+void Renderer::beginProfileStage( const char* name ) {
+#ifdef ALLOW_PROFILING
+    if ( !Core::Utils::Profiler::isEnabled() && m_profileStage == nullptr )
+    {
+        return;
+    }
+    const auto now = Core::Utils::Clock::now();
+    if ( m_profileStage != nullptr )
+    {
+        Core::Utils::Profiler::recordZone( m_profileStage, m_profileStageStart, now );
+    } else
+    {
+        m_gpuTimer->beginFrame();
+    }
+    m_gpuTimer->mark( name );
+    m_profileStage = name;
+    m_profileStageStart = now;
+#else
+    CORE_UNUSED( name );
+#endif
 }
 
 void Renderer::saveExternalFBOInternal() {
@@ -191,22 +358,65 @@ void Renderer::saveExternalFBOInternal() {
 }
 
 void Renderer::updateRenderObjectsInternal( const RenderData& renderData ) {
-    for ( auto& ro : m_fancyRenderObjects )
-    {
-        ro->updateGL();
-    }
-    for ( auto& ro : m_xrayRenderObjects )
-    {
-        ro->updateGL();
-    }
-    for ( auto& ro : m_debugRenderObjects )
-    {
-        ro->updateGL();
-    }
-    for ( auto& ro : m_uiRenderObjects )
+    m_dirtyRenderObjects.clear();
+    m_roMgr->getDirtyRenderObjects( m_dirtyRenderObjects );
+    for ( auto& ro : m_dirtyRenderObjects )
     {
         ro->updateGL();
     }
+    // Do not keep the objects alive until the next frame.
+    m_dirtyRenderObjects.clear();
+
+    // The evicted meshes to draw are sent again now, as the tasks of the frame may change
+    // their geometry once the objects are updated.
+    auto restore = []( const std::vector<RenderObjectPtr>& renderObjects ) {
+        for ( const auto& ro : renderObjects )
+        {
+            const auto& mesh = ro->getMesh();
+            if ( mesh && mesh->isEvicted() )
+            {
+                mesh->updateGL();
+            }
+        }
+    };
+    restore( m_fancyRenderObjects );
+    restore( m_xrayRenderObjects );
+    restore( m_debugRenderObjects );
+    restore( m_uiRenderObjects );
+}
+
+void Renderer::selectLodsInternal( const RenderData& renderData ) {
+    // Pixels per unit length at the distance 1 from a perspective camera, or anywhere in front
+    // of an orthographic one.
+    const bool perspective = renderData.projMatrix( 3, 3 ) == 0;
+    const Scalar pixelsPerUnit = renderData.projMatrix( 1, 1 ) * m_height / 2;
+    const Core::Math::Matrix4 cameraToWorld = renderData.viewMatrix.inverse();
+    const Core::Math::Vector3 eye = cameraToWorld.block<3, 1>( 0, 3 );
+
+    auto select = [&]( const std::vector<RenderObjectPtr>& renderObjects ) {
+        for ( const auto& ro : renderObjects )
+        {
+            const auto& mesh = ro->getMesh();
+            uint level = 0;
+            if ( m_lodPixelError > 0 && mesh && mesh->getNumLods() > 1 )
+            {
+                const Scalar scale = ro->getTransform().linear().colwise().norm().maxCoeff();
+                const Scalar distance = perspective ? ro->getAabb().exteriorDistance( eye ) : 1;
+                if ( distance > 0 )
+                {
+                    const Scalar pixels = pixelsPerUnit * scale / distance;
+                    while ( level + 1 < mesh->getNumLods() &&
+                            mesh->getLodError( level + 1 ) * pixels <= m_lodPixelError )
+                    {
+                        ++level;
+                    }
+                }
+            }
+            ro->setLod( level );
+        }
+    };
+    select( m_fancyRenderObjects );
+    select( m_xrayRenderObjects );
 }
 
 void Renderer::feedRenderQueuesInternal( const RenderData& renderData ) {
@@ -316,7 +526,7 @@ void Renderer::renderForPicking(
                 pickingShaders[i]->setUniform( "objectId", id );
 
                 Core::Math::Matrix4 M = ro->getTransformAsMatrix();
-                Core::Math::Matrix4 N = M.inverse().transpose();
+                Core::Math::Matrix4 N = ro->getNormalMatrix();
                 pickingShaders[i]->setUniform( "transform.proj", renderData.projMatrix );
                 pickingShaders[i]->setUniform( "transform.view", renderData.viewMatrix );
                 pickingShaders[i]->setUniform( "transform.model", M );
@@ -332,7 +542,13 @@ void Renderer::renderForPicking(
 }
 
 void Renderer::doPicking( const RenderData& renderData ) {
-    m_pickingResults.reserve( m_pickingQueries.size() );
+    std::array<int, 4> region;
+    if ( !computePickingRegion( m_pickingQueries, region ) )
+    {
+        // Nothing to read back, all the queries are answered with "nothing picked".
+        resolvePicking( m_pickingQueries, region, nullptr );
+        return;
+    }
 
     m_pickingFbo->bind();
 
@@ -340,6 +556,10 @@ void Renderer::doPicking( const RenderData& renderData ) {
     GL_ASSERT( glColorMask( 1, 1, 1, 1 ) );
     GL_ASSERT( glDrawBuffers( 1, buffers ) );
 
+    // Only the region around the queries is cleared and rasterized.
+    GL_ASSERT( glEnable( GL_SCISSOR_TEST ) );
+    GL_ASSERT( glScissor( region[0], region[1], region[2], region[3] ) );
+
     float clearDepth = 1.0;
     int clearColor[] = {-1, -1, -1, -1};
 
@@ -406,26 +626,122 @@ void Renderer::doPicking( const RenderData& renderData ) {
         }
     }
 
-    // Now read the Picking Texture to address the Picking Requests.
+    GL_ASSERT( glDisable( GL_SCISSOR_TEST ) );
+
+    // Now read the whole region of the Picking Texture at once into a pixel buffer.
+    // The transfer is asynchronous, a fence tells when the pixels are available.
+    const GLsizeiptr size = GLsizeiptr( region[2] ) * region[3] * 4 * sizeof( int );
+    PickingReadback& readback = *m_pickingReadback;
+    if ( readback.m_buffer == 0 )
+    {
+        GL_ASSERT( glGenBuffers( 1, &readback.m_buffer ) );
+    }
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, readback.m_buffer ) );
+    if ( size > readback.m_bufferSize )
+    {
+        GL_ASSERT( glBufferData( GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ ) );
+        readback.m_bufferSize = size;
+        GpuMemoryTracker::setSize( &readback, GpuMemoryTracker::RESOURCE_BUFFER, "Picking readback",
+                                   std::size_t( size ) );
+    }
     GL_ASSERT( glReadBuffer( GL_COLOR_ATTACHMENT0 ) );
+    GL_ASSERT( glReadPixels( region[0], region[1], region[2], region[3], GL_RGBA_INTEGER, GL_INT,
+                             nullptr ) );
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 ) );
+
+    readback.m_fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, GL_NONE_BIT );
+    readback.m_region = region;
+    std::swap( readback.m_queries, m_pickingQueries );
+
+    m_pickingFbo->unbind();
+
+    // In synchronous mode, wait for the readback right away.
+    if ( !m_asyncPicking )
+    {
+        resolvePendingPicking();
+    }
+}
 
-    int pick[4];
-    for ( const PickingQuery& query : m_pickingQueries )
+bool Renderer::computePickingRegion( const std::vector<PickingQuery>& queries,
+                                     std::array<int, 4>& region ) const {
+    const int radius = int( std::ceil( m_brushRadius ) );
+    int xmin = int( m_width );
+    int ymin = int( m_height );
+    int xmax = -1;
+    int ymax = -1;
+    for ( const PickingQuery& query : queries )
+    {
+        const int r = query.m_mode < C_VERTEX ? 0 : radius;
+        const int x = int( query.m_screenCoords.x() );
+        const int y = int( query.m_screenCoords.y() );
+        xmin = std::min( xmin, x - r );
+        ymin = std::min( ymin, y - r );
+        xmax = std::max( xmax, x + r );
+        ymax = std::max( ymax, y + r );
+    }
+    // clamp to the viewport (queries can be out of window when picking while moving outside)
+    xmin = std::max( xmin, 0 );
+    ymin = std::max( ymin, 0 );
+    xmax = std::min( xmax, int( m_width ) - 1 );
+    ymax = std::min( ymax, int( m_height ) - 1 );
+
+    region = {xmin, ymin, xmax - xmin + 1, ymax - ymin + 1};
+    return xmin <= xmax && ymin <= ymax;
+}
+
+void Renderer::resolvePendingPicking() {
+    // Usually already signaled when resolving the queries of the previous frame.
+    PickingReadback& readback = *m_pickingReadback;
+    GLenum status = glClientWaitSync( readback.m_fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                      std::numeric_limits<GLuint64>::max() );
+    if ( status == GL_WAIT_FAILED )
+    {
+        LOG( Core::Utils::logERROR ) << "Unable to wait for the picking readback.";
+    }
+    glDeleteSync( readback.m_fence );
+    readback.m_fence = nullptr;
+
+    const std::array<int, 4>& region = readback.m_region;
+    const GLsizeiptr size = GLsizeiptr( region[2] ) * region[3] * 4 * sizeof( int );
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, readback.m_buffer ) );
+    const int* pixels =
+        static_cast<const int*>( glMapBufferRange( GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT ) );
+    CORE_ASSERT( pixels, "Unable to map the picking readback buffer" );
+    resolvePicking( readback.m_queries, region, pixels );
+    GL_ASSERT( glUnmapBuffer( GL_PIXEL_PACK_BUFFER ) );
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 ) );
+
+    readback.m_queries.clear();
+}
+
+void Renderer::resolvePicking( const std::vector<PickingQuery>& queries,
+                               const std::array<int, 4>& region, const int* pixels ) {
+    // Returns the picking data of pixel (x, y), or nullptr if it has not been read back.
+    auto pixel = [&region, pixels]( int x, int y ) -> const int* {
+        if ( pixels == nullptr || x < region[0] || x >= region[0] + region[2] || y < region[1] ||
+             y >= region[1] + region[3] )
+        {
+            return nullptr;
+        }
+        return pixels + 4 * ( ( y - region[1] ) * region[2] + ( x - region[0] ) );
+    };
+
+    m_pickingResults.reserve( m_pickingResults.size() + queries.size() );
+    for ( const PickingQuery& query : queries )
     {
         PickingResult result;
         // fill picking result according to picking mode
         if ( query.m_mode < C_VERTEX )
         {
+            const int* pick = pixel( query.m_screenCoords.x(), query.m_screenCoords.y() );
             // skip query if out of window (can occur when picking while moving outside)
-            if ( query.m_screenCoords.x() < 0 || query.m_screenCoords.x() > m_width - 1 ||
-                 query.m_screenCoords.y() < 0 || query.m_screenCoords.y() > m_height - 1 )
+            if ( pick == nullptr )
             {
                 result.m_roIdx = -1;
+                result.m_mode = query.m_mode;
                 m_pickingResults.push_back( result );
                 continue;
             }
-            GL_ASSERT( glReadPixels( query.m_screenCoords.x(), query.m_screenCoords.y(), 1, 1,
-                                     GL_RGBA_INTEGER, GL_INT, pick ) );
             result.m_roIdx = pick[0];                    // RO idx
             result.m_vertexIdx.emplace_back( pick[1] );  // vertex idx in the element
             result.m_elementIdx.emplace_back( pick[2] ); // element idx
@@ -442,12 +758,12 @@ void Renderer::doPicking( const RenderData& renderData ) {
                 {
                     const int x = query.m_screenCoords.x() + i;
                     const int y = query.m_screenCoords.y() - j;
+                    const int* pick = pixel( x, y );
                     // skip query if out of window (can occur when picking while moving outside)
-                    if ( x < 0 || x > m_width - 1 || y < 0 || y > m_height - 1 )
+                    if ( pick == nullptr )
                     {
                         continue;
                     }
-                    GL_ASSERT( glReadPixels( x, y, 1, 1, GL_RGBA_INTEGER, GL_INT, pick ) );
                     resultPerRO[pick[0]].m_roIdx = pick[0];
                     resultPerRO[pick[0]].m_vertexIdx.emplace_back( pick[1] );
                     resultPerRO[pick[0]].m_elementIdx.emplace_back( pick[2] );
@@ -469,12 +785,13 @@ void Renderer::doPicking( const RenderData& renderData ) {
                 }
             }
             result = resultPerRO[maxRO];
+            result.m_roIdx = maxRO;
         }
         result.m_mode = query.m_mode;
         m_pickingResults.push_back( result );
     }
-
-    m_pickingFbo->unbind();
+    m_lastFramePickingQueries.insert( m_lastFramePickingQueries.end(), queries.begin(),
+                                      queries.end() );
 }
 
 void Renderer::drawScreenInternal() {
@@ -586,6 +903,8 @@ std::vector<std::string> Renderer::getAvailableTextures() const {
 
 void Renderer::reloadShaders() {
     ShaderProgramManager::getInstance()->reloadAllShaderPrograms();
+    // The techniques get their new programs at their next update.
+    m_roMgr->setAllDirty();
 }
 
 uchar* Renderer::grabFrame( uint& w, uint& h ) const {
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -112,6 +113,10 @@ class RA_ENGINE_API Renderer {
 
     inline void enablePostProcess( bool enabled ) { m_postProcessEnabled = enabled; }
 
+    /// Set the largest error on screen, in pixels, of the levels of detail drawn for the meshes
+    /// (see Mesh::setLods()). The meshes are always drawn at full resolution if it is 0.
+    inline void setLodPixelError( Scalar error ) { m_lodPixelError = error; }
+
     /**
      * @brief Tell the renderer it needs to render.
      * This method does the following steps :
@@ -131,8 +136,13 @@ class RA_ENGINE_API Renderer {
      * So, render() takes that into account by saving an eventual bound
      * framebuffer, and restores it before drawing the last final texture.
      * If no framebuffer was bound, it draws into GL_BACK.
+     *
+     * @param objectsUpdated Called once the render objects have been sent to the GPU. From then,
+     * the renderer does not read the CPU data of the meshes, which can be modified by the tasks
+     * of the next frame while the rendering goes on (see BaseApplication::setPipelinedFrames()).
      */
-    void render( const RenderData& renderData );
+    void render( const RenderData& renderData,
+                 const std::function<void()>& objectsUpdated = nullptr );
 
     // -=-=-=-=-=-=-=-=- VIRTUAL -=-=-=-=-=-=-=-=- //
     /**
@@ -157,10 +167,19 @@ class RA_ENGINE_API Renderer {
 
     inline const std::vector<PickingResult>& getPickingResults() const { return m_pickingResults; }
 
+    /// Return the queries answered by getPickingResults(), in the same order.
     inline const std::vector<PickingQuery>& getPickingQueries() const {
         return m_lastFramePickingQueries;
     }
 
+    /**
+     * Toggle asynchronous picking.
+     * When enabled, the picking texture is read back without waiting for the GPU and the
+     * picking queries of a frame are answered during the next call to render().
+     * getPickingQueries() always returns the queries matching getPickingResults().
+     */
+    inline void setAsynchronousPicking( bool async ) { m_asyncPicking = async; }
+
     inline virtual void setMousePosition( const Core::Math::Vector2& pos ) final {
         m_mousePosition[0] = pos[0];
         m_mousePosition[1] = m_height - pos[1];
@@ -264,8 +283,13 @@ class RA_ENGINE_API Renderer {
     void feedRenderQueuesInternal( const RenderData& renderData );
 
     // 2.0
+    /// Update the OpenGL data of the render objects marked dirty since the last frame.
     void updateRenderObjectsInternal( const RenderData& renderData );
 
+    /// Choose the coarsest level of detail of each render object whose error, projected on
+    /// screen at the distance of its bounding box, is below m_lodPixelError.
+    void selectLodsInternal( const RenderData& renderData );
+
     // 3.
     void splitRenderQueuesForPicking( const RenderData& renderData );
     void splitRQ( const std::vector<RenderObjectPtr>& renderQueue,
@@ -276,6 +300,23 @@ class RA_ENGINE_API Renderer {
 
     void doPicking( const RenderData& renderData );
 
+    // Start a new profiled stage of render(), ending the previous one. A null name ends the
+    // last stage. Stages are recorded as CPU zones and, using timer queries, as GPU zones.
+    // Does nothing unless the profiler is enabled, see Core/Utils/Profiler.hpp.
+    void beginProfileStage( const char* name );
+
+    // Compute the screen region {x, y, width, height} covering the given picking queries.
+    // Returns false if the queries are all outside of the viewport.
+    bool computePickingRegion( const std::vector<PickingQuery>& queries,
+                               std::array<int, 4>& region ) const;
+
+    // Wait for the pending picking readback and answer the corresponding queries.
+    void resolvePendingPicking();
+
+    // Answer the picking queries from the picking texture region read back in pixels.
+    void resolvePicking( const std::vector<PickingQuery>& queries,
+                         const std::array<int, 4>& region, const int* pixels );
+
     // 6.
     void drawScreenInternal();
 
@@ -313,12 +354,16 @@ class RA_ENGINE_API Renderer {
     std::vector<RenderObjectPtr> m_xrayRenderObjects;
     std::vector<RenderObjectPtr> m_uiRenderObjects;
 
+    /// Render objects to update this frame, see updateRenderObjectsInternal().
+    std::vector<RenderObjectPtr> m_dirtyRenderObjects;
+
     // Simple quad mesh, used to render the final image
     std::unique_ptr<Mesh> m_quadMesh;
 
     bool m_drawDebug;          // Should we render debug stuff ?
     bool m_wireframe;          // Are we rendering in "real" wireframe mode
     bool m_postProcessEnabled; // Should we do post processing ?
+    Scalar m_lodPixelError;    // Largest error of the levels of detail, in pixels.
 
   private:
     // Qt has the nice idea to bind an fbo before giving you the opengl context,
@@ -347,6 +392,17 @@ class RA_ENGINE_API Renderer {
     std::vector<PickingQuery> m_lastFramePickingQueries;
     std::vector<PickingResult> m_pickingResults;
 
+    // Picking texture region being read back, together with the queries it answers.
+    struct PickingReadback;
+    bool m_asyncPicking;
+    std::unique_ptr<PickingReadback> m_pickingReadback;
+
+    // Profiling of the render stages.
+    struct GpuTimer;
+    std::unique_ptr<GpuTimer> m_gpuTimer;
+    const char* m_profileStage;
+    Core::Utils::TimePoint m_profileStageStart;
+
     std::unique_ptr<Texture> m_depthTexture;
 };
 
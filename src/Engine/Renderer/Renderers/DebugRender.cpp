@@ -199,6 +199,7 @@ void DebugRender::initialize() {
 }
 
 void DebugRender::render( const Core::Math::Matrix4& viewMatrix, const Core::Math::Matrix4& projMatrix ) {
+    std::lock_guard<std::mutex> lock( m_dataMutex );
     renderLines( viewMatrix.cast<float>(), projMatrix.cast<float>() );
     renderPoints( viewMatrix.cast<float>(), projMatrix.cast<float>() );
     renderMeshes( viewMatrix.cast<float>(), projMatrix.cast<float>() );
@@ -330,14 +331,17 @@ void DebugRender::renderMeshes( const Core::Math::Matrix4f& view, const Core::Ma
 void DebugRender::addLine( const Core::Math::Vector3& from, const Core::Math::Vector3& to,
                            const Core::Math::Color& color ) {
     Line l( from, to, color );
+    std::lock_guard<std::mutex> lock( m_dataMutex );
     m_lines.push_back( l );
 }
 
 void DebugRender::addPoint( const Core::Math::Vector3& p, const Core::Math::Color& c ) {
+    std::lock_guard<std::mutex> lock( m_dataMutex );
     m_points.push_back( {p, c.head<3>()} );
 }
 
 void DebugRender::addPoints( const Core::Container::Vector3Array& p, const Core::Math::Color& c ) {
+    std::lock_guard<std::mutex> lock( m_dataMutex );
     for ( uint i = 0; i < p.size(); ++i )
     {
         m_points.push_back( {p[i], c.head<3>()} );
@@ -346,6 +350,7 @@ void DebugRender::addPoints( const Core::Container::Vector3Array& p, const Core:
 
 void DebugRender::addPoints( const Core::Container::Vector3Array& p, const Core::Container::Vector4Array& c ) {
     CORE_ASSERT( p.size() == c.size(), "Data sizes mismatch." );
+    std::lock_guard<std::mutex> lock( m_dataMutex );
     for ( uint i = 0; i < p.size(); ++i )
     {
         m_points.push_back( {p[i], c[i].head<3>()} );
@@ -353,6 +358,7 @@ void DebugRender::addPoints( const Core::Container::Vector3Array& p, const Core:
 }
 
 void DebugRender::addMesh( const std::shared_ptr<Mesh>& mesh, const Core::Math::Transform& transform ) {
+    std::lock_guard<std::mutex> lock( m_dataMutex );
     m_meshes.push_back( {mesh, transform} );
 }
 
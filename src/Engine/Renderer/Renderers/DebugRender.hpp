@@ -4,6 +4,7 @@
 #include <Engine/RaEngine.hpp>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <Core/Container/VectorArray.hpp>
@@ -97,6 +98,9 @@ class RA_ENGINE_API DebugRender {
     std::vector<DbgMesh> m_meshes;
 
     std::vector<Point> m_points;
+
+    /// Primitives can be added by the tasks while rendering (see BaseApplication::setPipelinedFrames()).
+    std::mutex m_dataMutex;
 };
 } // namespace Engine
 } // namespace Ra
@@ -0,0 +1,419 @@
+#include <Engine/Renderer/Texture/CompressedImage.hpp>
+
+#include <Core/Utils/Log.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Ra {
+namespace Engine {
+
+namespace {
+
+using Buffer = std::vector<unsigned char>;
+
+// Read a little endian 32 bits integer at the given offset.
+inline uint32_t readUint32( const Buffer& buffer, size_t offset ) {
+    return uint32_t( buffer[offset] ) | ( uint32_t( buffer[offset + 1] ) << 8 ) |
+           ( uint32_t( buffer[offset + 2] ) << 16 ) | ( uint32_t( buffer[offset + 3] ) << 24 );
+}
+
+inline uint32_t makeFourCC( const char* code ) {
+    return uint32_t( code[0] ) | ( uint32_t( code[1] ) << 8 ) | ( uint32_t( code[2] ) << 16 ) |
+           ( uint32_t( code[3] ) << 24 );
+}
+
+// Size in bytes of a 4x4 block of the given format, 0 if the format is not supported.
+uint getBlockSize( GLenum format ) {
+    switch ( format )
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_SIGNED_RED_RGTC1:
+        return 8;
+    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_SIGNED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+    case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+    case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+    case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+inline size_t getLevelSize( uint width, uint height, uint blockSize ) {
+    return size_t( std::max( 1u, ( width + 3 ) / 4 ) ) * std::max( 1u, ( height + 3 ) / 4 ) *
+           blockSize;
+}
+
+// Format corresponding to a DXGI_FORMAT value of a DDS DX10 header.
+GLenum getDxgiFormat( uint32_t dxgiFormat ) {
+    switch ( dxgiFormat )
+    {
+    case 71: // DXGI_FORMAT_BC1_UNORM
+        return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+        return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+    case 74: // DXGI_FORMAT_BC2_UNORM
+        return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+    case 75: // DXGI_FORMAT_BC2_UNORM_SRGB
+        return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT;
+    case 77: // DXGI_FORMAT_BC3_UNORM
+        return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+        return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+    case 80: // DXGI_FORMAT_BC4_UNORM
+        return GL_COMPRESSED_RED_RGTC1;
+    case 81: // DXGI_FORMAT_BC4_SNORM
+        return GL_COMPRESSED_SIGNED_RED_RGTC1;
+    case 83: // DXGI_FORMAT_BC5_UNORM
+        return GL_COMPRESSED_RG_RGTC2;
+    case 84: // DXGI_FORMAT_BC5_SNORM
+        return GL_COMPRESSED_SIGNED_RG_RGTC2;
+    case 95: // DXGI_FORMAT_BC6H_UF16
+        return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+    case 96: // DXGI_FORMAT_BC6H_SF16
+        return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+    case 98: // DXGI_FORMAT_BC7_UNORM
+        return GL_COMPRESSED_RGBA_BPTC_UNORM;
+    case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+        return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+    default:
+        return GL_NONE;
+    }
+}
+
+// Reverse the first numRows rows of the 2 bits indices of a BC1 color block, one byte per row
+// after the two endpoints.
+inline void flipColorBlock( unsigned char* block, uint numRows ) {
+    std::reverse( block + 4, block + 4 + numRows );
+}
+
+// Reverse the first numRows rows of a BC2 alpha block, two bytes per row.
+inline void flipExplicitAlphaBlock( unsigned char* block, uint numRows ) {
+    for ( uint r = 0; r < numRows / 2; ++r )
+    {
+        std::swap( block[2 * r], block[2 * ( numRows - 1 - r )] );
+        std::swap( block[2 * r + 1], block[2 * ( numRows - 1 - r ) + 1] );
+    }
+}
+
+// Reverse the first numRows rows of the 3 bits indices of a BC3 alpha or BC4 block, 12 bits per
+// row after the two endpoints.
+inline void flipInterpolatedBlock( unsigned char* block, uint numRows ) {
+    uint64_t bits = 0;
+    for ( uint i = 0; i < 6; ++i )
+    {
+        bits |= uint64_t( block[2 + i] ) << ( 8 * i );
+    }
+    uint64_t rows[4];
+    for ( uint r = 0; r < 4; ++r )
+    {
+        rows[r] = ( bits >> ( 12 * r ) ) & 0xfff;
+    }
+    std::reverse( rows, rows + numRows );
+    bits = rows[0] | ( rows[1] << 12 ) | ( rows[2] << 24 ) | ( rows[3] << 36 );
+    for ( uint i = 0; i < 6; ++i )
+    {
+        block[2 + i] = ( bits >> ( 8 * i ) ) & 0xff;
+    }
+}
+
+// Reverse the first numRows rows of a block, returns false if the format cannot be flipped.
+bool flipBlock( GLenum format, unsigned char* block, uint numRows ) {
+    switch ( format )
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+        flipColorBlock( block, numRows );
+        return true;
+    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+        flipExplicitAlphaBlock( block, numRows );
+        flipColorBlock( block + 8, numRows );
+        return true;
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+        flipInterpolatedBlock( block, numRows );
+        flipColorBlock( block + 8, numRows );
+        return true;
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_SIGNED_RED_RGTC1:
+        flipInterpolatedBlock( block, numRows );
+        return true;
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_SIGNED_RG_RGTC2:
+        flipInterpolatedBlock( block, numRows );
+        flipInterpolatedBlock( block + 8, numRows );
+        return true;
+    default:
+        // The layout of the BC6H and BC7 blocks depends on their mode.
+        return false;
+    }
+}
+
+// Flip the levels vertically, as stb does for the other images : DDS files store the top row
+// first, OpenGL expects the bottom one first. Only the rows of the image are flipped in the
+// levels smaller than a block. Returns false if the format cannot be flipped.
+bool flipVertically( CompressedImage& image ) {
+    const uint blockSize = getBlockSize( image.internalFormat );
+    uint width = image.width;
+    uint height = image.height;
+    for ( auto& level : image.levels )
+    {
+        const size_t rowSize = size_t( std::max( 1u, ( width + 3 ) / 4 ) ) * blockSize;
+        const uint numBlockRows = std::max( 1u, ( height + 3 ) / 4 );
+        for ( uint r = 0; r < numBlockRows / 2; ++r )
+        {
+            std::swap_ranges( level.begin() + r * rowSize, level.begin() + ( r + 1 ) * rowSize,
+                              level.begin() + ( numBlockRows - 1 - r ) * rowSize );
+        }
+        const uint numRows = std::min( height, 4u );
+        for ( size_t offset = 0; offset + blockSize <= level.size(); offset += blockSize )
+        {
+            if ( !flipBlock( image.internalFormat, level.data() + offset, numRows ) )
+            {
+                return false;
+            }
+        }
+        width = std::max( 1u, width / 2 );
+        height = std::max( 1u, height / 2 );
+    }
+    return true;
+}
+
+// Split the mip chain stored contiguously from the given offset.
+bool readMipChain( const Buffer& buffer, size_t offset, uint numLevels, CompressedImage& image ) {
+    const uint blockSize = getBlockSize( image.internalFormat );
+    uint width = image.width;
+    uint height = image.height;
+    image.levels.clear();
+    for ( uint level = 0; level < numLevels; ++level )
+    {
+        const size_t size = getLevelSize( width, height, blockSize );
+        if ( offset + size > buffer.size() )
+        {
+            return false;
+        }
+        image.levels.emplace_back( buffer.begin() + offset, buffer.begin() + offset + size );
+        offset += size;
+        width = std::max( 1u, width / 2 );
+        height = std::max( 1u, height / 2 );
+    }
+    return true;
+}
+
+bool loadDDS( const std::string& filename, const Buffer& buffer, CompressedImage& image ) {
+    // Magic number (4 bytes) followed by a 124 bytes header.
+    const size_t headerSize = 4 + 124;
+    if ( buffer.size() < headerSize || readUint32( buffer, 0 ) != makeFourCC( "DDS " ) )
+    {
+        LOG( Core::Utils::logERROR ) << "Invalid DDS file \"" << filename << "\".";
+        return false;
+    }
+
+    const uint32_t caps2 = readUint32( buffer, 4 + 108 );
+    const uint32_t depth = readUint32( buffer, 4 + 20 );
+    const uint32_t ddsCaps2Cubemap = 0x200;
+    const uint32_t ddsCaps2Volume = 0x200000;
+    if ( ( caps2 & ( ddsCaps2Cubemap | ddsCaps2Volume ) ) != 0 || depth > 1 )
+    {
+        LOG( Core::Utils::logERROR ) << "DDS file \"" << filename
+                                     << "\" : only 2D textures are supported.";
+        return false;
+    }
+
+    image.height = readUint32( buffer, 4 + 8 );
+    image.width = readUint32( buffer, 4 + 12 );
+    const uint numLevels = std::max( 1u, readUint32( buffer, 4 + 24 ) );
+    const uint32_t fourCC = readUint32( buffer, 4 + 80 );
+
+    size_t offset = headerSize;
+    if ( fourCC == makeFourCC( "DXT1" ) )
+    {
+        image.internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    } else if ( fourCC == makeFourCC( "DXT3" ) )
+    {
+        image.internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+    } else if ( fourCC == makeFourCC( "DXT5" ) )
+    {
+        image.internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    } else if ( fourCC == makeFourCC( "ATI1" ) || fourCC == makeFourCC( "BC4U" ) )
+    {
+        image.internalFormat = GL_COMPRESSED_RED_RGTC1;
+    } else if ( fourCC == makeFourCC( "ATI2" ) || fourCC == makeFourCC( "BC5U" ) )
+    {
+        image.internalFormat = GL_COMPRESSED_RG_RGTC2;
+    } else if ( fourCC == makeFourCC( "DX10" ) )
+    {
+        // Extended header : format, dimension, misc flags, array size, misc flags 2.
+        const size_t dx10HeaderSize = 20;
+        if ( buffer.size() < headerSize + dx10HeaderSize )
+        {
+            LOG( Core::Utils::logERROR ) << "Invalid DDS file \"" << filename << "\".";
+            return false;
+        }
+        const uint32_t dimension = readUint32( buffer, headerSize + 4 );
+        const uint32_t miscFlags = readUint32( buffer, headerSize + 8 );
+        const uint32_t arraySize = readUint32( buffer, headerSize + 12 );
+        const uint32_t texture2D = 3;
+        const uint32_t textureCube = 0x4;
+        if ( dimension != texture2D || ( miscFlags & textureCube ) != 0 || arraySize > 1 )
+        {
+            LOG( Core::Utils::logERROR ) << "DDS file \"" << filename
+                                         << "\" : only 2D textures are supported.";
+            return false;
+        }
+        image.internalFormat = getDxgiFormat( readUint32( buffer, headerSize ) );
+        offset += dx10HeaderSize;
+    }
+
+    if ( getBlockSize( image.internalFormat ) == 0 )
+    {
+        LOG( Core::Utils::logERROR ) << "DDS file \"" << filename
+                                     << "\" : unsupported format, only BC1 to BC7 are supported.";
+        return false;
+    }
+
+    if ( !readMipChain( buffer, offset, numLevels, image ) )
+    {
+        LOG( Core::Utils::logERROR ) << "DDS file \"" << filename << "\" is truncated.";
+        return false;
+    }
+
+    if ( !flipVertically( image ) )
+    {
+        LOG( Core::Utils::logWARNING ) << "DDS file \"" << filename
+                                       << "\" : BC6H and BC7 images cannot be flipped, the "
+                                          "texture coordinates must be flipped instead.";
+    } else if ( image.height > 4 && image.height % 4 != 0 )
+    {
+        LOG( Core::Utils::logWARNING ) << "DDS file \"" << filename
+                                       << "\" : the height is not a multiple of 4, the flipped "
+                                          "image is shifted by the padding rows.";
+    }
+    return true;
+}
+
+bool loadKTX( const std::string& filename, const Buffer& buffer, CompressedImage& image ) {
+    // 12 bytes identifier followed by 13 32 bits fields.
+    static const unsigned char identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31,
+                                                 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+    const size_t headerSize = 64;
+    if ( buffer.size() < headerSize || std::memcmp( buffer.data(), identifier, 12 ) != 0 )
+    {
+        LOG( Core::Utils::logERROR ) << "Invalid KTX file \"" << filename << "\".";
+        return false;
+    }
+
+    if ( readUint32( buffer, 12 ) != 0x04030201 )
+    {
+        LOG( Core::Utils::logERROR ) << "KTX file \"" << filename
+                                     << "\" : big endian files are not supported.";
+        return false;
+    }
+
+    const uint32_t glType = readUint32( buffer, 16 );
+    const uint32_t glInternalFormat = readUint32( buffer, 28 );
+    image.width = readUint32( buffer, 36 );
+    image.height = std::max( 1u, readUint32( buffer, 40 ) );
+    const uint32_t depth = readUint32( buffer, 44 );
+    const uint32_t numArrayElements = readUint32( buffer, 48 );
+    const uint32_t numFaces = readUint32( buffer, 52 );
+    const uint numLevels = std::max( 1u, readUint32( buffer, 56 ) );
+    const uint32_t keyValueSize = readUint32( buffer, 60 );
+
+    image.internalFormat = static_cast<GLenum>( glInternalFormat );
+    if ( glType != 0 || getBlockSize( image.internalFormat ) == 0 )
+    {
+        LOG( Core::Utils::logERROR ) << "KTX file \"" << filename
+                                     << "\" : unsupported format, only BC1 to BC7 are supported.";
+        return false;
+    }
+    if ( depth > 0 || numArrayElements > 0 || numFaces != 1 )
+    {
+        LOG( Core::Utils::logERROR ) << "KTX file \"" << filename
+                                     << "\" : only 2D textures are supported.";
+        return false;
+    }
+
+    // Each level is preceded by its size, and padded to 4 bytes.
+    size_t offset = headerSize + keyValueSize;
+    image.levels.clear();
+    for ( uint level = 0; level < numLevels; ++level )
+    {
+        if ( offset + 4 > buffer.size() )
+        {
+            break;
+        }
+        const size_t size = readUint32( buffer, offset );
+        offset += 4;
+        if ( offset + size > buffer.size() )
+        {
+            break;
+        }
+        image.levels.emplace_back( buffer.begin() + offset, buffer.begin() + offset + size );
+        offset += ( size + 3 ) & ~size_t( 3 );
+    }
+
+    if ( image.levels.size() != numLevels )
+    {
+        LOG( Core::Utils::logERROR ) << "KTX file \"" << filename << "\" is truncated.";
+        return false;
+    }
+    return true;
+}
+
+std::string getExtension( const std::string& filename ) {
+    const auto dot = filename.find_last_of( '.' );
+    if ( dot == std::string::npos )
+    {
+        return std::string();
+    }
+    std::string extension = filename.substr( dot + 1 );
+    std::transform( extension.begin(), extension.end(), extension.begin(),
+                    []( unsigned char c ) { return char( std::tolower( c ) ); } );
+    return extension;
+}
+
+} // namespace
+
+bool isCompressedImageFile( const std::string& filename ) {
+    const std::string extension = getExtension( filename );
+    return extension == "dds" || extension == "ktx";
+}
+
+bool loadCompressedImage( const std::string& filename, CompressedImage& image ) {
+    std::ifstream file( filename, std::ios::binary );
+    if ( !file )
+    {
+        LOG( Core::Utils::logERROR ) << "Cannot open image file \"" << filename << "\".";
+        return false;
+    }
+    const Buffer buffer( ( std::istreambuf_iterator<char>( file ) ),
+                         std::istreambuf_iterator<char>() );
+
+    if ( getExtension( filename ) == "dds" )
+    {
+        return loadDDS( filename, buffer, image );
+    }
+    return loadKTX( filename, buffer, image );
+}
+
+} // namespace Engine
+} // namespace Ra
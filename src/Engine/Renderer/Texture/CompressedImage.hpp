@@ -0,0 +1,50 @@
+#ifndef RADIUMENGINE_COMPRESSEDIMAGE_HPP
+#define RADIUMENGINE_COMPRESSEDIMAGE_HPP
+
+#include <Engine/RaEngine.hpp>
+
+#include <string>
+#include <vector>
+
+#include <Engine/Renderer/OpenGL/OpenGL.hpp>
+
+namespace Ra {
+namespace Engine {
+/**
+ * Mip chain of a block-compressed (BCn) 2D image, as stored in KTX or DDS files.
+ * The data is uploaded as is on the GPU, with OpenGL conventions (first row at the
+ * bottom of the image), as KTX files. DDS files store the top row first and are
+ * flipped on load, as the images loaded by stb.
+ */
+struct CompressedImage {
+    uint width = 0;
+    uint height = 0;
+
+    /// Compressed OpenGL internal format (e.g. GL_COMPRESSED_RGBA_S3TC_DXT5_EXT).
+    GLenum internalFormat = GL_NONE;
+
+    /// Content of each mip level, from the finest to the coarsest one.
+    std::vector<std::vector<unsigned char>> levels;
+};
+
+/**
+ * Returns true if the given file is a KTX or DDS file, according to its extension.
+ */
+RA_ENGINE_API bool isCompressedImageFile( const std::string& filename );
+
+/**
+ * Load a block-compressed 2D image from a KTX (version 1) or DDS file.
+ * Only BC1 to BC7 formats are supported, cube maps, arrays and volume textures are rejected.
+ * The BC1 to BC5 DDS images are flipped vertically. The BC6H and BC7 blocks cannot be flipped
+ * without decoding them, these DDS images are kept upside down and a warning is logged.
+ * @param filename The file to load.
+ * @param image The loaded image.
+ * @return true if the image has been loaded, false otherwise (the error is logged).
+ * @note This function does not need an OpenGL context and can be called from any thread.
+ */
+RA_ENGINE_API bool loadCompressedImage( const std::string& filename, CompressedImage& image );
+
+} // namespace Engine
+} // namespace Ra
+
+#endif // RADIUMENGINE_COMPRESSEDIMAGE_HPP
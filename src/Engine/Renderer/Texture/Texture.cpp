@@ -1,13 +1,23 @@
 #include <Engine/Renderer/Texture/Texture.hpp>
 
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
+
 #include <globjects/Texture.h>
 
+#include <algorithm>
+
 namespace Ra {
 Engine::Texture::Texture( std::string name ) :
     m_name( name ),
+    m_isPlaceholder( false ),
+    m_isManaged( false ),
+    m_isCompressed( false ),
+    m_isEvicted( false ),
     m_texture( nullptr ) {}
 
-Engine::Texture::~Texture() {}
+Engine::Texture::~Texture() {
+    GpuMemoryTracker::release( this );
+}
 
 void Engine::Texture::Generate( uint w, GLenum format, void* data ) {
     m_target = GL_TEXTURE_1D;
@@ -20,10 +30,12 @@ void Engine::Texture::Generate( uint w, GLenum format, void* data ) {
 
     updateParameters();
 
-    m_texture->generateMipmap();
+    generateMipmapIfNeeded();
 
     m_format = format;
     m_width = w;
+    m_isCompressed = false;
+    trackGpuSize( GpuMemoryTracker::getTexelSize( internalFormat ) * w );
 }
 
 void Engine::Texture::Generate( uint w, uint h, GLenum format, void* data ) {
@@ -37,11 +49,13 @@ void Engine::Texture::Generate( uint w, uint h, GLenum format, void* data ) {
 
     updateParameters();
 
-    m_texture->generateMipmap();
+    generateMipmapIfNeeded();
 
     m_format = format;
     m_width = w;
     m_height = h;
+    m_isCompressed = false;
+    trackGpuSize( GpuMemoryTracker::getTexelSize( internalFormat ) * w * h );
 }
 
 void Engine::Texture::Generate( uint w, uint h, uint d, GLenum format, void* data ) {
@@ -55,12 +69,14 @@ void Engine::Texture::Generate( uint w, uint h, uint d, GLenum format, void* dat
 
     updateParameters();
 
-    m_texture->generateMipmap();
+    generateMipmapIfNeeded();
 
     m_format = format;
     m_width = w;
     m_height = h;
     m_depth = d;
+    m_isCompressed = false;
+    trackGpuSize( GpuMemoryTracker::getTexelSize( internalFormat ) * w * h * d );
 }
 
 void Engine::Texture::GenerateCube( uint w, uint h, GLenum format, void** data ) {
@@ -74,14 +90,122 @@ void Engine::Texture::GenerateCube( uint w, uint h, GLenum format, void** data )
 
     updateParameters();
 
-    m_texture->generateMipmap();
+    generateMipmapIfNeeded();
 
     m_format = format;
     m_width = w;
     m_height = h;
+    m_isCompressed = false;
+    trackGpuSize( GpuMemoryTracker::getTexelSize( internalFormat ) * w * h * 6 );
+}
+
+void Engine::Texture::GenerateCompressed( uint w, uint h,
+                                          const std::vector<std::vector<unsigned char>>& levels ) {
+    CORE_ASSERT( !levels.empty(), "No data to upload" );
+    m_target = GL_TEXTURE_2D;
+    if ( m_texture == nullptr )
+    {
+        m_texture = globjects::Texture::create( m_target );
+    }
+
+    uint levelWidth = w;
+    uint levelHeight = h;
+    std::size_t size = 0;
+    for ( uint i = 0; i < levels.size(); ++i )
+    {
+        size += levels[i].size();
+        m_texture->compressedImage2D( GLint( i ), internalFormat, levelWidth, levelHeight, 0,
+                                      GLsizei( levels[i].size() ), levels[i].data() );
+        levelWidth = std::max( 1u, levelWidth / 2 );
+        levelHeight = std::max( 1u, levelHeight / 2 );
+    }
+    // Only the given levels are available, restrict sampling to them.
+    m_texture->setParameter( GL_TEXTURE_MAX_LEVEL, GLint( levels.size() - 1 ) );
+
+    updateParameters();
+
+    m_format = internalFormat;
+    m_width = w;
+    m_height = h;
+    m_isCompressed = true;
+    trackGpuSize( size, true );
+}
+
+bool Engine::Texture::hasMipmaps() const {
+    switch ( minFilter )
+    {
+    case GL_NEAREST_MIPMAP_NEAREST:
+    case GL_LINEAR_MIPMAP_NEAREST:
+    case GL_NEAREST_MIPMAP_LINEAR:
+    case GL_LINEAR_MIPMAP_LINEAR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void Engine::Texture::generateMipmapIfNeeded() {
+    if ( hasMipmaps() )
+    {
+        m_texture->generateMipmap();
+    }
+}
+
+void Engine::Texture::trackGpuSize( std::size_t size, bool withLevels ) {
+    // The mip levels add a third of the finest level.
+    if ( !withLevels && hasMipmaps() )
+    {
+        size += size / 3;
+    }
+    // Generating the texture again replaces the evicted content.
+    m_isEvicted = false;
+    m_evictedData.clear();
+    m_evictedData.shrink_to_fit();
+
+    GpuMemoryTracker::setSize( this,
+                               m_isManaged ? GpuMemoryTracker::RESOURCE_TEXTURE
+                                           : GpuMemoryTracker::RESOURCE_RENDER_TARGET,
+                               m_name, size );
+    if ( m_isManaged && m_target == GL_TEXTURE_2D && !m_isCompressed )
+    {
+        GpuMemoryTracker::setEvictable( this, [this]() { evictGL(); } );
+    } else
+    { GpuMemoryTracker::setEvictable( this, nullptr ); }
+}
+
+void Engine::Texture::evictGL() {
+    if ( m_texture == nullptr || m_isEvicted )
+    {
+        return;
+    }
+    m_evictedData.resize( std::size_t( m_width ) * m_height *
+                          GpuMemoryTracker::getPixelSize( m_format, dataType ) );
+    m_texture->bind();
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 ) );
+    GL_ASSERT( glPixelStorei( GL_PACK_ALIGNMENT, 1 ) );
+    GL_ASSERT( glGetTexImage( m_target, 0, m_format, dataType, m_evictedData.data() ) );
+    GL_ASSERT( glPixelStorei( GL_PACK_ALIGNMENT, 4 ) );
+    m_texture.reset();
+    m_isEvicted = true;
+    GpuMemoryTracker::setEvicted( this );
+}
+
+void Engine::Texture::restoreGL() {
+    std::vector<unsigned char> data;
+    std::swap( data, m_evictedData );
+    m_isEvicted = false;
+    // The saved rows are tightly packed.
+    GL_ASSERT( glPixelStorei( GL_UNPACK_ALIGNMENT, 1 ) );
+    Generate( m_width, m_height, m_format, data.data() );
+    GL_ASSERT( glPixelStorei( GL_UNPACK_ALIGNMENT, 4 ) );
 }
 
 void Engine::Texture::bind( int unit ) {
+    if ( m_isEvicted )
+    {
+        restoreGL();
+    }
+    GpuMemoryTracker::markUsed( this );
     if ( unit >= 0 )
     {
         m_texture->bindActive( unit );
@@ -90,6 +214,10 @@ void Engine::Texture::bind( int unit ) {
 }
 
 void Engine::Texture::updateData( void* data ) {
+    if ( m_isEvicted )
+    {
+        restoreGL();
+    }
     switch ( m_texture->target() )
     {
     case GL_TEXTURE_1D:
@@ -118,6 +246,11 @@ void Engine::Texture::updateData( void* data ) {
 
 // let the compiler warn about case fallthrough
 void Engine::Texture::updateParameters() {
+    // The parameters of an evicted texture are set when it is restored.
+    if ( m_texture == nullptr )
+    {
+        return;
+    }
     switch ( m_texture->target() )
     {
     case GL_TEXTURE_CUBE_MAP:
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <Engine/Renderer/OpenGL/OpenGL.hpp>
 
@@ -165,17 +166,52 @@ class RA_ENGINE_API Texture final {
      */
     void GenerateCube( uint width, uint height, GLenum format, void** data = nullptr );
 
+    /**
+     * @brief Init the texture 2D from block-compressed data.
+     *
+     * The internalFormat attribute must be set to the compressed format of the data
+     * (e.g. GL_COMPRESSED_RGBA_S3TC_DXT5_EXT). The given mip levels are uploaded as is,
+     * and no other level is generated.
+     *
+     * @param width Width of the finest level.
+     *
+     * @param height Height of the finest level.
+     *
+     * @param levels Content of each mip level, from the finest to the coarsest one.
+     */
+    void GenerateCompressed( uint width, uint height,
+                             const std::vector<std::vector<unsigned char>>& levels );
+
     /**
      * @brief Bind the texture to enable its use in a shader
+     * The content of an evicted texture is sent again to the GPU before binding it.
      * @param unit Index of the texture to be bound. If -1 only calls glBindTexture.
      */
     void bind( int unit = -1 );
 
+    /**
+     * Move the content of the texture to the CPU memory and delete the OpenGL texture.
+     * Only the 2D uncompressed textures of the TextureManager are evicted, by the
+     * GpuMemoryTracker budget policy when they have not been used for a while.
+     */
+    void evictGL();
+
+    /**
+     * @return true if the texture has been evicted by evictGL().
+     */
+    inline bool isEvicted() const { return m_isEvicted; }
+
     /**
      * @return Name of the texture.
      */
     inline std::string getName() const { return m_name; }
 
+    /**
+     * @return true if the texture content is a placeholder, waiting for the actual data
+     * to be loaded by the TextureManager.
+     */
+    inline bool isPlaceholder() const { return m_isPlaceholder; }
+
     /**
      * Update the data contained by the texture
      * @param newData The new data, must contain the same number of elements than old data, no check
@@ -194,12 +230,29 @@ class RA_ENGINE_API Texture final {
     GLenum format() const { return m_format; }
     uint width() const { return m_width; }
     uint height() const { return m_height; }
+    /// The OpenGL texture, which is null while the texture is evicted.
     globjects::Texture* texture() const { return m_texture.get(); }
 
   private:
     Texture( const Texture& ) = delete;
     void operator=( const Texture& ) = delete;
 
+    /// Returns true if the min filter uses mip levels.
+    bool hasMipmaps() const;
+
+    /// Generate the mip levels if the min filter uses them.
+    void generateMipmapIfNeeded();
+
+    /// Report the size of the texture to the GpuMemoryTracker, given the size of its finest
+    /// level, or of all its levels if withLevels is true. Done each time the storage is
+    /// allocated.
+    void trackGpuSize( std::size_t size, bool withLevels = false );
+
+    /// Send the content saved by evictGL() to a new OpenGL texture.
+    void restoreGL();
+
+    friend class TextureManager;
+
   private:
     GLenum m_target;
     std::string m_name;
@@ -209,6 +262,15 @@ class RA_ENGINE_API Texture final {
     uint m_height;
     uint m_depth;
 
+    bool m_isPlaceholder;
+
+    /// True for the textures created by the TextureManager, which can be evicted.
+    bool m_isManaged;
+    bool m_isCompressed;
+    bool m_isEvicted;
+    /// Content of the finest level while the texture is evicted.
+    std::vector<unsigned char> m_evictedData;
+
     std::unique_ptr<globjects::Texture> m_texture;
 };
 } // namespace Engine
@@ -1,21 +1,58 @@
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
 #include <Engine/Renderer/Texture/Texture.hpp>
 #include <Engine/Renderer/Texture/TextureManager.hpp>
 
 #include <Core/Utils/Log.hpp>
+#include <Core/Utils/Profiler.hpp>
+#include <Core/Utils/Timer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
 
 namespace Ra {
 namespace Engine {
-TextureManager::TextureManager() : m_verbose( false ) {}
+TextureManager::TextureManager() :
+    m_verbose( false ),
+    m_asyncLoading( true ),
+    m_uploadBudget( 4000 ),
+    m_uploadBuffer( 0 ),
+    m_uploadBufferSize( 0 ),
+    m_numPendingLoads( 0 ),
+    m_shuttingDown( false ) {
+    // Set once for all, as the loading threads share the stb state.
+    stbi_set_flip_vertically_on_load( true );
+}
 
 TextureManager::~TextureManager() {
+    {
+        std::lock_guard<std::mutex> lock( m_loadingMutex );
+        m_shuttingDown = true;
+    }
+    m_loadingNotifier.notify_all();
+    for ( auto& t : m_loadingThreads )
+    {
+        t.join();
+    }
+    for ( auto& loaded : m_loadedQueue )
+    {
+        stbi_image_free( loaded.data.data );
+    }
+
     for ( auto& tex : m_textures )
     {
         delete tex.second;
     }
     m_textures.clear();
+
+    if ( m_uploadBuffer != 0 )
+    {
+        glDeleteBuffers( 1, &m_uploadBuffer );
+        GpuMemoryTracker::release( &m_uploadBuffer );
+    }
 }
 
 TextureData& TextureManager::addTexture( const std::string& name, int width, int height,
@@ -31,12 +68,10 @@ TextureData& TextureManager::addTexture( const std::string& name, int width, int
     return m_pendingTextures[name];
 }
 
-TextureData TextureManager::loadTexture( const std::string& filename ){
+TextureData TextureManager::loadTexture( const std::string& filename ) const {
     TextureData texData;
     texData.name = filename;
 
-    stbi_set_flip_vertically_on_load( true );
-
     int  n;
     unsigned char* data = stbi_load( filename.c_str(), &(texData.width), &(texData.height), &n, 0 );
 
@@ -99,6 +134,171 @@ TextureData TextureManager::loadTexture( const std::string& filename ){
 
 }
 
+TextureManager::LoadedTexture TextureManager::decodeTexture( const TextureData& data ) const {
+    RA_PROFILE_SCOPE( "TextureManager::decodeTexture" );
+    LoadedTexture loaded;
+    loaded.data = data;
+
+    if ( isCompressedImageFile( data.name ) )
+    {
+        if ( loadCompressedImage( data.name, loaded.compressed ) )
+        {
+            loaded.data.width = int( loaded.compressed.width );
+            loaded.data.height = int( loaded.compressed.height );
+            loaded.data.internalFormat = loaded.compressed.internalFormat;
+        } else
+        { loaded.compressed.levels.clear(); }
+    } else
+    {
+        auto stbidata = loadTexture( data.name );
+        loaded.data.width = stbidata.width;
+        loaded.data.height = stbidata.height;
+        loaded.data.data = stbidata.data;
+        loaded.data.type = stbidata.type;
+        loaded.data.format = stbidata.format;
+        loaded.data.internalFormat = stbidata.internalFormat;
+    }
+    return loaded;
+}
+
+Texture* TextureManager::createTexture( const TextureData& data ) const {
+    Texture* tex = new Texture( data.name );
+    tex->internalFormat = data.internalFormat;
+    tex->dataType = data.type;
+    tex->minFilter = data.minFilter;
+    tex->magFilter = data.magFilter;
+    tex->wrapS = data.wrapS;
+    tex->wrapT = data.wrapT;
+    tex->m_isManaged = true;
+    return tex;
+}
+
+void TextureManager::uploadTexture( Texture* texture, LoadedTexture& loaded ) {
+    const TextureData& data = loaded.data;
+    if ( !loaded.compressed.levels.empty() )
+    {
+        texture->internalFormat = loaded.compressed.internalFormat;
+        texture->GenerateCompressed( loaded.compressed.width, loaded.compressed.height,
+                                     loaded.compressed.levels );
+        texture->m_isPlaceholder = false;
+    } else if ( data.data != nullptr )
+    {
+        uint components = 4;
+        switch ( data.format )
+        {
+        case GL_RED:
+            components = 1;
+            break;
+        case GL_RG:
+            components = 2;
+            break;
+        case GL_RGB:
+            components = 3;
+            break;
+        default:
+            break;
+        }
+        CORE_ASSERT( data.type == GL_UNSIGNED_BYTE, "Unexpected image data type" );
+        const GLsizeiptr size = GLsizeiptr( data.width ) * data.height * components;
+
+        // Stream the image through a pixel buffer, so that the driver can perform the transfer
+        // asynchronously.
+        if ( m_uploadBuffer == 0 )
+        {
+            GL_ASSERT( glGenBuffers( 1, &m_uploadBuffer ) );
+        }
+        GL_ASSERT( glBindBuffer( GL_PIXEL_UNPACK_BUFFER, m_uploadBuffer ) );
+        if ( size > m_uploadBufferSize )
+        {
+            GL_ASSERT( glBufferData( GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW ) );
+            m_uploadBufferSize = size;
+            GpuMemoryTracker::setSize( &m_uploadBuffer, GpuMemoryTracker::RESOURCE_BUFFER,
+                                       "Texture upload", std::size_t( size ) );
+        }
+        void* buffer = glMapBufferRange( GL_PIXEL_UNPACK_BUFFER, 0, size,
+                                         GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT );
+        CORE_ASSERT( buffer, "Unable to map the texture upload buffer" );
+        std::memcpy( buffer, data.data, size_t( size ) );
+        GL_ASSERT( glUnmapBuffer( GL_PIXEL_UNPACK_BUFFER ) );
+
+        // Rows of decoded images are tightly packed.
+        GL_ASSERT( glPixelStorei( GL_UNPACK_ALIGNMENT, 1 ) );
+        texture->internalFormat = data.internalFormat;
+        texture->dataType = data.type;
+        texture->Generate( data.width, data.height, data.format, nullptr );
+        GL_ASSERT( glPixelStorei( GL_UNPACK_ALIGNMENT, 4 ) );
+        GL_ASSERT( glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 ) );
+        texture->m_isPlaceholder = false;
+
+        stbi_image_free( loaded.data.data );
+        loaded.data.data = nullptr;
+    }
+}
+
+void TextureManager::uploadLoadedTextures( long budget ) {
+    const auto start = Core::Utils::Clock::now();
+    while ( true )
+    {
+        LoadedTexture loaded;
+        {
+            std::lock_guard<std::mutex> lock( m_loadingMutex );
+            if ( m_loadedQueue.empty() )
+            {
+                break;
+            }
+            loaded = std::move( m_loadedQueue.front() );
+            m_loadedQueue.pop_front();
+        }
+
+        // The texture may have been deleted while loading.
+        auto it = m_textures.find( loaded.data.name );
+        if ( it != m_textures.end() )
+        {
+            uploadTexture( it->second, loaded );
+        }
+        stbi_image_free( loaded.data.data );
+
+        {
+            std::lock_guard<std::mutex> lock( m_loadingMutex );
+            --m_numPendingLoads;
+        }
+
+        if ( Core::Utils::getIntervalMicro( start, Core::Utils::Clock::now() ) > budget )
+        {
+            break;
+        }
+    }
+}
+
+void TextureManager::runLoadingThread() {
+#ifdef ALLOW_PROFILING
+    Core::Utils::Profiler::setThreadName( "Texture loading" );
+#endif
+    while ( true )
+    {
+        TextureData data;
+        {
+            std::unique_lock<std::mutex> lock( m_loadingMutex );
+            m_loadingNotifier.wait(
+                lock, [this]() { return m_shuttingDown || !m_loadingQueue.empty(); } );
+            if ( m_shuttingDown )
+            {
+                return;
+            }
+            data = m_loadingQueue.front();
+            m_loadingQueue.pop_front();
+        }
+
+        LoadedTexture loaded = decodeTexture( data );
+
+        {
+            std::lock_guard<std::mutex> lock( m_loadingMutex );
+            m_loadedQueue.push_back( std::move( loaded ) );
+        }
+        m_loadedNotifier.notify_all();
+    }
+}
+
 Texture* TextureManager::getOrLoadTexture( const TextureData& data ) {
     m_pendingTextures[data.name] = data;
     return getOrLoadTexture( data.name );
@@ -107,57 +307,60 @@ Texture* TextureManager::getOrLoadTexture( const TextureData& data ) {
 /// FIXME : for the moment, Texture name is equivalent to file name if the texture is loaded by the manager.
 /// Must allow to differentiates the two.
 Texture* TextureManager::getOrLoadTexture( const std::string& filename ) {
-    Texture* ret = nullptr;
     auto it = m_textures.find( filename );
-
     if ( it != m_textures.end() )
     {
-        ret = it->second;
-    } else {
-        auto makeTexture = [](const TextureData &data) -> Texture* {
-            Texture* tex = new Texture( data.name );
-            tex->internalFormat = data.internalFormat;
-            tex->dataType = data.type;
-            tex->minFilter = data.minFilter;
-            tex->magFilter = data.magFilter;
-            tex->wrapS = data.wrapS;
-            tex->wrapT = data.wrapT;
-            tex->Generate( data.width, data.height, data.format, data.data );
-            return tex;
-        };
-
-        auto pending = m_pendingTextures.find( filename );
-        if ( pending != m_pendingTextures.end() )
-        {
-            auto data = pending->second;
-
-            bool freedata = false;
-            if (data.data == nullptr) {
+        return it->second;
+    }
 
-                auto stbidata = loadTexture(data.name);
-                data.width = stbidata.width;
-                data.height = stbidata.height;
-                data.data = stbidata.data;
-                data.type = stbidata.type;
-                data.format = stbidata.format;
-                data.internalFormat = stbidata.internalFormat;
+    TextureData data;
+    data.name = filename;
+    auto pending = m_pendingTextures.find( filename );
+    if ( pending != m_pendingTextures.end() )
+    {
+        data = pending->second;
+        m_pendingTextures.erase( pending );
+    }
 
-                freedata = true;
-            }
+    Texture* ret = createTexture( data );
+    /// FIXME : should it be data.name ?
+    m_textures[filename] = ret;
 
-            ret = makeTexture(data);
+    if ( data.data != nullptr )
+    {
+        ret->Generate( data.width, data.height, data.format, data.data );
+        return ret;
+    }
 
-            if (freedata)
-                stbi_image_free( data.data );
+    // Fill the texture with a placeholder until the image is loaded.
+    static unsigned char white[4] = {255, 255, 255, 255};
+    ret->internalFormat = GL_RGBA8;
+    ret->dataType = GL_UNSIGNED_BYTE;
+    ret->Generate( 1, 1, GL_RGBA, white );
+    ret->m_isPlaceholder = true;
 
-            m_pendingTextures.erase( filename );
-        } else {
-            auto data = loadTexture(filename);
-            ret = makeTexture(data);
-            stbi_image_free( data.data );
+    if ( m_asyncLoading )
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_loadingMutex );
+            m_loadingQueue.push_back( data );
+            ++m_numPendingLoads;
+        }
+        if ( m_loadingThreads.empty() )
+        {
+            const uint numThreads =
+                std::max( 1u, std::min( 4u, std::thread::hardware_concurrency() / 2 ) );
+            for ( uint i = 0; i < numThreads; ++i )
+            {
+                m_loadingThreads.emplace_back( &TextureManager::runLoadingThread, this );
+            }
         }
-        /// FIXME : should it be data.name ?
-        m_textures[filename] = ret;
+        m_loadingNotifier.notify_one();
+    } else
+    {
+        LoadedTexture loaded = decodeTexture( data );
+        uploadTexture( ret, loaded );
+        stbi_image_free( loaded.data.data );
     }
     return ret;
 }
@@ -183,17 +386,38 @@ void TextureManager::updateTextureContent(const std::string &texture, void *cont
 }
 
 void TextureManager::updatePendingTextures() {
-    if ( m_pendingData.empty() )
-    {
-        return;
-    }
-
     for ( auto& data : m_pendingData )
     {
         LOG( Core::Utils::logINFO ) << "TextureManager::updateTextures \"" << data.first << "\".";
         m_textures[data.first]->updateData( data.second );
     }
     m_pendingData.clear();
+
+    uploadLoadedTextures( m_uploadBudget );
+}
+
+void TextureManager::setAsynchronousLoading( bool async ) {
+    m_asyncLoading = async;
+}
+
+void TextureManager::setUploadBudget( Scalar milliseconds ) {
+    m_uploadBudget = long( milliseconds * 1000 );
+}
+
+uint TextureManager::getNumPendingLoads() {
+    std::lock_guard<std::mutex> lock( m_loadingMutex );
+    return m_numPendingLoads;
+}
+
+void TextureManager::flushPendingLoads() {
+    while ( getNumPendingLoads() > 0 )
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_loadingMutex );
+            m_loadedNotifier.wait( lock, [this]() { return !m_loadedQueue.empty(); } );
+        }
+        uploadLoadedTextures( std::numeric_limits<long>::max() );
+    }
 }
 
 RA_SINGLETON_IMPLEMENTATION( TextureManager );
@@ -2,12 +2,18 @@
 #define RADIUMENGINE_TEXTUREMANAGER_HPP
 
 #include <Engine/RaEngine.hpp>
-#include <map>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <Core/Utils/Singleton.hpp>
 
 #include <Engine/Renderer/OpenGL/OpenGL.hpp>
+#include <Engine/Renderer/Texture/CompressedImage.hpp>
 
 namespace Ra {
 namespace Engine {
@@ -40,6 +46,10 @@ struct TextureData {
 
 /**
  * Manage Texture loading and registration.
+ * Image files are decoded by a pool of background threads and uploaded to the GPU by
+ * updatePendingTextures(), within a per-frame time budget. Until then, textures have
+ * a 1x1 white placeholder content.
+ * KTX and DDS files containing block-compressed (BCn) data are uploaded without decompression.
  */
 class RA_ENGINE_API TextureManager final {
     RA_SINGLETON_INTERFACE( TextureManager );
@@ -56,6 +66,9 @@ class RA_ENGINE_API TextureManager final {
     /**
      * Get or load texture from a file.
      * The name of the texture is the name of its file
+     * If asynchronous loading is enabled, the returned texture is a placeholder until
+     * its file has been decoded and uploaded by updatePendingTextures().
+     * Requesting a texture which is already loading returns the same object.
      * @param filename
      * @return
      */
@@ -99,23 +112,97 @@ class RA_ENGINE_API TextureManager final {
      */
     void updatePendingTextures();
 
+    /**
+     * Enable or disable the decoding of image files by background threads (enabled by
+     * default). When disabled, getOrLoadTexture() decodes and uploads the image immediately.
+     */
+    void setAsynchronousLoading( bool async );
+
+    /**
+     * Set the maximal time spent uploading decoded textures in each call to
+     * updatePendingTextures(). At least one texture is uploaded per call.
+     * @param milliseconds
+     */
+    void setUploadBudget( Scalar milliseconds );
+
+    /**
+     * @return the number of textures requested but not uploaded yet.
+     */
+    uint getNumPendingLoads();
+
+    /**
+     * Wait for all the requested textures to be decoded, and upload them.
+     * Must be called with the OpenGL context bound.
+     */
+    void flushPendingLoads();
+
   private:
     TextureManager();
     ~TextureManager();
 
+    /// Image decoded by a loading thread, waiting to be uploaded.
+    struct LoadedTexture {
+        TextureData data;
+        CompressedImage compressed;
+    };
+
+    /// Create the Texture object with the parameters of the given data.
+    Texture* createTexture( const TextureData& data ) const;
+
+    /// Decode the image file of the given data. Can be called from any thread.
+    LoadedTexture decodeTexture( const TextureData& data ) const;
+
+    /// Upload the decoded data to the given texture, and free it.
+    void uploadTexture( Texture* texture, LoadedTexture& loaded );
+
+    /// Upload the decoded textures until the given time (in microseconds) is elapsed.
+    void uploadLoadedTextures( long budget );
+
+    /// Function run by the loading threads.
+    void runLoadingThread();
+
     /** Load a given filename and return the associated TextureData.
     * @note : only loads 2D image file for now.
     * @param filename
     * @return
     */
-    TextureData loadTexture( const std::string& filename );
+    TextureData loadTexture( const std::string& filename ) const;
 
 private:
-    std::map<std::string, Texture*> m_textures;
-    std::map<std::string, TextureData> m_pendingTextures;
-    std::map<std::string, void*> m_pendingData;
+    std::unordered_map<std::string, Texture*> m_textures;
+    std::unordered_map<std::string, TextureData> m_pendingTextures;
+    std::unordered_map<std::string, void*> m_pendingData;
 
     bool m_verbose;
+    bool m_asyncLoading;
+
+    /// Maximal time spent uploading textures per frame, in microseconds.
+    long m_uploadBudget;
+
+    /// Pixel buffer used to stream the decoded images to the GPU.
+    GLuint m_uploadBuffer;
+    GLsizeiptr m_uploadBufferSize;
+
+    /// Threads decoding the image files.
+    std::vector<std::thread> m_loadingThreads;
+
+    //
+    // mutex protected variables.
+    //
+
+    /// Textures waiting to be decoded.
+    std::deque<TextureData> m_loadingQueue;
+    /// Decoded textures waiting to be uploaded.
+    std::deque<LoadedTexture> m_loadedQueue;
+    /// Number of textures requested but not uploaded yet.
+    uint m_numPendingLoads;
+    /// Flag to signal the loading threads to quit.
+    bool m_shuttingDown;
+    /// Variable on which loading threads wait for new textures.
+    std::condition_variable m_loadingNotifier;
+    /// Variable signaled each time a texture has been decoded.
+    std::condition_variable m_loadedNotifier;
+    std::mutex m_loadingMutex;
 };
 
 } // namespace Engine
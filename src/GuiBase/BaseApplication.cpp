@@ -18,11 +18,13 @@
 #include <Engine/Managers/SystemDisplay/SystemDisplay.hpp>
 #include <Engine/RadiumEngine.hpp>
 #include <Engine/Renderer/Mesh/Mesh.hpp>
+#include <Engine/Renderer/OpenGL/GpuMemoryTracker.hpp>
 #include <Engine/Renderer/RenderObject/RenderObject.hpp>
 #include <Engine/Renderer/RenderObject/RenderObjectManager.hpp>
 #include <Engine/Renderer/RenderTechnique/ShaderConfigFactory.hpp>
 #include <Engine/Renderer/Renderer.hpp>
 #include <GuiBase/Utils/KeyMappingManager.hpp>
+#include <GuiBase/Viewer/FrameRecorder.hpp>
 #include <PluginBase/RadiumPluginInterface.hpp>
 
 #ifdef IO_USE_TINYPLY
@@ -39,6 +41,7 @@
 #include <QTimer>
 
 #include <algorithm>
+#include <ctime>
 
 // Const parameters : TODO : make config / command line options
 
@@ -56,7 +59,9 @@ BaseApplication::BaseApplication( int argc, char** argv, const WindowFactory& fa
     m_numFrames( 0 ),
     m_maxThreads( RA_MAX_THREAD ),
     m_realFrameRate( false ),
+    m_pipelinedFrames( false ),
     m_recordFrames( false ),
+    m_recordFormat( "png" ),
     m_recordTimings( false ),
     m_recordGraph( false ),
     m_isAboutToQuit( false ) {
@@ -97,9 +102,33 @@ BaseApplication::BaseApplication( int argc, char** argv, const WindowFactory& fa
                                         "name" );
     QCommandLineOption fileOpt( QStringList{"f", "file", "scene"}, "Open a scene file at startup.",
                                 "file name", "foo.bar" );
-
-    parser.addOptions(
-        {fpsOpt, pluginOpt, pluginLoadOpt, pluginIgnoreOpt, fileOpt, maxThreadsOpt, numFramesOpt} );
+    QCommandLineOption recordOpt( QStringList{"record"}, "Record the frames from startup." );
+    QCommandLineOption recordFormatOpt(
+        QStringList{"record-format"},
+        "Format of the recorded frames : png, bmp, tga, jpg, hdr or raw (RGBA8 pixels).", "format",
+        "png" );
+    QCommandLineOption recordPipeOpt(
+        QStringList{"record-pipe"},
+        "Stream the recorded frames as raw RGBA8 pixels to the standard input of the given "
+        "encoder command instead of writing image files.",
+        "command" );
+    QCommandLineOption pipelinedOpt(
+        QStringList{"pipelined"},
+        "Run the tasks of each frame while the previous one is being rendered." );
+    QCommandLineOption profileOpt(
+        QStringList{"profile"},
+        "Write the profiled zones to the given file, in the Chrome trace event format "
+        "(requires RADIUM_WITH_PROFILING).",
+        "file" );
+    QCommandLineOption gpuBudgetOpt(
+        QStringList{"gpu-budget"},
+        "Move the meshes and textures of hidden objects out of the GPU memory when it uses more "
+        "than the given number of megabytes, 0 to disable it.",
+        "megabytes", "0" );
+
+    parser.addOptions( {fpsOpt, pluginOpt, pluginLoadOpt, pluginIgnoreOpt, fileOpt, maxThreadsOpt,
+                        numFramesOpt, recordOpt, recordFormatOpt, recordPipeOpt, pipelinedOpt,
+                        profileOpt, gpuBudgetOpt} );
     parser.process( *this );
 
     if ( parser.isSet( fpsOpt ) )
@@ -110,6 +139,32 @@ BaseApplication::BaseApplication( int argc, char** argv, const WindowFactory& fa
         m_numFrames = parser.value( numFramesOpt ).toUInt();
     if ( parser.isSet( maxThreadsOpt ) )
         m_maxThreads = parser.value( maxThreadsOpt ).toUInt();
+    if ( parser.isSet( recordOpt ) )
+        m_recordFrames = true;
+    if ( parser.isSet( recordFormatOpt ) )
+        m_recordFormat = parser.value( recordFormatOpt ).toStdString();
+    if ( parser.isSet( recordPipeOpt ) )
+        m_recordPipe = parser.value( recordPipeOpt ).toStdString();
+    if ( parser.isSet( pipelinedOpt ) )
+        m_pipelinedFrames = true;
+    if ( parser.isSet( gpuBudgetOpt ) )
+        Engine::GpuMemoryTracker::setBudget( std::size_t( parser.value( gpuBudgetOpt ).toUInt() )
+                                             << 20 );
+    if ( parser.isSet( profileOpt ) )
+    {
+#ifdef ALLOW_PROFILING
+        const std::string profileFile = parser.value( profileOpt ).toStdString();
+        if ( m_profileWriter.open( profileFile ) )
+        {
+            Core::Utils::Profiler::setThreadName( "Main" );
+            Core::Utils::Profiler::setEnabled( true );
+        } else
+        { LOG( Core::Utils::logERROR ) << "Cannot open profile file " << profileFile; }
+#else
+        LOG( Core::Utils::logWARNING )
+            << "Profiling is not available, build with RADIUM_WITH_PROFILING.";
+#endif
+    }
 
     std::time_t startTime = std::time( nullptr );
     std::tm* startTm = std::localtime( &startTime );
@@ -353,23 +408,44 @@ void BaseApplication::radiumFrame() {
     // Get picking results from last frame and forward it to the selection.
     m_viewer->processPicking();
 
-    // ----------
-    // 2. Kickoff rendering
-    m_viewer->startRendering( dt );
+    if ( m_pipelinedFrames )
+    {
+        // ----------
+        // 2. and 3. Run the engine task queue during the rendering : the tasks start on the
+        // worker threads as soon as the render objects have been sent to the GPU, while the
+        // main thread draws them. The displayed state is the same as in sequential mode, the one
+        // computed by the tasks of the previous frame.
+        m_engine->getTasks( m_taskQueue.get(), dt );
+
+        if ( m_recordGraph )
+        {
+            m_taskQueue->printTaskGraph( std::cout );
+        }
 
-    timerData.tasksStart = Core::Utils::Clock::now();
+        m_viewer->startRendering( dt, [this, &timerData]() {
+            timerData.tasksStart = Core::Utils::Clock::now();
+            m_taskQueue->startTasks();
+        } );
+    } else
+    {
+        // ----------
+        // 2. Kickoff rendering
+        m_viewer->startRendering( dt );
 
-    // ----------
-    // 3. Run the engine task queue.
-    m_engine->getTasks( m_taskQueue.get(), dt );
+        timerData.tasksStart = Core::Utils::Clock::now();
 
-    if ( m_recordGraph )
-    {
-        m_taskQueue->printTaskGraph( std::cout );
-    }
+        // ----------
+        // 3. Run the engine task queue.
+        m_engine->getTasks( m_taskQueue.get(), dt );
+
+        if ( m_recordGraph )
+        {
+            m_taskQueue->printTaskGraph( std::cout );
+        }
 
-    // Run one frame of tasks
-    m_taskQueue->startTasks();
+        // Run one frame of tasks
+        m_taskQueue->startTasks();
+    }
     m_taskQueue->waitForTasks();
     timerData.taskData = m_taskQueue->getTimerData();
     m_taskQueue->flushTaskQueue();
@@ -387,7 +463,15 @@ void BaseApplication::radiumFrame() {
     m_engine->endFrameSync();
 
     // ----------
-    // 6. Frame end.
+    // 6. Record the frame, it is read back and encoded asynchronously.
+    if ( m_recordFrames )
+    {
+        recordFrame();
+        timerData.captureData = m_viewer->getFrameRecorder()->getTimerData();
+    }
+
+    // ----------
+    // 7. Frame end.
     timerData.frameEnd = Core::Utils::Clock::now();
     timerData.numFrame = m_frameCounter;
 
@@ -398,10 +482,20 @@ void BaseApplication::radiumFrame() {
 
     m_timerData.push_back( timerData );
 
-    if ( m_recordFrames )
+#ifdef ALLOW_PROFILING
+    if ( Core::Utils::Profiler::isEnabled() )
     {
-        recordFrame();
+        Core::Utils::Profiler::recordZone( "BaseApplication::events", timerData.eventsStart,
+                                           timerData.eventsEnd );
+        Core::Utils::Profiler::recordZone( "BaseApplication::tasks", timerData.tasksStart,
+                                           timerData.tasksEnd );
+        Core::Utils::Profiler::recordZone( "BaseApplication::frame", timerData.frameStart,
+                                           timerData.frameEnd );
+        m_profileZones.clear();
+        Core::Utils::Profiler::collect( m_profileZones );
+        m_profileWriter.write( m_profileZones );
     }
+#endif
 
     ++m_frameCounter;
 
@@ -447,21 +541,38 @@ void BaseApplication::setRealFrameRate( bool on ) {
     m_realFrameRate = on;
 }
 
+void BaseApplication::setPipelinedFrames( bool on ) {
+    m_pipelinedFrames = on;
+}
+
 void BaseApplication::setRecordFrames( bool on ) {
+    if ( m_recordFrames && !on )
+    {
+        // Make sure all the frames are written, and the encoder process is closed.
+        m_viewer->stopRecording();
+    }
     m_recordFrames = on;
 }
 
 void BaseApplication::recordFrame() {
+    if ( !m_viewer->isRecording() && !m_recordPipe.empty() )
+    {
+        m_viewer->makeCurrent();
+        m_viewer->getFrameRecorder()->setPipeCommand( m_recordPipe );
+        m_viewer->doneCurrent();
+    }
     std::string filename;
-    Ra::Core::Utils::stringPrintf( filename, "%s/radiumframe_%06u.png",
-                                         m_exportFoldername.c_str(), m_frameCounter );
-    m_viewer->grabFrame( filename );
+    Ra::Core::Utils::stringPrintf( filename, "%s/radiumframe_%06u.%s", m_exportFoldername.c_str(),
+                                   m_frameCounter, m_recordFormat.c_str() );
+    m_viewer->recordFrame( filename );
 }
 
 BaseApplication::~BaseApplication() {
     emit stopping();
+    setRecordFrames( false );
     m_mainWindow->cleanup();
     m_engine->cleanup();
+    m_profileWriter.close();
 
     // This will remove the directory if empty.
     QDir().rmdir( m_exportFoldername.c_str() );
@@ -6,6 +6,7 @@
 
 #include <QApplication>
 
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 #include <Core/Utils/TaskQueue.hpp>
 #include <GuiBase/TimerData/FrameTimerData.hpp>
@@ -71,6 +72,9 @@ class RA_GUIBASE_API BaseApplication : public QApplication {
     const Engine::RadiumEngine* getEngine() const { return m_engine.get(); }
 
     uint getFrameCount() const { return m_frameCounter; }
+
+    /// Register the shader configurations used by the UI and debug primitives.
+    static void addBasicShaders();
   signals:
     /// Fired when the engine has just started, before the frame timer is set.
     void starting();
@@ -95,6 +99,12 @@ class RA_GUIBASE_API BaseApplication : public QApplication {
     void initializeOpenGlPlugins();
 
     void setRealFrameRate( bool on );
+
+    /// If true, the tasks of a frame run on the worker threads while the main thread renders
+    /// (see Renderer::render()), instead of after the rendering. The displayed frames do not
+    /// change, but the tasks must not modify the techniques and materials of the render
+    /// objects, which are read by the rendering.
+    void setPipelinedFrames( bool on );
     void setRecordFrames( bool on );
     void setRecordTimings( bool on );
     void setRecordGraph( bool on );
@@ -115,7 +125,6 @@ class RA_GUIBASE_API BaseApplication : public QApplication {
                       const QStringList& ignoreList );
 
     void setupScene();
-    void addBasicShaders();
 
     // Public variables, accessible through the mainApp singleton.
   public:
@@ -153,16 +162,27 @@ class RA_GUIBASE_API BaseApplication : public QApplication {
     /// If true, use the wall clock to advance the engine. If false, use a fixed time step.
     bool m_realFrameRate;
 
+    /// If true, overlap the tasks of each frame with the rendering, see setPipelinedFrames().
+    bool m_pipelinedFrames;
+
     // Options to control monitoring and outputs
     /// Name of the folder where exported data goes
     std::string m_exportFoldername;
 
-    /// If true, dump each frame to a PNG file.
+    /// If true, dump each frame to an image file, or to m_recordPipe if set.
     bool m_recordFrames;
+    /// Extension (i.e. format) of the recorded frames.
+    std::string m_recordFormat;
+    /// Encoder command receiving the recorded frames on its standard input.
+    std::string m_recordPipe;
     /// If true, print the detailed timings of each frame
     bool m_recordTimings;
     /// If true, print the task graph;
     bool m_recordGraph;
+    /// Trace of the profiled zones, open if profiling was requested on the command line.
+    Core::Utils::ChromeTraceWriter m_profileWriter;
+    /// Zones collected at the end of each frame.
+    std::vector<Core::Utils::ProfileZone> m_profileZones;
 
     bool m_isAboutToQuit;
 };
@@ -31,6 +31,16 @@ void FrameTimerData::print( std::ostream& ostream ) const {
         ostream << "\t}"
                 << "\n";
         ostream << "\trender: " << reStart << " " << reEnd << " " << reEnd - reStart << "\n";
+        if ( captureData.captureEnd > captureData.captureStart )
+        {
+            long caStart = Ra::Core::Utils::getIntervalMicro( frameStart, captureData.captureStart );
+            long caEnd = Ra::Core::Utils::getIntervalMicro( frameStart, captureData.captureEnd );
+            ostream << "\tcapture: " << caStart << " " << caEnd << " " << caEnd - caStart
+                    << " (stall " << captureData.stallTime << ", readbacks "
+                    << captureData.pendingReadbacks << ", pending "
+                    << captureData.pendingFrames << ", dropped " << captureData.droppedFrames
+                    << ")\n";
+        }
     }
     ostream << "}"
             << "\n";
@@ -10,6 +10,7 @@
 #include <Core/Utils/TaskQueue.hpp>
 #include <Core/Utils/Timer.hpp>
 #include <Engine/Renderer/Renderer.hpp>
+#include <GuiBase/Viewer/FrameRecorder.hpp>
 
 namespace Ra {
 
@@ -24,6 +25,7 @@ struct RA_GUIBASE_API FrameTimerData {
     Core::Utils::TimePoint frameEnd;
     Engine::Renderer::TimerData renderData;
     std::vector<Core::Utils::TaskQueue::TimerData> taskData;
+    Gui::FrameRecorder::TimerData captureData; ///< Only filled when recording frames.
 
     void print( std::ostream& ostream ) const;
 };
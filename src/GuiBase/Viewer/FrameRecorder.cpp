@@ -0,0 +1,342 @@
+#include <GuiBase/Viewer/FrameRecorder.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include <stb/stb_image_write.h>
+
+#include <Core/Utils/Log.hpp>
+#include <Core/Utils/StringUtils.hpp>
+
+#include <Engine/Renderer/OpenGL/OpenGL.hpp>
+#include <Engine/Renderer/Texture/Texture.hpp>
+
+#if defined( OS_WINDOWS )
+#    define popen _popen
+#    define pclose _pclose
+#endif
+
+namespace Ra {
+namespace Gui {
+
+/// A pixel buffer receiving the content of a captured texture.
+struct FrameRecorder::Readback {
+    GLuint m_buffer;
+    GLsizeiptr m_size;
+    GLsync m_fence;
+    bool m_hdr;
+    uint m_width;
+    uint m_height;
+    std::string m_filename;
+};
+
+FrameRecorder::FrameRecorder( uint numReadbacks, uint numWorkers, uint maxPendingFrames ) :
+    m_readbacks( numReadbacks, Readback{0, 0, nullptr, false, 0, 0, ""} ),
+    m_firstReadback( 0 ),
+    m_numReadbacks( 0 ),
+    m_maxPendingFrames( maxPendingFrames ),
+    m_numEncoding( 0 ),
+    m_nextFrameIndex( 0 ),
+    m_nextPipedFrame( 0 ),
+    m_shuttingDown( false ),
+    m_pipe( nullptr ),
+    m_dropFrames( false ) {
+    CORE_ASSERT( numReadbacks > 0 && numWorkers > 0 && maxPendingFrames > 0,
+                 "The frame recorder needs at least one readback, worker and pending frame" );
+    for ( uint i = 0; i < numWorkers; ++i )
+    {
+        m_workers.emplace_back( &FrameRecorder::runWorker, this );
+    }
+}
+
+FrameRecorder::~FrameRecorder() {
+    CORE_WARN_IF( m_numReadbacks > 0, "Frames are still being read back, call releaseGL()" );
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_shuttingDown = true;
+    }
+    m_frameAvailable.notify_all();
+    for ( auto& worker : m_workers )
+    {
+        worker.join();
+    }
+    if ( m_pipe != nullptr )
+    {
+        pclose( m_pipe );
+    }
+}
+
+void FrameRecorder::setPipeCommand( const std::string& command ) {
+    // The frames in flight are written with the previous settings.
+    flush();
+    if ( m_pipe != nullptr )
+    {
+        pclose( m_pipe );
+        m_pipe = nullptr;
+    }
+    if ( !command.empty() )
+    {
+#if defined( OS_WINDOWS )
+        m_pipe = popen( command.c_str(), "wb" );
+#else
+        m_pipe = popen( command.c_str(), "w" );
+#endif
+        if ( m_pipe == nullptr )
+        {
+            LOG( Core::Utils::logERROR ) << "Unable to start the frame encoder : " << command;
+        }
+    }
+    m_nextPipedFrame = m_nextFrameIndex;
+}
+
+void FrameRecorder::capture( Engine::Texture* texture, const std::string& filename ) {
+    m_timerData.captureStart = Core::Utils::Clock::now();
+    m_timerData.stallTime = 0;
+
+    // Hand the frames which are already transferred to the encoders.
+    while ( m_numReadbacks > 0 && retireReadback( false ) )
+    {
+    }
+
+    bool dropped = false;
+    if ( m_numReadbacks == m_readbacks.size() )
+    {
+        if ( m_dropFrames )
+        {
+            ++m_timerData.droppedFrames;
+            dropped = true;
+        } else
+        {
+            const auto start = Core::Utils::Clock::now();
+            retireReadback( true );
+            m_timerData.stallTime +=
+                Core::Utils::getIntervalMicro( start, Core::Utils::Clock::now() );
+        }
+    }
+
+    if ( !dropped )
+    {
+        Readback& readback = m_readbacks[( m_firstReadback + m_numReadbacks ) % m_readbacks.size()];
+        // Only floating point images need the full texture precision, the conversion of the
+        // other ones is done by the driver during the transfer.
+        readback.m_hdr = m_pipe == nullptr && Core::Utils::getFileExt( filename ) == "hdr";
+        readback.m_width = texture->width();
+        readback.m_height = texture->height();
+        readback.m_filename = filename;
+
+        const GLsizeiptr size = GLsizeiptr( readback.m_width ) * readback.m_height * 4 *
+                                ( readback.m_hdr ? sizeof( float ) : sizeof( uchar ) );
+        if ( readback.m_buffer == 0 )
+        {
+            GL_ASSERT( glGenBuffers( 1, &readback.m_buffer ) );
+        }
+        GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, readback.m_buffer ) );
+        if ( size > readback.m_size )
+        {
+            GL_ASSERT( glBufferData( GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ ) );
+            readback.m_size = size;
+        }
+        GL_ASSERT( glPixelStorei( GL_PACK_ALIGNMENT, 1 ) );
+        texture->bind();
+        GL_ASSERT( glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA,
+                                  readback.m_hdr ? GL_FLOAT : GL_UNSIGNED_BYTE, nullptr ) );
+        GL_ASSERT( glPixelStorei( GL_PACK_ALIGNMENT, 4 ) );
+        GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 ) );
+
+        readback.m_fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, GL_NONE_BIT );
+        ++m_numReadbacks;
+    }
+
+    m_timerData.pendingReadbacks = m_numReadbacks;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_timerData.pendingFrames = m_frames.size() + m_numEncoding;
+    }
+    m_timerData.captureEnd = Core::Utils::Clock::now();
+}
+
+void FrameRecorder::flush() {
+    while ( m_numReadbacks > 0 )
+    {
+        retireReadback( true );
+    }
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_frameDone.wait( lock, [this]() { return m_frames.empty() && m_numEncoding == 0; } );
+}
+
+void FrameRecorder::releaseGL() {
+    flush();
+    for ( auto& readback : m_readbacks )
+    {
+        if ( readback.m_buffer != 0 )
+        {
+            glDeleteBuffers( 1, &readback.m_buffer );
+            readback.m_buffer = 0;
+            readback.m_size = 0;
+        }
+    }
+}
+
+bool FrameRecorder::retireReadback( bool wait ) {
+    Readback& readback = m_readbacks[m_firstReadback];
+    GLenum status =
+        glClientWaitSync( readback.m_fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                          wait ? std::numeric_limits<GLuint64>::max() : GLuint64( 0 ) );
+    if ( status == GL_TIMEOUT_EXPIRED )
+    {
+        return false;
+    }
+    if ( status == GL_WAIT_FAILED )
+    {
+        LOG( Core::Utils::logERROR ) << "Unable to wait for the frame readback.";
+    }
+    glDeleteSync( readback.m_fence );
+    readback.m_fence = nullptr;
+
+    Frame frame;
+    frame.m_hdr = readback.m_hdr;
+    frame.m_width = readback.m_width;
+    frame.m_height = readback.m_height;
+    frame.m_filename = readback.m_filename;
+    frame.m_pixels.resize( size_t( frame.m_width ) * frame.m_height * 4 *
+                           ( frame.m_hdr ? sizeof( float ) : sizeof( uchar ) ) );
+
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, readback.m_buffer ) );
+    const void* pixels =
+        glMapBufferRange( GL_PIXEL_PACK_BUFFER, 0, frame.m_pixels.size(), GL_MAP_READ_BIT );
+    CORE_ASSERT( pixels, "Unable to map the frame readback buffer" );
+    std::memcpy( frame.m_pixels.data(), pixels, frame.m_pixels.size() );
+    GL_ASSERT( glUnmapBuffer( GL_PIXEL_PACK_BUFFER ) );
+    GL_ASSERT( glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 ) );
+
+    m_firstReadback = ( m_firstReadback + 1 ) % m_readbacks.size();
+    --m_numReadbacks;
+
+    pushFrame( std::move( frame ) );
+    return true;
+}
+
+bool FrameRecorder::pushFrame( Frame&& frame ) {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    if ( m_frames.size() >= m_maxPendingFrames )
+    {
+        if ( m_dropFrames )
+        {
+            ++m_timerData.droppedFrames;
+            return false;
+        }
+        const auto start = Core::Utils::Clock::now();
+        m_frameDone.wait( lock, [this]() { return m_frames.size() < m_maxPendingFrames; } );
+        m_timerData.stallTime += Core::Utils::getIntervalMicro( start, Core::Utils::Clock::now() );
+    }
+    frame.m_index = m_nextFrameIndex++;
+    m_frames.push_back( std::move( frame ) );
+    lock.unlock();
+    m_frameAvailable.notify_one();
+    return true;
+}
+
+void FrameRecorder::encodeFrame( const Frame& frame ) {
+    const uint w = frame.m_width;
+    const uint h = frame.m_height;
+
+    if ( frame.m_hdr )
+    {
+        // Only flip the image upside down, keeping the floating point values.
+        const size_t rowSize = size_t( w ) * 4 * sizeof( float );
+        std::vector<float> flipped( size_t( w ) * h * 4 );
+        for ( uint j = 0; j < h; ++j )
+        {
+            std::memcpy( flipped.data() + size_t( h - 1 - j ) * w * 4,
+                         frame.m_pixels.data() + j * rowSize, rowSize );
+        }
+        stbi_write_hdr( frame.m_filename.c_str(), w, h, 4, flipped.data() );
+        return;
+    }
+
+    // Flip the image upside down, and make it opaque.
+    const size_t rowSize = size_t( w ) * 4;
+    std::vector<uchar> flipped( rowSize * h );
+    for ( uint j = 0; j < h; ++j )
+    {
+        uchar* out = flipped.data() + ( h - 1 - j ) * rowSize;
+        std::memcpy( out, frame.m_pixels.data() + j * rowSize, rowSize );
+        for ( uint i = 0; i < w; ++i )
+        {
+            out[4 * i + 3] = 0xff;
+        }
+    }
+
+    if ( m_pipe != nullptr )
+    {
+        // Frames are encoded in parallel but must be streamed in order.
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_frameDone.wait( lock, [this, &frame]() { return m_nextPipedFrame == frame.m_index; } );
+        lock.unlock();
+        if ( std::fwrite( flipped.data(), 1, flipped.size(), m_pipe ) != flipped.size() )
+        {
+            LOG( Core::Utils::logERROR ) << "Unable to send frame " << frame.m_index
+                                         << " to the frame encoder.";
+        }
+        lock.lock();
+        ++m_nextPipedFrame;
+        lock.unlock();
+        m_frameDone.notify_all();
+        return;
+    }
+
+    const std::string ext = Core::Utils::getFileExt( frame.m_filename );
+    if ( ext == "png" )
+    {
+        stbi_write_png( frame.m_filename.c_str(), w, h, 4, flipped.data(), rowSize );
+    } else if ( ext == "bmp" )
+    {
+        stbi_write_bmp( frame.m_filename.c_str(), w, h, 4, flipped.data() );
+    } else if ( ext == "tga" )
+    {
+        stbi_write_tga( frame.m_filename.c_str(), w, h, 4, flipped.data() );
+    } else if ( ext == "jpg" )
+    {
+        stbi_write_jpg( frame.m_filename.c_str(), w, h, 4, flipped.data(), 95 );
+    } else if ( ext == "raw" )
+    {
+        std::ofstream file( frame.m_filename, std::ios::binary );
+        file.write( reinterpret_cast<const char*>( flipped.data() ), flipped.size() );
+    } else
+    {
+        LOG( Core::Utils::logWARNING ) << "Cannot write frame to " << frame.m_filename
+                                       << " : unsupported extension";
+    }
+}
+
+void FrameRecorder::runWorker() {
+    while ( true )
+    {
+        Frame frame;
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_frameAvailable.wait( lock, [this]() { return m_shuttingDown || !m_frames.empty(); } );
+            if ( m_frames.empty() )
+            {
+                return;
+            }
+            frame = std::move( m_frames.front() );
+            m_frames.pop_front();
+            ++m_numEncoding;
+        }
+        // A slot is now free in the queue.
+        m_frameDone.notify_all();
+
+        encodeFrame( frame );
+
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            --m_numEncoding;
+        }
+        m_frameDone.notify_all();
+    }
+}
+
+} // namespace Gui
+} // namespace Ra
@@ -0,0 +1,129 @@
+#ifndef RADIUMENGINE_FRAMERECORDER_HPP
+#define RADIUMENGINE_FRAMERECORDER_HPP
+
+#include <GuiBase/RaGuiBase.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Core/Utils/Timer.hpp>
+
+namespace Ra {
+namespace Engine {
+class Texture;
+} // namespace Engine
+} // namespace Ra
+
+namespace Ra {
+namespace Gui {
+
+/**
+ * Records rendered frames without stalling the rendering.
+ * Each captured texture is read back asynchronously into one of a ring of pixel buffers. Once
+ * the transfer is done, the frame is handed to a pool of worker threads which convert and
+ * encode it.
+ * Frames are written either as image files, whose format is given by the file extension
+ * ( png, bmp, tga, jpg, hdr for floating point images, or raw for raw RGBA8 pixels ), or
+ * streamed in order as raw RGBA8 pixels to the standard input of an encoder process.
+ * When the encoders cannot keep up, capture() either waits for them or drops the frame.
+ * @note Except the constructor and the destructor, all the methods must be called with the OpenGL context
+ * bound.
+ */
+class RA_GUIBASE_API FrameRecorder {
+  public:
+    /// Timings and backpressure accounting of the last call to capture().
+    struct TimerData {
+        Core::Utils::TimePoint captureStart;
+        Core::Utils::TimePoint captureEnd;
+        Core::Utils::MicroSeconds stallTime{0}; ///< Time spent waiting for a free slot.
+        uint pendingReadbacks{0};               ///< Frames being transferred from the GPU.
+        uint pendingFrames{0};                  ///< Frames waiting to be encoded.
+        uint droppedFrames{0};                  ///< Frames dropped since the beginning.
+    };
+
+    /**
+     * @param numReadbacks the number of frames which can be transferred at the same time.
+     * @param numWorkers the number of encoding threads.
+     * @param maxPendingFrames the number of read back frames which can wait for an encoder.
+     */
+    FrameRecorder( uint numReadbacks = 3, uint numWorkers = 2, uint maxPendingFrames = 8 );
+
+    /// Waits for the encoding of the frames already read back, see releaseGL().
+    ~FrameRecorder();
+
+    /**
+     * Stream the frames to the standard input of the given command ( e.g. "ffmpeg -f rawvideo
+     * -pix_fmt rgba -s 1280x720 -i - out.mp4" ) instead of writing image files.
+     * An empty command goes back to writing image files.
+     */
+    void setPipeCommand( const std::string& command );
+
+    /// If true, frames are dropped instead of waiting when the recorder is saturated.
+    void setDropFrames( bool drop ) { m_dropFrames = drop; }
+
+    /// Start the capture of the given RGBA floating point texture into filename.
+    void capture( Engine::Texture* texture, const std::string& filename );
+
+    /// Wait until all the captured frames are written.
+    void flush();
+
+    /// Release the OpenGL resources, waiting for the ongoing transfers.
+    void releaseGL();
+
+    const TimerData& getTimerData() const { return m_timerData; }
+
+  private:
+    struct Readback;
+
+    struct Frame {
+        std::vector<uchar> m_pixels; ///< Bottom-up rows, RGBA8 or RGBA32F if m_hdr.
+        bool m_hdr;
+        uint m_width;
+        uint m_height;
+        uint m_index;
+        std::string m_filename;
+    };
+
+    /// Hand the oldest transferred frame to the encoders. If wait is false, only do it if the
+    /// transfer is done.
+    bool retireReadback( bool wait );
+
+    /// Queue a frame for the encoders, applying backpressure. Returns false if dropped.
+    bool pushFrame( Frame&& frame );
+
+    void encodeFrame( const Frame& frame );
+
+    void runWorker();
+
+  private:
+    std::vector<Readback> m_readbacks;
+    uint m_firstReadback;
+    uint m_numReadbacks;
+
+    std::vector<std::thread> m_workers;
+    std::deque<Frame> m_frames;
+    uint m_maxPendingFrames;
+    uint m_numEncoding;
+    uint m_nextFrameIndex;
+    uint m_nextPipedFrame;
+    bool m_shuttingDown;
+    std::mutex m_mutex;
+    std::condition_variable m_frameAvailable;
+    std::condition_variable m_frameDone;
+
+    FILE* m_pipe;
+    bool m_dropFrames;
+
+    TimerData m_timerData;
+};
+
+} // namespace Gui
+} // namespace Ra
+
+#endif // RADIUMENGINE_FRAMERECORDER_HPP
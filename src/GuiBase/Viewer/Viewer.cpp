@@ -15,8 +15,10 @@
 
 #include <QOpenGLContext>
 
+#include <QDir>
 #include <QMouseEvent>
 #include <QPainter>
+#include <QStandardPaths>
 #include <QTimer>
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
@@ -42,6 +44,7 @@
 #include <GuiBase/Utils/Keyboard.hpp>
 #include <GuiBase/Utils/PickingManager.hpp>
 
+#include <GuiBase/Viewer/FrameRecorder.hpp>
 #include <GuiBase/Viewer/Gizmo/GizmoManager.hpp>
 #include <GuiBase/Viewer/TrackballCamera.hpp>
 #include <GuiBase/Viewer/Viewer.hpp>
@@ -68,6 +71,11 @@ Gui::Viewer::~Viewer() {
     if ( m_glInitStatus.load() )
     {
         m_context->makeCurrent( this );
+        if ( m_frameRecorder != nullptr )
+        {
+            m_frameRecorder->releaseGL();
+            m_frameRecorder.reset();
+        }
         m_renderers.clear();
 
         if ( m_gizmoManager != nullptr )
@@ -142,8 +150,18 @@ void Gui::Viewer::initializeGL() {
     m_camera.reset( new Gui::TrackballCamera( width(), height() ) );
 
     LOG( Core::Utils::logINFO ) << "*** Radium Engine Viewer ***";
+    // Linked programs are cached in the user cache directory, to speed up the next start-ups.
+    QString programCache =
+        QStandardPaths::writableLocation( QStandardPaths::CacheLocation ) + "/Shaders";
+    if ( !QDir().mkpath( programCache ) )
+    {
+        LOG( Core::Utils::logWARNING ) << "Cannot create shader cache directory "
+                                       << programCache.toStdString();
+        programCache.clear();
+    }
     Engine::ShaderProgramManager::createInstance( "Shaders/Default.vert.glsl",
-                                                  "Shaders/Default.frag.glsl" );
+                                                  "Shaders/Default.frag.glsl",
+                                                  programCache.toStdString() );
 
     // Lights are components. So they must be attached to an entity. Attache headlight to system Entity
     auto light = new Engine::DirectionalLight( Ra::Engine::SystemEntity::getInstance(), "headlight" );
@@ -499,7 +517,7 @@ bool Gui::Viewer::changeRenderer( int index ) {
 
 // Asynchronous rendering implementation
 
-void Gui::Viewer::startRendering( const Scalar dt ) {
+void Gui::Viewer::startRendering( const Scalar dt, const std::function<void()>& objectsUpdated ) {
     CORE_ASSERT( m_glInitStatus.load(), "OpenGL needs to be initialized before rendering." );
 
     CORE_ASSERT( m_currentRenderer != nullptr, "No renderer found." );
@@ -525,7 +543,7 @@ void Gui::Viewer::startRendering( const Scalar dt ) {
         else
             LOG( Core::Utils::logDEBUG ) << "Unable to attach the head light!";
     }
-    m_currentRenderer->render( data );
+    m_currentRenderer->render( data, objectsUpdated );
 }
 
 void Gui::Viewer::waitForRendering() {
@@ -606,6 +624,30 @@ void Gui::Viewer::grabFrame( const std::string& filename ) {
     delete[] writtenPixels;
 }
 
+void Gui::Viewer::recordFrame( const std::string& filename ) {
+    m_context->makeCurrent( this );
+    getFrameRecorder()->capture( m_currentRenderer->getDisplayTexture(), filename );
+    m_context->doneCurrent();
+}
+
+void Gui::Viewer::stopRecording() {
+    if ( m_frameRecorder != nullptr )
+    {
+        m_context->makeCurrent( this );
+        m_frameRecorder->releaseGL();
+        m_context->doneCurrent();
+        m_frameRecorder.reset();
+    }
+}
+
+Gui::FrameRecorder* Gui::Viewer::getFrameRecorder() {
+    if ( m_frameRecorder == nullptr )
+    {
+        m_frameRecorder.reset( new FrameRecorder() );
+    }
+    return m_frameRecorder.get();
+}
+
 void Gui::Viewer::enablePostProcess( int enabled ) {
     m_currentRenderer->enablePostProcess( enabled );
 }
@@ -4,6 +4,7 @@
 #include <GuiBase/RaGuiBase.hpp>
 
 #include <atomic>
+#include <functional>
 #include <memory>
 
 #include <QWindow>
@@ -31,6 +32,7 @@ struct MouseEvent;
 namespace Ra {
 namespace Gui {
 class CameraInterface;
+class FrameRecorder;
 class GizmoManager;
 class PickingManager;
 } // namespace Gui
@@ -106,7 +108,9 @@ class RA_GUIBASE_API Viewer : public QWindow {
     //
 
     /// Start rendering (potentially asynchronously in a separate thread)
-    void startRendering( const Scalar dt );
+    /// objectsUpdated is called once the render objects have been sent to the GPU, see
+    /// Engine::Renderer::render().
+    void startRendering( const Scalar dt, const std::function<void()>& objectsUpdated = nullptr );
 
     /// Blocks until rendering is finished.
     void waitForRendering();
@@ -127,6 +131,19 @@ class RA_GUIBASE_API Viewer : public QWindow {
     /// Write the current frame as an image. Supports either BMP or PNG file names.
     void grabFrame( const std::string& filename );
 
+    /// Start the capture of the current frame, which is written asynchronously.
+    /// \see FrameRecorder for the supported formats.
+    void recordFrame( const std::string& filename );
+
+    /// Wait for the recorded frames to be written, and release the frame recorder.
+    void stopRecording();
+
+    /// Returns true if frames are being recorded.
+    bool isRecording() const { return m_frameRecorder != nullptr; }
+
+    /// Access to the frame recorder, created on first use.
+    FrameRecorder* getFrameRecorder();
+
     void enableDebug();
 
   signals:
@@ -240,6 +257,9 @@ class RA_GUIBASE_API Viewer : public QWindow {
     /// Owning (QObject child) pointer to gizmo manager.
     GizmoManager* m_gizmoManager;
 
+    /// Owning pointer to the frame recorder, only allocated while recording.
+    std::unique_ptr<FrameRecorder> m_frameRecorder;
+
     // TODO are we really use this ? Remove if we do not plan to do multi thread rendering
     /// Thread in which rendering is done.
     [[deprecated]] QThread* m_renderThread = nullptr; // We have to use a QThread for MT rendering
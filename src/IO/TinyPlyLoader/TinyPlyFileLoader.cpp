@@ -1,6 +1,7 @@
 #include <IO/TinyPlyLoader/TinyPlyFileLoader.hpp>
 
 #include <Core/Asset/FileData.hpp>
+#include <Core/Geometry/PointCloudProcessing.hpp>
 
 #include <tinyply/tinyply.h>
 
@@ -103,6 +104,17 @@ Core::Asset::FileData* TinyPlyFileLoader::loadFile( const std::string& filename
         geometry->setNormals(
             *( reinterpret_cast<std::vector<Eigen::Matrix<float, 3, 1, Eigen::DontAlign>>*>(
                 &normals ) ) );
+    } else
+    {
+        // Scans often lack normals, which are needed to light the points.
+        const auto& vertices = geometry->getVertices();
+        Core::Geometry::PointKdTree tree( vertices );
+        Core::Geometry::estimateNormals( tree, vertices, 16, geometry->getNormals() );
+        Core::Geometry::orientNormals( tree, vertices, 16, geometry->getNormals() );
+        if ( fileData->isVerbose() )
+        {
+            LOG( Core::Utils::logINFO ) << "[TinyPLY] Normals estimated from the points.";
+        }
     }
 
     if ( colorCount != 0 )
@@ -0,0 +1,61 @@
+#ifndef RADIUM_SKINNING_BENCHMARKS_HPP_
+#define RADIUM_SKINNING_BENCHMARKS_HPP_
+
+#include <Core/Animation/DualQuaternionSkinning.hpp>
+#include <Core/Animation/LinearBlendSkinning.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+/// Number of bones of the synthetic skeletons.
+constexpr uint SkinningNumBones = 32;
+
+class LinearBlendSkinningBenchmark : public Benchmark {
+  public:
+    LinearBlendSkinningBenchmark() : Benchmark( "Animation/linearBlendSkinning" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        makeSkinningFixture( m_mesh, SkinningNumBones, m_fixture );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override {
+        Ra::Core::Animation::linearBlendSkinning( m_mesh.m_vertices, m_fixture.m_pose,
+                                                  m_fixture.m_weights, m_output );
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    SkinningFixture m_fixture;
+    Ra::Core::Container::Vector3Array m_output;
+};
+
+class DualQuaternionSkinningBenchmark : public Benchmark {
+  public:
+    DualQuaternionSkinningBenchmark() : Benchmark( "Animation/dualQuaternionSkinning" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        makeSkinningFixture( m_mesh, SkinningNumBones, m_fixture );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override {
+        Ra::Core::Animation::computeDQ( m_fixture.m_pose, m_fixture.m_weights, m_dq );
+        Ra::Core::Animation::dualQuaternionSkinning( m_mesh.m_vertices, m_dq, m_output );
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    SkinningFixture m_fixture;
+    Ra::Core::Animation::DQList m_dq;
+    Ra::Core::Container::Vector3Array m_output;
+};
+
+RA_BENCHMARK_CLASS( LinearBlendSkinningBenchmark );
+RA_BENCHMARK_CLASS( DualQuaternionSkinningBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_SKINNING_BENCHMARKS_HPP_
@@ -0,0 +1,48 @@
+#ifndef RADIUM_BENCHMARKS_HPP_
+#define RADIUM_BENCHMARKS_HPP_
+#include <Core/CoreMacros.hpp>
+#include <Tests/CoreBenchmarks/Manager.hpp>
+
+#include <string>
+
+namespace RaBenchmarks {
+/// Base class for all benchmarks.
+/// A benchmark is run on inputs of growing size, called levels. For each level, setup()
+/// builds the inputs outside of the timed section, then run() is timed several times.
+class Benchmark {
+  public:
+    explicit Benchmark( const std::string& name ) : m_name( name ) {
+        if ( !BenchmarkManager::getInstance() )
+        {
+            BenchmarkManager::createInstance();
+        }
+        BenchmarkManager::getInstance()->add( this );
+    }
+
+    virtual ~Benchmark() {}
+
+    /// Build the inputs of the given level, and return their size ( e.g. the number of
+    /// vertices ). Return 0 if there is no such level.
+    virtual uint setup( uint level ) = 0;
+
+    /// The timed operation. It must give the same result when called several times in a row.
+    virtual void run() = 0;
+
+    /// Release the inputs built by setup().
+    virtual void teardown() {}
+
+    const std::string& getName() const { return m_name; }
+
+  private:
+    std::string m_name;
+};
+
+// Poor man's singleton to automatically instantiate a benchmark.
+#define RA_BENCHMARK_CLASS( TYPE ) \
+    namespace TYPE##NS {           \
+        TYPE benchmark_instance;   \
+    }
+
+} // namespace RaBenchmarks
+
+#endif // RADIUM_BENCHMARKS_HPP_
@@ -0,0 +1,51 @@
+#ifndef RADIUM_INDEXMAP_BENCHMARKS_HPP_
+#define RADIUM_INDEXMAP_BENCHMARKS_HPP_
+
+#include <Core/Container/IndexMap.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+
+namespace RaBenchmarks {
+
+/// Insertions, removal of one object out of two, accesses, and reinsertions in the freed slots.
+class IndexMapBenchmark : public Benchmark {
+  public:
+    IndexMapBenchmark() : Benchmark( "Container/IndexMap" ), m_size( 0 ) {}
+
+    uint setup( uint level ) override {
+        m_size = 1024u << level;
+        m_indices.resize( m_size );
+        return m_size;
+    }
+
+    void run() override {
+        Ra::Core::Container::IndexMap<int> map;
+        for ( uint i = 0; i < m_size; ++i )
+        {
+            m_indices[i] = map.insert( int( i ) );
+        }
+        for ( uint i = 0; i < m_size; i += 2 )
+        {
+            map.remove( m_indices[i] );
+        }
+        long sum = 0;
+        for ( uint i = 1; i < m_size; i += 2 )
+        {
+            sum += map.at( m_indices[i] );
+        }
+        for ( uint i = 0; i < m_size; i += 2 )
+        {
+            m_indices[i] = map.insert( int( sum + i ) );
+        }
+    }
+
+    void teardown() override { m_indices.clear(); }
+
+  private:
+    uint m_size;
+    std::vector<Ra::Core::Container::Index> m_indices;
+};
+
+RA_BENCHMARK_CLASS( IndexMapBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_INDEXMAP_BENCHMARKS_HPP_
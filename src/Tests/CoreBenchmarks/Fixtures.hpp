@@ -0,0 +1,111 @@
+#ifndef RADIUM_BENCHMARKS_FIXTURES_HPP_
+#define RADIUM_BENCHMARKS_FIXTURES_HPP_
+
+#include <Core/Animation/HandleWeight.hpp>
+#include <Core/Animation/Pose.hpp>
+#include <Core/Animation/PoseOperation.hpp>
+#include <Core/Animation/Skeleton.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/// Procedural inputs of the benchmarks, of growing size with the level.
+namespace RaBenchmarks {
+using Ra::Core::Geometry::TriangleMesh;
+
+/// Geodesic sphere, with 4 times more vertices at each level.
+inline TriangleMesh makeSphere( uint level ) {
+    return Ra::Core::Geometry::makeGeodesicSphere( 1.f, level + 2 );
+}
+
+/// Square grid, with 32 x 32 cells at level 0 and 4 times more cells at each level.
+inline TriangleMesh makeGrid( uint level ) {
+    const uint n = 32u << level;
+    return Ra::Core::Geometry::makePlaneGrid( n, n );
+}
+
+/// Unwelded copy of mesh, where each triangle has its own three vertices.
+inline TriangleMesh makeTriangleSoup( const TriangleMesh& mesh ) {
+    TriangleMesh soup;
+    soup.m_vertices.reserve( 3 * mesh.m_triangles.size() );
+    soup.m_normals.reserve( 3 * mesh.m_triangles.size() );
+    soup.m_triangles.reserve( mesh.m_triangles.size() );
+    for ( const auto& t : mesh.m_triangles )
+    {
+        const uint first = soup.m_vertices.size();
+        for ( uint i = 0; i < 3; ++i )
+        {
+            soup.m_vertices.push_back( mesh.m_vertices[t[i]] );
+            soup.m_normals.push_back( mesh.m_normals[t[i]] );
+        }
+        soup.m_triangles.push_back( Ra::Core::Geometry::Triangle( first, first + 1, first + 2 ) );
+    }
+    return soup;
+}
+
+/// A bent chain of bones along the z axis of a mesh, with smooth skinning weights.
+struct SkinningFixture {
+    Ra::Core::Animation::Skeleton m_skeleton;
+    Ra::Core::Animation::RestPose m_restPose;
+    /// Bent pose, relative to the rest pose, i.e. ready to be applied to the rest vertices.
+    Ra::Core::Animation::Pose m_pose;
+    Ra::Core::Animation::WeightMatrix m_weights;
+};
+
+/// Build a chain of numBones bones spanning the mesh along z. Each vertex is influenced by the
+/// two closest bones, and the pose bends each joint by the same angle.
+inline void makeSkinningFixture( const TriangleMesh& mesh, uint numBones, SkinningFixture& fixture ) {
+    using SpaceType = Ra::Core::Animation::Handle::SpaceType;
+    using Ra::Core::Math::Transform;
+    using Ra::Core::Math::Vector3;
+
+    const auto aabb = Ra::Core::Geometry::getAabb( mesh );
+    const Scalar zMin = aabb.min().z();
+    const Scalar boneLength = std::max( aabb.sizes().z(), Scalar( 1e-6 ) ) / numBones;
+
+    // Rest pose : a straight chain.
+    fixture.m_skeleton.clear();
+    for ( uint i = 0; i < numBones; ++i )
+    {
+        Transform T = Transform::Identity();
+        T.translation() = i == 0 ? Vector3( 0, 0, zMin ) : Vector3( 0, 0, boneLength );
+        fixture.m_skeleton.addBone( int( i ) - 1, T, SpaceType::LOCAL );
+    }
+    fixture.m_restPose = fixture.m_skeleton.getPose( SpaceType::MODEL );
+
+    // Bent pose.
+    Ra::Core::Animation::Pose localPose = fixture.m_skeleton.getPose( SpaceType::LOCAL );
+    const Scalar angle = Scalar( 0.5 ) / numBones;
+    for ( uint i = 1; i < numBones; ++i )
+    {
+        localPose[i].rotate( Eigen::AngleAxis<Scalar>( angle, Vector3::UnitX() ) );
+    }
+    fixture.m_skeleton.setPose( localPose, SpaceType::LOCAL );
+    fixture.m_pose = Ra::Core::Animation::relativePose(
+        fixture.m_skeleton.getPose( SpaceType::MODEL ), fixture.m_restPose );
+
+    // Weights : linear interpolation between the centers of the two closest bones.
+    std::vector<Eigen::Triplet<Scalar>> triplets;
+    triplets.reserve( 2 * mesh.m_vertices.size() );
+    for ( uint v = 0; v < mesh.m_vertices.size(); ++v )
+    {
+        const Scalar t = ( mesh.m_vertices[v].z() - zMin ) / boneLength - Scalar( 0.5 );
+        const int b0 = std::min( std::max( int( std::floor( t ) ), 0 ), int( numBones ) - 1 );
+        const int b1 = std::min( b0 + 1, int( numBones ) - 1 );
+        const Scalar w1 = b0 == b1 ? 0 : std::min( std::max( t - b0, Scalar( 0 ) ), Scalar( 1 ) );
+        triplets.emplace_back( v, b0, 1 - w1 );
+        if ( w1 > 0 )
+        {
+            triplets.emplace_back( v, b1, w1 );
+        }
+    }
+    fixture.m_weights.resize( mesh.m_vertices.size(), numBones );
+    fixture.m_weights.setFromTriplets( triplets.begin(), triplets.end() );
+}
+
+} // namespace RaBenchmarks
+
+#endif // RADIUM_BENCHMARKS_FIXTURES_HPP_
@@ -0,0 +1,51 @@
+#ifndef RADIUM_DUPLICATES_BENCHMARKS_HPP_
+#define RADIUM_DUPLICATES_BENCHMARKS_HPP_
+
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+class FindDuplicatesBenchmark : public Benchmark {
+  public:
+    FindDuplicatesBenchmark() : Benchmark( "Geometry/findDuplicates" ) {}
+
+    uint setup( uint level ) override {
+        m_soup = makeTriangleSoup( makeSphere( level ) );
+        return m_soup.m_vertices.size();
+    }
+
+    void run() override { Ra::Core::Geometry::findDuplicates( m_soup, m_duplicates ); }
+
+  private:
+    TriangleMesh m_soup;
+    std::vector<Ra::Core::Geometry::VertexIdx> m_duplicates;
+};
+
+class RemoveDuplicatesBenchmark : public Benchmark {
+  public:
+    RemoveDuplicatesBenchmark() : Benchmark( "Geometry/removeDuplicates" ) {}
+
+    uint setup( uint level ) override {
+        m_soup = makeTriangleSoup( makeSphere( level ) );
+        return m_soup.m_vertices.size();
+    }
+
+    /// Includes the copy of the triangle soup, which is welded in place.
+    void run() override {
+        m_mesh = m_soup;
+        Ra::Core::Geometry::removeDuplicates( m_mesh, m_vertexMap );
+    }
+
+  private:
+    TriangleMesh m_soup;
+    TriangleMesh m_mesh;
+    std::vector<Ra::Core::Geometry::VertexIdx> m_vertexMap;
+};
+
+RA_BENCHMARK_CLASS( FindDuplicatesBenchmark );
+RA_BENCHMARK_CLASS( RemoveDuplicatesBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_DUPLICATES_BENCHMARKS_HPP_
@@ -0,0 +1,94 @@
+#ifndef RADIUM_LAPLACIAN_BENCHMARKS_HPP_
+#define RADIUM_LAPLACIAN_BENCHMARKS_HPP_
+
+#include <Core/Geometry/Adjacency.hpp>
+#include <Core/Geometry/Laplacian.hpp>
+#include <Core/Geometry/OperatorAssembly.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+/// The Laplacians are assembled in linear time ( see MeshOperatorAssembler ), all the levels run.
+constexpr uint LaplacianNumLevels = 5;
+
+class CotangentLaplacianBenchmark : public Benchmark {
+  public:
+    CotangentLaplacianBenchmark() : Benchmark( "Geometry/cotangentWeightLaplacian" ) {}
+
+    uint setup( uint level ) override {
+        if ( level >= LaplacianNumLevels )
+        {
+            return 0;
+        }
+        m_mesh = makeGrid( level );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override {
+        m_laplacian =
+            Ra::Core::Geometry::cotangentWeightLaplacian( m_mesh.m_vertices, m_mesh.m_triangles );
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Geometry::LaplacianMatrix m_laplacian;
+};
+
+class UniformLaplacianBenchmark : public Benchmark {
+  public:
+    UniformLaplacianBenchmark() : Benchmark( "Geometry/standardLaplacian" ) {}
+
+    uint setup( uint level ) override {
+        if ( level >= LaplacianNumLevels )
+        {
+            return 0;
+        }
+        m_mesh = makeGrid( level );
+        return m_mesh.m_vertices.size();
+    }
+
+    /// Includes the assembly of the adjacency and degree matrices.
+    void run() override {
+        const Ra::Core::Geometry::AdjacencyMatrix A =
+            Ra::Core::Geometry::uniformAdjacency( m_mesh.m_vertices, m_mesh.m_triangles );
+        const Ra::Core::Geometry::DegreeMatrix D = Ra::Core::Geometry::adjacencyDegree( A );
+        m_laplacian = Ra::Core::Geometry::standardLaplacian( D, A );
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Geometry::LaplacianMatrix m_laplacian;
+};
+
+/// Refill of the Laplacian of a mesh whose vertices moved, the pattern being cached.
+class CotangentLaplacianRefillBenchmark : public Benchmark {
+  public:
+    CotangentLaplacianRefillBenchmark() :
+        Benchmark( "Geometry/MeshOperatorAssembler::cotangentWeightLaplacian" ) {}
+
+    uint setup( uint level ) override {
+        if ( level >= LaplacianNumLevels )
+        {
+            return 0;
+        }
+        m_mesh = makeGrid( level );
+        m_assembler.setTopology( m_mesh.m_vertices.size(), m_mesh.m_triangles );
+        m_assembler.cotangentWeightLaplacian( m_mesh.m_vertices, m_laplacian );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override { m_assembler.cotangentWeightLaplacian( m_mesh.m_vertices, m_laplacian ); }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Geometry::MeshOperatorAssembler m_assembler;
+    Ra::Core::Geometry::LaplacianMatrix m_laplacian;
+};
+
+RA_BENCHMARK_CLASS( CotangentLaplacianBenchmark );
+RA_BENCHMARK_CLASS( CotangentLaplacianRefillBenchmark );
+RA_BENCHMARK_CLASS( UniformLaplacianBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_LAPLACIAN_BENCHMARKS_HPP_
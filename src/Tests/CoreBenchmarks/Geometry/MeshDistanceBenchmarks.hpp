@@ -0,0 +1,38 @@
+#ifndef RADIUM_MESHDISTANCE_BENCHMARKS_HPP_
+#define RADIUM_MESHDISTANCE_BENCHMARKS_HPP_
+
+#include <Core/Geometry/MeshDistance.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+/// Closest points on a sphere of the vertices of a larger sphere.
+class MeshDistanceBenchmark : public Benchmark {
+  public:
+    MeshDistanceBenchmark() : Benchmark( "Geometry/MeshDistance::getClosestPoints" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        m_distance.build( m_mesh );
+        m_queries = m_mesh.m_vertices;
+        for ( auto& q : m_queries )
+        {
+            q *= Scalar( 1.1 );
+        }
+        return m_mesh.m_triangles.size();
+    }
+
+    void run() override { m_distance.getClosestPoints( m_queries, m_closest ); }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Geometry::MeshDistance m_distance;
+    Ra::Core::Container::Vector3Array m_queries;
+    std::vector<Ra::Core::Geometry::MeshDistance::ClosestPoint> m_closest;
+};
+
+RA_BENCHMARK_CLASS( MeshDistanceBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_MESHDISTANCE_BENCHMARKS_HPP_
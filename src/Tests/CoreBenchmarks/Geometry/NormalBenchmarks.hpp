@@ -0,0 +1,115 @@
+#ifndef RADIUM_NORMAL_BENCHMARKS_HPP_
+#define RADIUM_NORMAL_BENCHMARKS_HPP_
+
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Core/Geometry/Normal.hpp>
+#include <Core/Geometry/PointCloudProcessing.hpp>
+#include <Core/Geometry/VertexNormals.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+class UniformNormalBenchmark : public Benchmark {
+  public:
+    UniformNormalBenchmark() : Benchmark( "Geometry/uniformNormal" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override {
+        Ra::Core::Geometry::uniformNormal( m_mesh.m_vertices, m_mesh.m_triangles, m_normals );
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Container::Vector3Array m_normals;
+};
+
+class AngleWeightedNormalBenchmark : public Benchmark {
+  public:
+    AngleWeightedNormalBenchmark() : Benchmark( "Geometry/angleWeightedNormal" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override {
+        Ra::Core::Geometry::angleWeightedNormal( m_mesh.m_vertices, m_mesh.m_triangles,
+                                                 m_normals );
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Container::Vector3Array m_normals;
+};
+
+class AutoNormalsBenchmark : public Benchmark {
+  public:
+    AutoNormalsBenchmark() : Benchmark( "Geometry/getAutoNormals" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override { Ra::Core::Geometry::getAutoNormals( m_mesh, m_normals ); }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Container::Vector3Array m_normals;
+};
+
+/// Normals of a mesh whose vertices moved, the triangles around each vertex being cached.
+class VertexNormalsBenchmark : public Benchmark {
+  public:
+    VertexNormalsBenchmark() : Benchmark( "Geometry/VertexNormals::compute" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        m_vertexNormals.setTopology( m_mesh.m_vertices.size(), m_mesh.m_triangles );
+        m_vertexNormals.setWeighting( Ra::Core::Geometry::VertexNormals::WEIGHT_ANGLE );
+        return m_mesh.m_vertices.size();
+    }
+
+    void run() override { m_vertexNormals.compute( m_mesh.m_vertices, m_normals ); }
+
+  private:
+    TriangleMesh m_mesh;
+    Ra::Core::Geometry::VertexNormals m_vertexNormals;
+    Ra::Core::Container::Vector3Array m_normals;
+};
+
+/// Oriented normals of the vertices of a sphere, as a point cloud without triangles.
+class PointCloudNormalsBenchmark : public Benchmark {
+  public:
+    PointCloudNormalsBenchmark() : Benchmark( "Geometry/estimateNormals+orientNormals" ) {}
+
+    uint setup( uint level ) override {
+        m_points = makeSphere( level ).m_vertices;
+        m_tree.build( m_points );
+        return m_points.size();
+    }
+
+    void run() override {
+        Ra::Core::Geometry::estimateNormals( m_tree, m_points, 16, m_normals );
+        Ra::Core::Geometry::orientNormals( m_tree, m_points, 16, m_normals );
+    }
+
+  private:
+    Ra::Core::Container::Vector3Array m_points;
+    Ra::Core::Geometry::PointKdTree m_tree;
+    Ra::Core::Container::Vector3Array m_normals;
+};
+
+RA_BENCHMARK_CLASS( UniformNormalBenchmark );
+RA_BENCHMARK_CLASS( AngleWeightedNormalBenchmark );
+RA_BENCHMARK_CLASS( AutoNormalsBenchmark );
+RA_BENCHMARK_CLASS( VertexNormalsBenchmark );
+RA_BENCHMARK_CLASS( PointCloudNormalsBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_NORMAL_BENCHMARKS_HPP_
@@ -0,0 +1,74 @@
+#ifndef RADIUM_POINTKDTREE_BENCHMARKS_HPP_
+#define RADIUM_POINTKDTREE_BENCHMARKS_HPP_
+
+#include <Core/Geometry/PointHashGrid.hpp>
+#include <Core/Geometry/PointKdTree.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+class PointKdTreeBuildBenchmark : public Benchmark {
+  public:
+    PointKdTreeBuildBenchmark() : Benchmark( "Geometry/PointKdTree::build" ) {}
+
+    uint setup( uint level ) override {
+        m_points = makeSphere( level ).m_vertices;
+        return m_points.size();
+    }
+
+    void run() override { m_tree.build( m_points ); }
+
+  private:
+    Ra::Core::Container::Vector3Array m_points;
+    Ra::Core::Geometry::PointKdTree m_tree;
+};
+
+/// The 8 nearest neighbors of each vertex of a sphere.
+class PointKdTreeKNearestBenchmark : public Benchmark {
+  public:
+    PointKdTreeKNearestBenchmark() : Benchmark( "Geometry/PointKdTree::getKNearest" ) {}
+
+    uint setup( uint level ) override {
+        m_points = makeSphere( level ).m_vertices;
+        m_tree.build( m_points );
+        return m_points.size();
+    }
+
+    void run() override { m_tree.getKNearest( m_points, 8, m_indices ); }
+
+  private:
+    Ra::Core::Container::Vector3Array m_points;
+    Ra::Core::Geometry::PointKdTree m_tree;
+    std::vector<uint> m_indices;
+};
+
+/// The neighbors of each vertex of a sphere within a few edge lengths, with a hash grid.
+class PointHashGridInRadiusBenchmark : public Benchmark {
+  public:
+    PointHashGridInRadiusBenchmark() : Benchmark( "Geometry/PointHashGrid::getInRadius" ) {}
+
+    uint setup( uint level ) override {
+        m_points = makeSphere( level ).m_vertices;
+        // The edge length of the sphere halves at each level.
+        m_radius = Scalar( 0.4 ) / ( 1 << level );
+        m_grid.build( m_points, m_radius );
+        return m_points.size();
+    }
+
+    void run() override { m_grid.getInRadius( m_points, m_radius, m_offsets, m_indices ); }
+
+  private:
+    Ra::Core::Container::Vector3Array m_points;
+    Ra::Core::Geometry::PointHashGrid m_grid;
+    Scalar m_radius;
+    std::vector<uint> m_offsets;
+    std::vector<uint> m_indices;
+};
+
+RA_BENCHMARK_CLASS( PointKdTreeBuildBenchmark );
+RA_BENCHMARK_CLASS( PointKdTreeKNearestBenchmark );
+RA_BENCHMARK_CLASS( PointHashGridInRadiusBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_POINTKDTREE_BENCHMARKS_HPP_
@@ -0,0 +1,214 @@
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Manager.hpp>
+
+#include <Core/Utils/Timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#ifdef CORE_USE_OMP
+#    include <omp.h>
+#endif
+
+namespace RaBenchmarks {
+
+RA_SINGLETON_IMPLEMENTATION( BenchmarkManager );
+
+namespace {
+/// Set the number of threads used by the OpenMP loops. Returns false if not supported.
+bool setNumThreads( uint numThreads ) {
+#ifdef CORE_USE_OMP
+    omp_set_num_threads( int( numThreads ) );
+    return true;
+#else
+    return numThreads == 1;
+#endif
+}
+
+/// Return the value of the given key in a flat JSON object, as a string without quotes.
+std::string getJsonValue( const std::string& object, const std::string& key ) {
+    const std::string pattern = "\"" + key + "\":";
+    size_t begin = object.find( pattern );
+    if ( begin == std::string::npos )
+    {
+        return "";
+    }
+    begin += pattern.size();
+    while ( begin < object.size() && ( object[begin] == ' ' || object[begin] == '"' ) )
+    {
+        ++begin;
+    }
+    size_t end = object.find_first_of( "\",}", begin );
+    return object.substr( begin, end == std::string::npos ? std::string::npos : end - begin );
+}
+} // namespace
+
+void BenchmarkManager::add( Benchmark* benchmark ) {
+    m_benchmarks.push_back( benchmark );
+}
+
+int BenchmarkManager::run() {
+    m_results.clear();
+    for ( auto b : m_benchmarks )
+    {
+        if ( m_options.m_filter.empty() || b->getName().find( m_options.m_filter ) != std::string::npos )
+        {
+            runBenchmark( b );
+        }
+    }
+
+    if ( !m_options.m_outputFile.empty() )
+    {
+        std::ofstream out( m_options.m_outputFile );
+        if ( !out.is_open() )
+        {
+            printf( "Cannot write results to %s\n", m_options.m_outputFile.c_str() );
+        } else
+        { writeJson( m_results, out ); }
+    }
+
+    if ( m_options.m_baselineFile.empty() )
+    {
+        return 0;
+    }
+
+    std::vector<Result> baseline;
+    if ( !readJson( m_options.m_baselineFile, baseline ) )
+    {
+        printf( "Cannot read baseline %s\n", m_options.m_baselineFile.c_str() );
+        return 1;
+    }
+    return compare( m_results, baseline, m_options.m_tolerance );
+}
+
+void BenchmarkManager::runBenchmark( Benchmark* benchmark ) {
+    std::vector<double> times( std::max( m_options.m_repeats, 1u ) );
+    for ( uint level = 0; level < m_options.m_maxLevel; ++level )
+    {
+        const uint size = benchmark->setup( level );
+        if ( size == 0 )
+        {
+            break;
+        }
+
+        for ( uint numThreads : m_options.m_threads )
+        {
+            if ( !setNumThreads( numThreads ) )
+            {
+                printf( "%s : skipping %u threads, built without OpenMP\n",
+                        benchmark->getName().c_str(), numThreads );
+                continue;
+            }
+
+            // Warm up the caches and the allocators.
+            benchmark->run();
+            for ( auto& t : times )
+            {
+                const auto start = Ra::Core::Utils::Clock::now();
+                benchmark->run();
+                const auto end = Ra::Core::Utils::Clock::now();
+                t = std::chrono::duration<double, std::micro>( end - start ).count();
+            }
+
+            std::sort( times.begin(), times.end() );
+            Result result;
+            result.m_name = benchmark->getName();
+            result.m_size = size;
+            result.m_threads = numThreads;
+            result.m_median = times[times.size() / 2];
+            result.m_min = times.front();
+            result.m_mean = std::accumulate( times.begin(), times.end(), 0. ) / times.size();
+            m_results.push_back( result );
+
+            printf( "%-32s size %8u threads %2u : median %12.1f us, min %12.1f us\n",
+                    result.m_name.c_str(), size, numThreads, result.m_median, result.m_min );
+        }
+        benchmark->teardown();
+    }
+    setNumThreads( m_options.m_threads.empty() ? 1 : m_options.m_threads.back() );
+}
+
+void BenchmarkManager::writeJson( const std::vector<Result>& results, std::ostream& out ) {
+    out << "{\n  \"results\": [\n";
+    for ( uint i = 0; i < results.size(); ++i )
+    {
+        const Result& r = results[i];
+        // One object per line, see readJson().
+        out << "    {\"benchmark\": \"" << r.m_name << "\", \"size\": " << r.m_size
+            << ", \"threads\": " << r.m_threads << ", \"median_us\": " << r.m_median
+            << ", \"min_us\": " << r.m_min << ", \"mean_us\": " << r.m_mean << "}"
+            << ( i + 1 < results.size() ? ",\n" : "\n" );
+    }
+    out << "  ]\n}\n";
+}
+
+bool BenchmarkManager::readJson( const std::string& filename, std::vector<Result>& results ) {
+    std::ifstream in( filename );
+    if ( !in.is_open() )
+    {
+        return false;
+    }
+    std::stringstream content;
+    content << in.rdbuf();
+    const std::string json = content.str();
+
+    // Results are flat objects, which are the only ones with a "benchmark" key.
+    size_t begin = json.find( "{\"benchmark\"" );
+    while ( begin != std::string::npos )
+    {
+        const size_t end = json.find( '}', begin );
+        if ( end == std::string::npos )
+        {
+            return false;
+        }
+        const std::string object = json.substr( begin, end - begin + 1 );
+        Result r;
+        r.m_name = getJsonValue( object, "benchmark" );
+        r.m_size = uint( std::strtoul( getJsonValue( object, "size" ).c_str(), nullptr, 10 ) );
+        r.m_threads =
+            uint( std::strtoul( getJsonValue( object, "threads" ).c_str(), nullptr, 10 ) );
+        r.m_median = std::strtod( getJsonValue( object, "median_us" ).c_str(), nullptr );
+        r.m_min = std::strtod( getJsonValue( object, "min_us" ).c_str(), nullptr );
+        r.m_mean = std::strtod( getJsonValue( object, "mean_us" ).c_str(), nullptr );
+        results.push_back( r );
+        begin = json.find( "{\"benchmark\"", end );
+    }
+    return true;
+}
+
+int BenchmarkManager::compare( const std::vector<Result>& results,
+                               const std::vector<Result>& baseline, double tolerance ) {
+    int numRegressions = 0;
+    printf( "Comparison to baseline ( tolerance %.0f%% ) : \n", tolerance * 100. );
+    for ( const auto& r : results )
+    {
+        auto b = std::find_if( baseline.begin(), baseline.end(), [&r]( const Result& other ) {
+            return other.m_name == r.m_name && other.m_size == r.m_size &&
+                   other.m_threads == r.m_threads;
+        } );
+        if ( b == baseline.end() || b->m_median <= 0. )
+        {
+            printf( "\t%-32s size %8u threads %2u : NEW\n", r.m_name.c_str(), r.m_size,
+                    r.m_threads );
+            continue;
+        }
+
+        const double ratio = r.m_median / b->m_median;
+        const bool regression = ratio > 1. + tolerance;
+        printf( "\t%-32s size %8u threads %2u : %12.1f -> %12.1f us ( x%.2f ) %s\n",
+                r.m_name.c_str(), r.m_size, r.m_threads, b->m_median, r.m_median, ratio,
+                regression ? "REGRESSION" : "OK" );
+        if ( regression )
+        {
+            ++numRegressions;
+        }
+    }
+    printf( "Result : %i regressions\n", numRegressions );
+    return numRegressions;
+}
+} // namespace RaBenchmarks
@@ -0,0 +1,80 @@
+#ifndef RADIUM_BENCHMARKS_MANAGER_HPP_
+#define RADIUM_BENCHMARKS_MANAGER_HPP_
+#include <Core/Utils/Singleton.hpp>
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace RaBenchmarks {
+
+class Benchmark;
+
+/// Singleton class responsible for running the benchmarks and comparing them to a baseline.
+class BenchmarkManager {
+
+    RA_SINGLETON_INTERFACE( BenchmarkManager );
+
+  public:
+    /// Options of the benchmark runs.
+    struct Options {
+        Options() : m_repeats( 10 ), m_maxLevel( 5 ), m_threads{1}, m_tolerance( 0.1 ) {}
+        /// Number of timed runs of each benchmark, level and thread count.
+        uint m_repeats;
+        /// Number of input levels to run.
+        uint m_maxLevel;
+        /// Thread counts to run with ( only 1 is meaningful without OpenMP ).
+        std::vector<uint> m_threads;
+        /// Only run the benchmarks whose name contains this string.
+        std::string m_filter;
+        /// File to write the results to, as JSON.
+        std::string m_outputFile;
+        /// JSON file of a previous run to compare the results to.
+        std::string m_baselineFile;
+        /// Relative slowdown of the median time above which a result is a regression.
+        double m_tolerance;
+    };
+
+    /// Timings of one benchmark, for one level and one thread count, in microseconds.
+    struct Result {
+        std::string m_name;
+        uint m_size;
+        uint m_threads;
+        double m_median;
+        double m_min;
+        double m_mean;
+    };
+
+    /// Empty constructor.
+    BenchmarkManager() {}
+
+    /// Register one benchmark into the manager.
+    void add( Benchmark* benchmark );
+
+    /// Run all benchmarks, write the results and compare them to the baseline if requested.
+    /// Returns the number of regressions.
+    int run();
+
+    /// Write results as a JSON document.
+    static void writeJson( const std::vector<Result>& results, std::ostream& out );
+
+    /// Read the results written by writeJson(). Returns false if the file cannot be read.
+    static bool readJson( const std::string& filename, std::vector<Result>& results );
+
+    /// Print the comparison of results to baseline. Returns the number of regressions.
+    static int compare( const std::vector<Result>& results, const std::vector<Result>& baseline,
+                        double tolerance );
+
+  private:
+    /// Time all the levels of one benchmark.
+    void runBenchmark( Benchmark* benchmark );
+
+  public:
+    Options m_options;                    /// Options of the runs.
+    std::vector<Benchmark*> m_benchmarks; /// Registered benchmarks.
+    std::vector<Result> m_results;        /// Results of the last run.
+};
+
+} // namespace RaBenchmarks
+
+#endif // RADIUM_BENCHMARKS_MANAGER_HPP_
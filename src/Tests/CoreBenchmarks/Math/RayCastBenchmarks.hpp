@@ -0,0 +1,89 @@
+#ifndef RADIUM_RAYCAST_BENCHMARKS_HPP_
+#define RADIUM_RAYCAST_BENCHMARKS_HPP_
+
+#include <Core/Math/RayCast.hpp>
+#include <Core/Math/RayCastPacket.hpp>
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+#include <Tests/CoreBenchmarks/Fixtures.hpp>
+
+namespace RaBenchmarks {
+
+/// Closest hit of a ray through the center of a sphere, one triangle at a time.
+class RayVsTriangleBenchmark : public Benchmark {
+  public:
+    RayVsTriangleBenchmark() : Benchmark( "Math/RayCast::vsTriangle" ) {}
+
+    uint setup( uint level ) override {
+        m_mesh = makeSphere( level );
+        return m_mesh.m_triangles.size();
+    }
+
+    void run() override {
+        const Ra::Core::Math::Ray ray( Ra::Core::Math::Vector3( 2, 0.1f, 0.2f ),
+                                       Ra::Core::Math::Vector3( -1, 0, 0 ) );
+        m_minT = std::numeric_limits<Scalar>::max();
+        for ( const auto& t : m_mesh.m_triangles )
+        {
+            m_hits.clear();
+            if ( Ra::Core::Math::RayCast::vsTriangle( ray, m_mesh.m_vertices[t[0]],
+                                                      m_mesh.m_vertices[t[1]],
+                                                      m_mesh.m_vertices[t[2]], m_hits ) )
+            {
+                m_minT = std::min( m_minT, m_hits[0] );
+            }
+        }
+    }
+
+  private:
+    TriangleMesh m_mesh;
+    std::vector<Scalar> m_hits;
+    Scalar m_minT;
+};
+
+/// Same as RayVsTriangleBenchmark, with the triangles stored in packets of 8.
+class RayVsTrianglesBenchmark : public Benchmark {
+    using Packet = Ra::Core::Math::RayCast::TrianglePacket<8>;
+
+  public:
+    RayVsTrianglesBenchmark() : Benchmark( "Math/RayCast::vsTriangles" ) {}
+
+    uint setup( uint level ) override {
+        const TriangleMesh mesh = makeSphere( level );
+        m_packets.resize( ( mesh.m_triangles.size() + 7 ) / 8 );
+        for ( auto& p : m_packets )
+        {
+            p.setDegenerate();
+        }
+        for ( uint i = 0; i < mesh.m_triangles.size(); ++i )
+        {
+            const auto& t = mesh.m_triangles[i];
+            m_packets[i / 8].set( i % 8, mesh.m_vertices[t[0]], mesh.m_vertices[t[1]],
+                                  mesh.m_vertices[t[2]] );
+        }
+        return mesh.m_triangles.size();
+    }
+
+    void run() override {
+        const Ra::Core::Math::Ray ray( Ra::Core::Math::Vector3( 2, 0.1f, 0.2f ),
+                                       Ra::Core::Math::Vector3( -1, 0, 0 ) );
+        m_minT = std::numeric_limits<Scalar>::max();
+        Ra::Core::Math::RayCast::Lanes<8> hits;
+        for ( const auto& p : m_packets )
+        {
+            if ( Ra::Core::Math::RayCast::vsTriangles( ray, p, hits ) != 0 )
+            {
+                m_minT = std::min( m_minT, hits.minCoeff() );
+            }
+        }
+    }
+
+  private:
+    std::vector<Packet, Eigen::aligned_allocator<Packet>> m_packets;
+    Scalar m_minT;
+};
+
+RA_BENCHMARK_CLASS( RayVsTriangleBenchmark );
+RA_BENCHMARK_CLASS( RayVsTrianglesBenchmark );
+} // namespace RaBenchmarks
+
+#endif // RADIUM_RAYCAST_BENCHMARKS_HPP_
@@ -0,0 +1,78 @@
+#include <Tests/CoreBenchmarks/Benchmarks.hpp>
+
+#include <Tests/CoreBenchmarks/Animation/SkinningBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Containers/IndexMapBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Geometry/DuplicatesBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Geometry/LaplacianBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Geometry/MeshDistanceBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Geometry/NormalBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Geometry/PointKdTreeBenchmarks.hpp>
+#include <Tests/CoreBenchmarks/Math/RayCastBenchmarks.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+namespace {
+void printUsage( const char* program ) {
+    printf( "Usage : %s [options]\n"
+            "  --output <file>      write the results to file, as JSON\n"
+            "  --baseline <file>    compare the results to a previous output, the exit code is "
+            "the number of regressions\n"
+            "  --tolerance <ratio>  relative slowdown of a regression ( default 0.1 )\n"
+            "  --repeats <n>        number of timed runs of each case ( default 10 )\n"
+            "  --levels <n>         number of input sizes ( default 5 )\n"
+            "  --threads <n,m,...>  thread counts ( default 1 )\n"
+            "  --filter <string>    only run the benchmarks whose name contains string\n",
+            program );
+}
+} // namespace
+
+int main( int argc, char** argv ) {
+    if ( !RaBenchmarks::BenchmarkManager::getInstance() )
+    {
+        RaBenchmarks::BenchmarkManager::createInstance();
+    }
+    auto& options = RaBenchmarks::BenchmarkManager::getInstance()->m_options;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        const bool hasValue = i + 1 < argc;
+        if ( !std::strcmp( argv[i], "--output" ) && hasValue )
+        {
+            options.m_outputFile = argv[++i];
+        } else if ( !std::strcmp( argv[i], "--baseline" ) && hasValue )
+        {
+            options.m_baselineFile = argv[++i];
+        } else if ( !std::strcmp( argv[i], "--tolerance" ) && hasValue )
+        {
+            options.m_tolerance = std::atof( argv[++i] );
+        } else if ( !std::strcmp( argv[i], "--repeats" ) && hasValue )
+        {
+            options.m_repeats = uint( std::atoi( argv[++i] ) );
+        } else if ( !std::strcmp( argv[i], "--levels" ) && hasValue )
+        {
+            options.m_maxLevel = uint( std::atoi( argv[++i] ) );
+        } else if ( !std::strcmp( argv[i], "--filter" ) && hasValue )
+        {
+            options.m_filter = argv[++i];
+        } else if ( !std::strcmp( argv[i], "--threads" ) && hasValue )
+        {
+            options.m_threads.clear();
+            std::stringstream list( argv[++i] );
+            std::string count;
+            while ( std::getline( list, count, ',' ) )
+            {
+                options.m_threads.push_back( uint( std::max( std::atoi( count.c_str() ), 1 ) ) );
+            }
+        } else
+        {
+            printUsage( argv[0] );
+            return -1;
+        }
+    }
+
+    return RaBenchmarks::BenchmarkManager::getInstance()->run();
+}
@@ -2,8 +2,12 @@
 #define RADIUM_ANIMATIONTESTS_HPP_
 
 #include <Core/Animation/HandleWeightOperation.hpp>
+#include <Core/Animation/RotationCenterSkinning.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
 #include <Tests.hpp>
 
+#include <cstdio>
+
 using Ra::Core::Animation::WeightMatrix;
 
 namespace RaTests {
@@ -55,6 +59,95 @@ class HandleWeightTests : public Test {
 };
 
 RA_TEST_CLASS( HandleWeightTests )
+
+class CoRTests : public Test {
+    // Three handles blended along the x axis of a grid.
+    void makeData( Ra::Core::Animation::RefData& data ) {
+        data.m_referenceMesh = Ra::Core::Geometry::makePlaneGrid( 12, 12 );
+        const auto& vertices = data.m_referenceMesh.m_vertices;
+        data.m_weights = WeightMatrix( vertices.size(), 3 );
+        for ( uint i = 0; i < vertices.size(); ++i )
+        {
+            const Scalar x = vertices[i].x() / vertices[0].norm();
+            const Scalar w0 = std::max( Scalar( 0 ), -x );
+            const Scalar w2 = std::max( Scalar( 0 ), x );
+            if ( w0 > 0 )
+            {
+                data.m_weights.insert( i, 0 ) = w0;
+            }
+            data.m_weights.insert( i, 1 ) = 1 - w0 - w2;
+            if ( w2 > 0 )
+            {
+                data.m_weights.insert( i, 2 ) = w2;
+            }
+        }
+        data.m_weights.makeCompressed();
+    }
+
+    void run() override {
+        using Ra::Core::Animation::RefData;
+        RefData data;
+        makeData( data );
+        const auto& mesh = data.m_referenceMesh;
+
+        // Without subdivision, the CoRs must match the sum over all the triangles.
+        Ra::Core::Animation::computeCoR( data, 0.1f, 10.f );
+        RA_UNIT_TEST( data.m_CoR.size() == mesh.m_vertices.size(), "Wrong number of CoRs." );
+        const Eigen::SparseMatrix<Scalar, Eigen::RowMajor> rowWeights = data.m_weights;
+        bool match = true;
+        for ( uint i = 0; i < mesh.m_vertices.size(); ++i )
+        {
+            Ra::Core::Math::Vector3 cor( 0, 0, 0 );
+            Scalar sumweight = 0;
+            const Eigen::SparseVector<Scalar> Wi = rowWeights.row( i );
+            for ( uint t = 0; t < mesh.m_triangles.size(); ++t )
+            {
+                const auto& tri = mesh.m_triangles[t];
+                const Eigen::SparseVector<Scalar> triWeight =
+                    ( 1 / 3.f ) * ( rowWeights.row( tri[0] ) + rowWeights.row( tri[1] ) +
+                                    rowWeights.row( tri[2] ) );
+                const Scalar s = Ra::Core::Animation::weightSimilarity( Wi, triWeight, 0.1f ) *
+                                 Ra::Core::Geometry::getTriangleArea( mesh, t );
+                cor += s * ( mesh.m_vertices[tri[0]] + mesh.m_vertices[tri[1]] +
+                             mesh.m_vertices[tri[2]] ) /
+                       3.f;
+                sumweight += s;
+            }
+            if ( sumweight > 0 )
+            {
+                cor /= sumweight;
+            }
+            match = match && ( cor - data.m_CoR[i] ).norm() < 1e-4f;
+        }
+        RA_UNIT_TEST( match, "CoRs differ from the exhaustive sum." );
+
+        // With subdivision, the CoRs of the blended vertices stay inside the grid, and the ones
+        // of the rigid vertices are 0.
+        Ra::Core::Animation::computeCoR( data );
+        const auto aabb = Ra::Core::Geometry::getAabb( mesh );
+        bool inside = true;
+        for ( uint i = 0; i < mesh.m_vertices.size(); ++i )
+        {
+            inside = inside && ( rowWeights.row( i ).nonZeros() > 1
+                                     ? aabb.exteriorDistance( data.m_CoR[i] ) < 1e-5f
+                                     : data.m_CoR[i].isZero() );
+        }
+        RA_UNIT_TEST( inside, "CoRs outside of the mesh." );
+
+        // Cache.
+        const std::string file = Ra::Core::Animation::getCoRCacheFile( "CoRTests", data );
+        RA_UNIT_TEST( file != Ra::Core::Animation::getCoRCacheFile( "CoRTests", data, 0.2f ),
+                      "Cache file does not depend on the parameters." );
+        RA_UNIT_TEST( Ra::Core::Animation::saveCoR( file, data ), "Cannot save the CoRs." );
+        RefData loaded;
+        makeData( loaded );
+        RA_UNIT_TEST( Ra::Core::Animation::loadCoR( file, loaded ) && loaded.m_CoR == data.m_CoR,
+                      "Cannot load the CoRs." );
+        std::remove( file.c_str() );
+    }
+};
+
+RA_TEST_CLASS( CoRTests )
 } // namespace RaTests
 
 #endif // RADIUM_GEOMETRYTESTS_HPP_
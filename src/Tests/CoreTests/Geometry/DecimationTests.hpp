@@ -0,0 +1,150 @@
+#ifndef RADIUM_DECIMATIONTESTS_HPP_
+#define RADIUM_DECIMATIONTESTS_HPP_
+
+#include <Core/Geometry/Decimation.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <map>
+
+namespace RaTests {
+
+class DecimationTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+    using MeshLod = Ra::Core::Geometry::MeshLod;
+
+    /// Returns true if the edges of lod which have a single triangle, once the vertices sharing
+    /// a position are merged, are on the border of the [-0.5, 0.5] square.
+    bool hasNoCrack( const TriangleMesh& mesh, const MeshLod& lod ) {
+        std::vector<Ra::Core::Geometry::VertexIdx> positions;
+        Ra::Core::Geometry::findDuplicates( mesh, positions );
+        std::map<std::pair<int, int>, int> edges;
+        for ( const auto& t : lod.m_triangles )
+        {
+            for ( uint i = 0; i < 3; ++i )
+            {
+                const int a = positions[t[i]];
+                const int b = positions[t[( i + 1 ) % 3]];
+                ++edges[std::make_pair( std::min( a, b ), std::max( a, b ) )];
+            }
+        }
+        for ( const auto& edge : edges )
+        {
+            const auto& a = mesh.m_vertices[edge.first.first];
+            const auto& b = mesh.m_vertices[edge.first.second];
+            const bool onBorder = ( std::abs( std::abs( a.x() ) - 0.5f ) < 1e-5f &&
+                                    std::abs( a.x() - b.x() ) < 1e-5f ) ||
+                                  ( std::abs( std::abs( a.y() ) - 0.5f ) < 1e-5f &&
+                                    std::abs( a.y() - b.y() ) < 1e-5f );
+            if ( edge.second > 2 || ( edge.second == 1 && !onBorder ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void run() override {
+        // Flat grid : no error, and the square is kept.
+        TriangleMesh grid = Ra::Core::Geometry::makePlaneGrid( 16, 16 );
+        std::vector<MeshLod> lods;
+        Ra::Core::Geometry::computeLods( grid, lods, 0.5, 8 );
+        RA_UNIT_TEST( !lods.empty(), "Grid not decimated." );
+        uint numTriangles = grid.m_triangles.size();
+        for ( const auto& lod : lods )
+        {
+            RA_UNIT_TEST( lod.m_triangles.size() < numTriangles, "Level not coarser." );
+            RA_UNIT_TEST( lod.m_error < 1e-5f, "Error on a flat grid." );
+            RA_UNIT_TEST( hasNoCrack( grid, lod ), "Crack in the decimated grid." );
+            numTriangles = lod.m_triangles.size();
+
+            TriangleMesh lodMesh;
+            std::vector<uint> vertexMap;
+            Ra::Core::Geometry::getLodMesh( grid, lod, lodMesh, vertexMap );
+            RA_UNIT_TEST( Ra::Core::Geometry::getAabb( lodMesh ).isApprox(
+                              Ra::Core::Geometry::getAabb( grid ) ),
+                          "Boundary of the grid not kept." );
+            RA_UNIT_TEST( lodMesh.m_normals.size() == lodMesh.m_vertices.size(),
+                          "Normals of the level not kept." );
+        }
+
+        // Seam along the middle column of the grid : the triangles on the left use copies of
+        // its vertices, which must still be the case once decimated.
+        const uint numVertices = grid.m_vertices.size();
+        Scalar seamX = grid.m_vertices[0].x();
+        for ( const auto& v : grid.m_vertices )
+        {
+            seamX = std::abs( v.x() ) < std::abs( seamX ) ? v.x() : seamX;
+        }
+        std::vector<uint> copies( numVertices, uint( -1 ) );
+        for ( auto& t : grid.m_triangles )
+        {
+            const Scalar x = ( grid.m_vertices[t[0]] + grid.m_vertices[t[1]] +
+                               grid.m_vertices[t[2]] ).x() / 3;
+            for ( uint i = 0; i < 3 && x < seamX; ++i )
+            {
+                if ( grid.m_vertices[t[i]].x() == seamX )
+                {
+                    if ( copies[t[i]] == uint( -1 ) )
+                    {
+                        copies[t[i]] = grid.m_vertices.size();
+                        grid.m_vertices.push_back( grid.m_vertices[t[i]] );
+                        grid.m_normals.push_back( grid.m_normals[t[i]] );
+                    }
+                    t[i] = copies[t[i]];
+                }
+            }
+        }
+        Ra::Core::Geometry::computeLods( grid, lods, 0.5, 8 );
+        RA_UNIT_TEST( !lods.empty(), "Grid with a seam not decimated." );
+        for ( const auto& lod : lods )
+        {
+            RA_UNIT_TEST( hasNoCrack( grid, lod ), "Crack along the seam." );
+            bool seamKept = true;
+            for ( const auto& t : lod.m_triangles )
+            {
+                const Scalar x = ( grid.m_vertices[t[0]] + grid.m_vertices[t[1]] +
+                                   grid.m_vertices[t[2]] ).x() / 3;
+                for ( uint i = 0; i < 3; ++i )
+                {
+                    seamKept = seamKept && ( x < seamX ? t[i] >= numVertices ||
+                                                             copies[t[i]] == uint( -1 )
+                                                       : t[i] < numVertices );
+                }
+            }
+            RA_UNIT_TEST( seamKept, "Seam not kept." );
+        }
+
+        // Sphere : the error grows with the levels, and bounds the distance to the sphere.
+        TriangleMesh sphere = Ra::Core::Geometry::makeGeodesicSphere( 1.f, 4 );
+        std::vector<Ra::Core::Geometry::VertexIdx> duplicates;
+        Ra::Core::Geometry::removeDuplicates( sphere, duplicates );
+        for ( auto& v : sphere.m_vertices )
+        {
+            v.normalize();
+        }
+        Ra::Core::Geometry::computeLods( sphere, lods, 0.5, 64 );
+        RA_UNIT_TEST( lods.size() > 2, "Sphere not decimated." );
+        Scalar error = 0;
+        for ( const auto& lod : lods )
+        {
+            RA_UNIT_TEST( lod.m_error >= error, "Decreasing error." );
+            error = lod.m_error;
+            bool bounded = true;
+            for ( const auto& t : lod.m_triangles )
+            {
+                const auto center = ( sphere.m_vertices[t[0]] + sphere.m_vertices[t[1]] +
+                                      sphere.m_vertices[t[2]] ) /
+                                    3;
+                bounded = bounded && 1 - center.norm() <= lod.m_error;
+            }
+            RA_UNIT_TEST( bounded, "Error of a level too small." );
+        }
+    }
+};
+
+RA_TEST_CLASS( DecimationTests );
+} // namespace RaTests
+
+#endif // RADIUM_DECIMATIONTESTS_HPP_
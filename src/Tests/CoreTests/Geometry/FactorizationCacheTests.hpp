@@ -0,0 +1,89 @@
+#ifndef RADIUM_FACTORIZATIONCACHETESTS_HPP_
+#define RADIUM_FACTORIZATIONCACHETESTS_HPP_
+
+#include <Core/Geometry/Area.hpp>
+#include <Core/Geometry/FactorizationCache.hpp>
+#include <Core/Geometry/HeatDiffusion.hpp>
+#include <Core/Geometry/Laplacian.hpp>
+#include <Core/Geometry/LaplacianSmoothing.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <cmath>
+
+namespace RaTests {
+
+class FactorizationCacheTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+
+    void run() override {
+        TriangleMesh grid = Ra::Core::Geometry::makePlaneGrid( 10, 10 );
+        const uint size = grid.m_vertices.size();
+        auto A = Ra::Core::Geometry::mixedArea( grid.m_vertices, grid.m_triangles );
+        auto L = Ra::Core::Geometry::cotangentWeightLaplacian( grid.m_vertices, grid.m_triangles );
+        const Scalar t = 0.01f;
+
+        // Two sources solved at once give the heat of each source.
+        Ra::Core::Geometry::FactorizationCache cache;
+        Ra::Core::Math::MatrixN deltas = Ra::Core::Math::MatrixN::Zero( size, 2 );
+        deltas( 0, 0 ) = 1;
+        deltas( size / 2, 1 ) = 1;
+        Ra::Core::Math::MatrixN u;
+        Ra::Core::Geometry::heat( cache, A, t, L, deltas, u );
+        bool sameHeat = u.cols() == 2;
+        for ( uint i = 0; i < 2 && sameHeat; ++i )
+        {
+            Ra::Core::Geometry::Delta delta = deltas.col( i ).sparseView();
+            Ra::Core::Geometry::Heat reference = Ra::Core::Geometry::heat( A, t, L, delta );
+            sameHeat = ( reference.getMap() - u.col( i ).transpose() ).norm() < 1e-4f;
+        }
+        RA_UNIT_TEST( sameHeat, "Batched heat differs from the direct solve." );
+        RA_UNIT_TEST( cache.getNumFactorizations() == 1, "System not factorized once." );
+
+        // Solving again reuses the factorization.
+        Ra::Core::Geometry::heat( cache, A, t, L, deltas, u );
+        RA_UNIT_TEST( cache.getNumFactorizations() == 1, "System factorized again." );
+
+        // Moving the vertices only updates the numeric factorization.
+        for ( auto& v : grid.m_vertices )
+        {
+            v.z() = 0.1f * std::sin( 9 * v.x() ) * std::sin( 9 * v.y() );
+        }
+        A = Ra::Core::Geometry::mixedArea( grid.m_vertices, grid.m_triangles );
+        L = Ra::Core::Geometry::cotangentWeightLaplacian( grid.m_vertices, grid.m_triangles );
+        cache.setGeometryVersion( 1 );
+        RA_UNIT_TEST( !cache.isFactorized( "heat", t ), "Factorization not outdated." );
+        Ra::Core::Geometry::heat( cache, A, t, L, deltas, u );
+        Ra::Core::Geometry::Delta delta = deltas.col( 0 ).sparseView();
+        const Ra::Core::Geometry::Heat reference = Ra::Core::Geometry::heat( A, t, L, delta );
+        RA_UNIT_TEST( ( reference.getMap() - u.col( 0 ).transpose() ).norm() < 1e-4f,
+                      "Wrong heat after refactorization." );
+        RA_UNIT_TEST( cache.getNumFactorizations() == 2 && cache.getNumAnalyses() == 1,
+                      "Symbolic analysis not reused." );
+
+        // Implicit smoothing flattens the bumps, through its own system.
+        Ra::Core::Container::VectorArray<Ra::Core::Math::Vector3> smoothed;
+        Ra::Core::Geometry::implicitLaplacianSmoothing( cache, grid.m_vertices, A, L, 0.1f,
+                                                        smoothed );
+        Scalar bumps = 0;
+        Scalar smoothedBumps = 0;
+        for ( uint i = 0; i < size; ++i )
+        {
+            bumps += std::abs( grid.m_vertices[i].z() );
+            smoothedBumps += std::abs( smoothed[i].z() );
+        }
+        RA_UNIT_TEST( smoothedBumps < 0.5f * bumps, "Implicit smoothing does not smooth." );
+        RA_UNIT_TEST( cache.isFactorized( "heat", t ) &&
+                          cache.isFactorized( "implicitSmoothing", 0.1f ),
+                      "Systems not kept side by side." );
+
+        // A new topology drops the factorizations.
+        cache.setTopologyVersion( 1 );
+        RA_UNIT_TEST( !cache.isFactorized( "heat", t ), "Factorization kept for a new topology." );
+    }
+};
+
+RA_TEST_CLASS( FactorizationCacheTests );
+} // namespace RaTests
+
+#endif // RADIUM_FACTORIZATIONCACHETESTS_HPP_
@@ -0,0 +1,140 @@
+#ifndef RADIUM_HALFEDGETESTS_HPP_
+#define RADIUM_HALFEDGETESTS_HPP_
+
+#include <Core/Geometry/HalfEdge.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <map>
+#include <set>
+
+namespace RaTests {
+
+class HalfEdgeTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+    using HalfEdgeData = Ra::Core::Geometry::HalfEdgeData;
+    using VertexIdx = Ra::Core::Geometry::VertexIdx;
+
+    /// Returns true if the one rings of heData are the neighbors of the vertices in its
+    /// triangles, and if the structure has as many border half edges as edges with a single
+    /// triangle.
+    bool isConsistent( const HalfEdgeData& heData ) {
+        Ra::Core::Container::VectorArray<Ra::Core::Geometry::Triangle> triangles;
+        heData.getTriangles( triangles );
+        std::vector<std::set<int>> neighbors( heData.getNumVertices() );
+        std::map<std::pair<int, int>, int> edges;
+        for ( const auto& t : triangles )
+        {
+            for ( uint i = 0; i < 3; ++i )
+            {
+                const int a = t[i];
+                const int b = t[( i + 1 ) % 3];
+                neighbors[a].insert( b );
+                neighbors[b].insert( a );
+                ++edges[std::make_pair( std::min( a, b ), std::max( a, b ) )];
+            }
+        }
+        std::vector<uint> offsets;
+        std::vector<VertexIdx> ring;
+        heData.getOneRings( offsets, ring );
+        for ( uint v = 0; v < heData.getNumVertices(); ++v )
+        {
+            const std::set<int> ringSet( ring.begin() + offsets[v], ring.begin() + offsets[v + 1] );
+            if ( ringSet != neighbors[v] || ringSet.size() != offsets[v + 1] - offsets[v] )
+            {
+                return false;
+            }
+        }
+        uint numBorderEdges = 0;
+        for ( const auto& e : edges )
+        {
+            numBorderEdges += e.second == 1 ? 1 : 0;
+        }
+        uint numBorderHalfEdges = 0;
+        for ( uint h = 0; h < heData.getNumHalfEdges(); ++h )
+        {
+            const bool deleted = heData.isDeleted( HalfEdgeData::getTriangle( h ) );
+            numBorderHalfEdges += !deleted && heData.isBorder( h ) ? 1 : 0;
+        }
+        return numBorderEdges == numBorderHalfEdges;
+    }
+
+    void run() override {
+        // Regular grid : the inner vertices have 6 neighbors, the corners 2 or 3.
+        TriangleMesh grid = Ra::Core::Geometry::makePlaneGrid( 4, 4 );
+        HalfEdgeData heGrid( grid );
+        RA_UNIT_TEST( isConsistent( heGrid ), "Inconsistent grid half edges." );
+        std::vector<VertexIdx> ring;
+        Ra::Core::Geometry::getVertexFirstRing( grid, heGrid, 12, ring );
+        RA_UNIT_TEST( ring.size() == 6 && !heGrid.isBorderVertex( 12 ), "Wrong inner ring." );
+        for ( uint i = 0; i < ring.size(); ++i )
+        {
+            // Consecutive neighbors share a triangle with the vertex.
+            std::vector<Ra::Core::Geometry::TriangleIdx> faces;
+            Ra::Core::Geometry::getVertexFaces( grid, heGrid, ring[i], faces );
+            bool shared = false;
+            for ( auto t : faces )
+            {
+                const auto& tri = grid.m_triangles[t];
+                shared = shared || ( ( tri.array() == 12 ).any() &&
+                                     ( tri.array() == uint( ring[( i + 1 ) % 6] ) ).any() );
+            }
+            RA_UNIT_TEST( shared, "Ring not ordered." );
+        }
+
+        // Splitting and flipping edges keep the structure consistent.
+        const uint numVertices = heGrid.getNumVertices();
+        const uint numTriangles = heGrid.getNumTriangles();
+        const VertexIdx m = heGrid.splitEdge( heGrid.getVertexHalfEdge( 12 ) );
+        RA_UNIT_TEST( m == int( numVertices ) && heGrid.getNumTriangles() == numTriangles + 2,
+                      "Wrong inner split." );
+        heGrid.splitEdge( heGrid.getVertexHalfEdge( 0 ) );
+        RA_UNIT_TEST( heGrid.getNumTriangles() == numTriangles + 3, "Wrong border split." );
+        RA_UNIT_TEST( isConsistent( heGrid ), "Inconsistent split." );
+        uint numFlips = 0;
+        for ( uint h = 0; h < heGrid.getNumHalfEdges(); h += 5 )
+        {
+            if ( heGrid.isFlipOk( h ) )
+            {
+                heGrid.flipEdge( h );
+                ++numFlips;
+            }
+        }
+        RA_UNIT_TEST( numFlips > 0 && isConsistent( heGrid ), "Inconsistent flips." );
+
+        // Collapsing edges of a sphere keeps a closed surface.
+        TriangleMesh sphere = Ra::Core::Geometry::makeGeodesicSphere( 1.f, 3 );
+        std::vector<VertexIdx> duplicates;
+        Ra::Core::Geometry::removeDuplicates( sphere, duplicates );
+        HalfEdgeData heSphere( sphere );
+        RA_UNIT_TEST( isConsistent( heSphere ), "Inconsistent sphere half edges." );
+        uint numCollapses = 0;
+        for ( uint h = 0; h < heSphere.getNumHalfEdges(); h += 7 )
+        {
+            if ( heSphere.isCollapseOk( h ) )
+            {
+                heSphere.collapseEdge( h );
+                ++numCollapses;
+            }
+        }
+        heSphere.garbageCollection();
+        RA_UNIT_TEST( isConsistent( heSphere ), "Inconsistent collapses." );
+        uint numUsedVertices = 0;
+        for ( uint v = 0; v < heSphere.getNumVertices(); ++v )
+        {
+            numUsedVertices += heSphere.getVertexHalfEdge( v ).isValid() ? 1 : 0;
+        }
+        // Closed surface of genus 0 : V - E + F = 2, with 3 F = 2 E.
+        RA_UNIT_TEST( numCollapses > 0 &&
+                          heSphere.getNumTriangles() == sphere.m_triangles.size() -
+                                                            2 * numCollapses &&
+                          2 * numUsedVertices == heSphere.getNumTriangles() + 4,
+                      "Collapses do not keep a sphere." );
+    }
+};
+
+RA_TEST_CLASS( HalfEdgeTests );
+} // namespace RaTests
+
+#endif // RADIUM_HALFEDGETESTS_HPP_
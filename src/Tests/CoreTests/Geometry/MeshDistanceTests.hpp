@@ -0,0 +1,93 @@
+#ifndef RADIUM_MESHDISTANCETESTS_HPP_
+#define RADIUM_MESHDISTANCETESTS_HPP_
+
+#include <Core/Geometry/DistanceQueries.hpp>
+#include <Core/Geometry/MeshDistance.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <random>
+
+namespace RaTests {
+
+class MeshDistanceTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+    using Vector3 = Ra::Core::Math::Vector3;
+
+    void run() override {
+        TriangleMesh sphere = Ra::Core::Geometry::makeGeodesicSphere( 1.f, 3 );
+        std::vector<Ra::Core::Geometry::VertexIdx> duplicates;
+        Ra::Core::Geometry::removeDuplicates( sphere, duplicates );
+        for ( auto& v : sphere.m_vertices )
+        {
+            v.normalize();
+        }
+        Ra::Core::Geometry::MeshDistance distance( sphere );
+
+        // Queries inside and outside the sphere, away from its surface.
+        std::mt19937 gen( 5 );
+        std::normal_distribution<Scalar> dis( 0.f, 1.f );
+        std::uniform_real_distribution<Scalar> radius( 0.f, 0.6f );
+        Ra::Core::Container::Vector3Array queries( 200 );
+        for ( uint i = 0; i < queries.size(); ++i )
+        {
+            const Scalar r = i % 2 == 0 ? 0.2f + radius( gen ) : 1.2f + radius( gen );
+            queries[i] = Vector3( dis( gen ), dis( gen ), dis( gen ) ).normalized() * r;
+        }
+
+        std::vector<Ra::Core::Geometry::MeshDistance::ClosestPoint> closest;
+        distance.getClosestPoints( queries, closest );
+        std::vector<Scalar> signedDistances;
+        distance.getSignedDistances( queries, signedDistances );
+        bool closestOk = true;
+        bool signOk = true;
+        for ( uint i = 0; i < queries.size(); ++i )
+        {
+            Scalar best = std::numeric_limits<Scalar>::max();
+            for ( const auto& t : sphere.m_triangles )
+            {
+                best = std::min( best, Ra::Core::Geometry::pointToTriSq(
+                                           queries[i], sphere.m_vertices[t[0]],
+                                           sphere.m_vertices[t[1]], sphere.m_vertices[t[2]] )
+                                           .distanceSquared );
+            }
+            closestOk = closestOk && closest[i].m_triangle.isValid() &&
+                        closest[i].m_squaredDistance == best;
+            signOk = signOk && ( signedDistances[i] < 0 ) == ( queries[i].norm() < 1 );
+        }
+        RA_UNIT_TEST( closestOk, "Wrong closest points." );
+        RA_UNIT_TEST( signOk, "Wrong signs of the distances." );
+
+        // The closest points of the vertices are the vertices, and the sign is right at the
+        // vertices and edges too.
+        bool verticesOk = true;
+        for ( const auto& v : sphere.m_vertices )
+        {
+            verticesOk = verticesOk && distance.getClosestPoint( v ).m_squaredDistance < 1e-10f &&
+                         distance.getSignedDistance( v * 1.01f ) > 0 &&
+                         distance.getSignedDistance( v * 0.99f ) < 0;
+        }
+        RA_UNIT_TEST( verticesOk, "Wrong distances around the vertices." );
+        RA_UNIT_TEST( distance.getClosestPoint( Vector3( 3.f, 0.f, 0.f ), 1.f )
+                          .m_triangle.isInvalid(),
+                      "Closest point beyond the maximal distance." );
+
+        // Hausdorff distance to a scaled copy.
+        TriangleMesh scaled = sphere;
+        for ( auto& v : scaled.m_vertices )
+        {
+            v *= 1.1f;
+        }
+        const Scalar hausdorff = Ra::Core::Geometry::hausdorffDistance( sphere, scaled );
+        RA_UNIT_TEST( hausdorff >= 0.1f - 1e-5f && hausdorff < 0.13f,
+                      "Wrong Hausdorff distance." );
+        RA_UNIT_TEST( Ra::Core::Geometry::hausdorffDistance( sphere, sphere ) < 1e-5f,
+                      "Non zero Hausdorff distance to itself." );
+    }
+};
+
+RA_TEST_CLASS( MeshDistanceTests );
+} // namespace RaTests
+
+#endif // RADIUM_MESHDISTANCETESTS_HPP_
@@ -0,0 +1,117 @@
+#ifndef RADIUM_OPERATORASSEMBLYTESTS_HPP_
+#define RADIUM_OPERATORASSEMBLYTESTS_HPP_
+
+#include <Core/Geometry/Adjacency.hpp>
+#include <Core/Geometry/Area.hpp>
+#include <Core/Geometry/Laplacian.hpp>
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/OperatorAssembly.hpp>
+#include <Core/Geometry/TriangleOperation.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <cmath>
+#include <set>
+
+namespace RaTests {
+
+class OperatorAssemblyTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+    using Sparse = Ra::Core::Math::Sparse;
+
+    /// Dense cotangent Laplacian, summing the contributions of the triangles one by one.
+    Ra::Core::Math::MatrixN referenceLaplacian( const TriangleMesh& mesh ) {
+        const auto& p = mesh.m_vertices;
+        Ra::Core::Math::MatrixN L = Ra::Core::Math::MatrixN::Zero( p.size(), p.size() );
+        for ( const auto& t : mesh.m_triangles )
+        {
+            for ( uint e = 0; e < 3; ++e )
+            {
+                const uint i = t[e];
+                const uint j = t[( e + 1 ) % 3];
+                const uint k = t[( e + 2 ) % 3];
+                const Scalar cot = Ra::Core::Math::Vector::cotan( p[i] - p[k], p[j] - p[k] ) / 2;
+                L( i, j ) -= cot;
+                L( j, i ) -= cot;
+                L( i, i ) += cot;
+                L( j, j ) += cot;
+            }
+        }
+        return L;
+    }
+
+    void run() override {
+        // Bumpy grid, so that the cotangents differ.
+        TriangleMesh grid = Ra::Core::Geometry::makePlaneGrid( 8, 6 );
+        for ( auto& v : grid.m_vertices )
+        {
+            v.z() = 0.2f * std::sin( 7 * v.x() ) * std::cos( 5 * v.y() );
+        }
+        const auto& p = grid.m_vertices;
+        const auto& T = grid.m_triangles;
+
+        const Sparse L = Ra::Core::Geometry::cotangentWeightLaplacian( p, T );
+        RA_UNIT_TEST( ( Ra::Core::Math::MatrixN( L ) - referenceLaplacian( grid ) ).norm() < 1e-4f,
+                      "Wrong cotangent Laplacian." );
+
+        const Sparse A = Ra::Core::Geometry::cotangentWeightAdjacency( p, T );
+        const Sparse D = Ra::Core::Geometry::adjacencyDegree( A );
+        RA_UNIT_TEST( ( L - Ra::Core::Geometry::standardLaplacian( D, A ) ).norm() < 1e-4f,
+                      "Cotangent adjacency does not match the Laplacian." );
+
+        // Refill after moving the vertices : same storage, same values as a new assembly.
+        Ra::Core::Geometry::MeshOperatorAssembler assembler( p.size(), T );
+        RA_UNIT_TEST( assembler.hasTopology( p.size(), T ), "Topology not kept." );
+        Sparse refilled;
+        assembler.cotangentWeightLaplacian( p, refilled );
+        const Scalar* storage = refilled.valuePtr();
+        TriangleMesh moved = grid;
+        for ( auto& v : moved.m_vertices )
+        {
+            v.z() *= -2;
+        }
+        assembler.cotangentWeightLaplacian( moved.m_vertices, refilled );
+        RA_UNIT_TEST( refilled.valuePtr() == storage, "Operator storage not reused." );
+        RA_UNIT_TEST( ( Ra::Core::Math::MatrixN( refilled ) - referenceLaplacian( moved ) )
+                              .norm() < 1e-4f,
+                      "Wrong refilled Laplacian." );
+
+        // Uniform adjacency : one coefficient of 1 per half-edge.
+        const Sparse U = Ra::Core::Geometry::uniformAdjacency( p, T );
+        std::set<std::pair<uint, uint>> halfEdges;
+        for ( const auto& t : T )
+        {
+            for ( uint e = 0; e < 3; ++e )
+            {
+                halfEdges.emplace( t[e], t[( e + 1 ) % 3] );
+            }
+        }
+        RA_UNIT_TEST( uint( U.nonZeros() ) == halfEdges.size() &&
+                          std::abs( U.sum() - Scalar( halfEdges.size() ) ) < 1e-4f,
+                      "Wrong uniform adjacency." );
+        const Sparse TV = Ra::Core::Geometry::triangleUniformAdjacency( p, T );
+        RA_UNIT_TEST( TV.rows() == int( T.size() ) && TV.nonZeros() == 3 * int( T.size() ),
+                      "Wrong triangle adjacency." );
+
+        // The mixed areas partition the surface, the one-ring areas cover it three times.
+        Scalar area = 0;
+        for ( const auto& t : T )
+        {
+            area += Ra::Core::Geometry::triangleArea( p[t[0]], p[t[1]], p[t[2]] );
+        }
+        RA_UNIT_TEST( std::abs( Ra::Core::Geometry::mixedArea( p, T ).sum() - area ) < 1e-4f,
+                      "Wrong mixed areas." );
+        RA_UNIT_TEST( std::abs( Ra::Core::Geometry::oneRingArea( p, T ).sum() - 3 * area ) <
+                          1e-4f,
+                      "Wrong one-ring areas." );
+
+        auto fewerTriangles = T;
+        fewerTriangles.pop_back();
+        assembler.setTopology( p.size(), fewerTriangles );
+        RA_UNIT_TEST( !assembler.hasTopology( p.size(), T ), "Topology change not detected." );
+    }
+};
+
+RA_TEST_CLASS( OperatorAssemblyTests );
+} // namespace RaTests
+
+#endif // RADIUM_OPERATORASSEMBLYTESTS_HPP_
@@ -0,0 +1,79 @@
+#ifndef RADIUM_POINTCLOUDPROCESSINGTESTS_HPP_
+#define RADIUM_POINTCLOUDPROCESSINGTESTS_HPP_
+
+#include <Core/Geometry/PointCloudProcessing.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <random>
+
+namespace RaTests {
+
+class PointCloudProcessingTests : public Test {
+    using Vector3 = Ra::Core::Math::Vector3;
+    using Vector3Array = Ra::Core::Container::Vector3Array;
+
+    void run() override {
+        // Random points on two spheres far from each other, i.e. two components.
+        std::mt19937 gen( 3 );
+        std::normal_distribution<Scalar> dis( 0.f, 1.f );
+        Vector3Array points( 3000 );
+        for ( uint i = 0; i < points.size(); ++i )
+        {
+            const Vector3 center( i < 2000 ? 0.f : 5.f, 0.f, 0.f );
+            points[i] = center + Vector3( dis( gen ), dis( gen ), dis( gen ) ).normalized();
+        }
+        Ra::Core::Geometry::PointKdTree tree( points );
+
+        Vector3Array normals;
+        Ra::Core::Geometry::estimateNormals( tree, points, 12, normals );
+        Ra::Core::Geometry::orientNormals( tree, points, 12, normals );
+        uint numWrong = 0;
+        for ( uint i = 0; i < points.size(); ++i )
+        {
+            const Vector3 center( i < 2000 ? 0.f : 5.f, 0.f, 0.f );
+            numWrong += normals[i].dot( points[i] - center ) < 0.95f ? 1 : 0;
+        }
+        RA_UNIT_TEST( numWrong == 0, "Wrong normals of the spheres." );
+
+        Ra::Core::Geometry::orientNormalsTowards( points, Vector3::Zero(), normals );
+        RA_UNIT_TEST( normals[0].dot( points[0] ) < 0, "Normal not towards the viewpoint." );
+
+        // Far points are outliers.
+        Vector3Array noisy = points;
+        noisy.push_back( Vector3( 0.f, 3.f, 0.f ) );
+        noisy.push_back( Vector3( 2.f, 2.f, 2.f ) );
+        Ra::Core::Geometry::PointKdTree noisyTree( noisy );
+        std::vector<uint> inliers;
+        Ra::Core::Geometry::getStatisticalInliers( noisyTree, noisy, 8, 3.f, inliers );
+        RA_UNIT_TEST( inliers.size() >= points.size() * 0.99f && inliers.size() <= points.size() &&
+                          inliers.back() < points.size(),
+                      "Wrong outliers." );
+
+        // Voxels of a regular grid of points, 2 x 2 x 2 points per voxel.
+        Vector3Array grid;
+        for ( uint x = 0; x < 8; ++x )
+        {
+            for ( uint y = 0; y < 8; ++y )
+            {
+                for ( uint z = 0; z < 8; ++z )
+                {
+                    grid.push_back( Vector3( x + 0.5f, y + 0.5f, z + 0.5f ) * 0.25f );
+                }
+            }
+        }
+        Vector3Array downsampled;
+        std::vector<uint> pointCells;
+        Ra::Core::Geometry::voxelDownsample( grid, 0.5f, downsampled, pointCells );
+        bool cellsOk = downsampled.size() == 64;
+        for ( uint i = 0; i < grid.size(); ++i )
+        {
+            cellsOk = cellsOk && ( downsampled[pointCells[i]] - grid[i] ).norm() < 0.25f;
+        }
+        RA_UNIT_TEST( cellsOk, "Wrong voxel downsampling." );
+    }
+};
+
+RA_TEST_CLASS( PointCloudProcessingTests );
+} // namespace RaTests
+
+#endif // RADIUM_POINTCLOUDPROCESSINGTESTS_HPP_
@@ -0,0 +1,158 @@
+#ifndef RADIUM_POINTKDTREETESTS_HPP_
+#define RADIUM_POINTKDTREETESTS_HPP_
+
+#include <Core/Geometry/PointHashGrid.hpp>
+#include <Core/Geometry/PointKdTree.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <algorithm>
+#include <random>
+
+namespace RaTests {
+
+class PointKdTreeTests : public Test {
+    using Vector3 = Ra::Core::Math::Vector3;
+    using Vector3Array = Ra::Core::Container::Vector3Array;
+
+    /// Returns the points at distance at most radius from q, by brute force.
+    std::vector<uint> bruteInRadius( const Vector3Array& points, const Vector3& q,
+                                     Scalar radius ) {
+        std::vector<uint> indices;
+        for ( uint i = 0; i < points.size(); ++i )
+        {
+            if ( ( points[i] - q ).norm() <= radius )
+            {
+                indices.push_back( i );
+            }
+        }
+        return indices;
+    }
+
+    /// Returns the parameter of the projection of p on the half line of the ray.
+    Scalar rayParameter( const Ra::Core::Math::Ray& ray, const Vector3& p ) {
+        return std::max( Scalar( 0 ), ( p - ray.origin() ).dot( ray.direction().normalized() ) );
+    }
+
+    /// Returns the squared distance of p to the half line of the ray.
+    Scalar rayDistance( const Ra::Core::Math::Ray& ray, const Vector3& p ) {
+        const Vector3 d = ray.direction().normalized();
+        return ( ray.origin() + rayParameter( ray, p ) * d - p ).squaredNorm();
+    }
+
+    void run() override {
+        std::mt19937 gen( 7 );
+        std::uniform_real_distribution<Scalar> dis( -1.f, 1.f );
+        Vector3Array points( 2000 );
+        for ( auto& p : points )
+        {
+            p = Vector3( dis( gen ), dis( gen ), dis( gen ) );
+        }
+        // Duplicated points must not break the median splits.
+        std::fill( points.begin(), points.begin() + 50, Vector3( 0.5f, 0.5f, 0.5f ) );
+        Vector3Array queries( 100 );
+        for ( auto& q : queries )
+        {
+            q = Vector3( dis( gen ), dis( gen ), dis( gen ) ) * 1.2f;
+        }
+
+        Ra::Core::Geometry::PointKdTree tree( points, 8 );
+        RA_UNIT_TEST( tree.size() == points.size(), "Wrong tree size." );
+
+        // Nearest and k nearest neighbors.
+        const uint k = 10;
+        std::vector<Ra::Core::Container::Index> nearest;
+        std::vector<uint> kNearest;
+        tree.getNearest( queries, nearest );
+        tree.getKNearest( queries, k, kNearest );
+        bool nearestOk = true;
+        bool kNearestOk = true;
+        for ( uint i = 0; i < queries.size(); ++i )
+        {
+            std::vector<Scalar> distances( points.size() );
+            for ( uint j = 0; j < points.size(); ++j )
+            {
+                distances[j] = ( points[j] - queries[i] ).squaredNorm();
+            }
+            std::vector<Scalar> sorted = distances;
+            std::sort( sorted.begin(), sorted.end() );
+            nearestOk = nearestOk && distances[nearest[i]] == sorted[0];
+            for ( uint j = 0; j < k; ++j )
+            {
+                kNearestOk = kNearestOk && distances[kNearest[k * i + j]] == sorted[j];
+            }
+        }
+        RA_UNIT_TEST( nearestOk, "Wrong nearest neighbors." );
+        RA_UNIT_TEST( kNearestOk, "Wrong k nearest neighbors." );
+
+        // Radius queries, with the tree and the hash grid.
+        const Scalar radius = 0.2f;
+        Ra::Core::Geometry::PointHashGrid grid( points, radius );
+        std::vector<uint> treeOffsets, treeIndices, gridOffsets, gridIndices;
+        tree.getInRadius( queries, radius, treeOffsets, treeIndices );
+        grid.getInRadius( queries, radius, gridOffsets, gridIndices );
+        bool treeOk = true;
+        bool gridOk = true;
+        for ( uint i = 0; i < queries.size(); ++i )
+        {
+            const std::vector<uint> expected = bruteInRadius( points, queries[i], radius );
+            std::vector<uint> fromTree( treeIndices.begin() + treeOffsets[i],
+                                        treeIndices.begin() + treeOffsets[i + 1] );
+            std::vector<uint> fromGrid( gridIndices.begin() + gridOffsets[i],
+                                        gridIndices.begin() + gridOffsets[i + 1] );
+            std::sort( fromTree.begin(), fromTree.end() );
+            std::sort( fromGrid.begin(), fromGrid.end() );
+            treeOk = treeOk && fromTree == expected;
+            gridOk = gridOk && fromGrid == expected;
+        }
+        RA_UNIT_TEST( treeOk, "Wrong kd-tree radius queries." );
+        RA_UNIT_TEST( gridOk, "Wrong hash grid radius queries." );
+
+        // Ray queries.
+        std::vector<Ra::Core::Math::Ray> rays;
+        for ( uint i = 0; i < 50; ++i )
+        {
+            rays.emplace_back( Vector3( dis( gen ), dis( gen ), dis( gen ) ) * 2.f,
+                               Vector3( dis( gen ), dis( gen ), dis( gen ) ) );
+        }
+        rays.emplace_back( Vector3( -2.f, 0.f, 0.f ), Vector3( 1.f, 0.f, 0.f ) );
+        const Ra::Core::Math::Ray farRay( Vector3( 5.f, 5.f, 5.f ), Vector3( 1.f, 0.f, 0.f ) );
+        std::vector<Ra::Core::Container::Index> closest;
+        tree.getClosestToRay( rays, std::numeric_limits<Scalar>::max(), closest );
+        bool closestOk = true;
+        bool nearRayOk = true;
+        for ( uint i = 0; i < rays.size(); ++i )
+        {
+            Scalar best = std::numeric_limits<Scalar>::max();
+            for ( const auto& p : points )
+            {
+                best = std::min( best, rayDistance( rays[i], p ) );
+            }
+            closestOk = closestOk && closest[i].isValid() &&
+                        rayDistance( rays[i], points[closest[i]] ) == best;
+
+            std::vector<uint> near;
+            tree.getNearRay( rays[i], 0.1f, near );
+            uint expected = 0;
+            for ( const auto& p : points )
+            {
+                expected += rayDistance( rays[i], p ) <= 0.1f * 0.1f ? 1 : 0;
+            }
+            nearRayOk = nearRayOk && near.size() == expected;
+            for ( uint j = 1; j < near.size(); ++j )
+            {
+                nearRayOk = nearRayOk && rayParameter( rays[i], points[near[j - 1]] ) <=
+                                             rayParameter( rays[i], points[near[j]] );
+            }
+        }
+        RA_UNIT_TEST( closestOk, "Wrong closest points to rays." );
+        RA_UNIT_TEST( nearRayOk, "Wrong points near rays." );
+        RA_UNIT_TEST( tree.getClosestToRay( farRay, 1.f ).isInvalid() &&
+                          tree.getClosestToRay( farRay ).isValid(),
+                      "Closest point beyond the maximal distance." );
+    }
+};
+
+RA_TEST_CLASS( PointKdTreeTests );
+} // namespace RaTests
+
+#endif // RADIUM_POINTKDTREETESTS_HPP_
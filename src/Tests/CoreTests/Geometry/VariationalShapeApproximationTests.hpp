@@ -0,0 +1,85 @@
+#ifndef RADIUM_VARIATIONALSHAPEAPPROXIMATIONTESTS_HPP_
+#define RADIUM_VARIATIONALSHAPEAPPROXIMATIONTESTS_HPP_
+
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Core/Geometry/VariationalShapeApproximation.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+namespace RaTests {
+
+class VariationalShapeApproximationTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+    using VSA = Ra::Core::Geometry::VSA_L21<8>;
+
+    /// Returns true if each face is in the region of its partition ID.
+    bool isPartition( const VSA& vsa, uint numTriangles ) {
+        uint size = 0;
+        for ( uint i = 0; i < VSA::K; ++i )
+        {
+            for ( const auto& t : vsa.region( i ) )
+            {
+                if ( vsa.partition()[t] != i )
+                {
+                    return false;
+                }
+            }
+            size += vsa.region( i ).size();
+        }
+        return size == numTriangles;
+    }
+
+    void run() override {
+        TriangleMesh sphere = Ra::Core::Geometry::makeGeodesicSphere( 1.f, 4 );
+        std::vector<Ra::Core::Geometry::VertexIdx> duplicates;
+        Ra::Core::Geometry::removeDuplicates( sphere, duplicates );
+        for ( auto& v : sphere.m_vertices )
+        {
+            v.normalize();
+        }
+        const uint numTriangles = sphere.m_triangles.size();
+
+        // Warm start from the octants, shifted so that the proxies have to move.
+        VSA::FaceRegion octants( numTriangles );
+        for ( uint t = 0; t < numTriangles; ++t )
+        {
+            const auto& T = sphere.m_triangles[t];
+            const Ra::Core::Math::Vector3 b =
+                ( sphere.m_vertices[T[0]] + sphere.m_vertices[T[1]] + sphere.m_vertices[T[2]] ) /
+                    3 +
+                Ra::Core::Math::Vector3( 0.3f, 0.2f, 0.1f );
+            octants[t] = ( b.x() > 0 ? 1 : 0 ) + ( b.y() > 0 ? 2 : 0 ) + ( b.z() > 0 ? 4 : 0 );
+        }
+
+        VSA queue( sphere );
+        queue.init( octants );
+        queue.exec( 10 );
+        RA_UNIT_TEST( isPartition( queue, numTriangles ), "Queue growing misses faces." );
+
+        VSA batched( sphere );
+        batched.set_batched_growing( true );
+        batched.init( octants );
+        batched.exec( 10 );
+        RA_UNIT_TEST( isPartition( batched, numTriangles ), "Batched growing misses faces." );
+        RA_UNIT_TEST( batched.energy() < 1.2f * queue.energy(),
+                      "Batched growing far from the queue growing." );
+
+        // The iterations stop once the energy is stable, and restarting from the result
+        // converges at once.
+        VSA converged( sphere );
+        converged.set_batched_growing( true );
+        converged.init( octants );
+        const uint numIterations = converged.exec( 100, 1e-3f );
+        RA_UNIT_TEST( numIterations < 100, "No early termination." );
+        VSA restarted( sphere );
+        restarted.set_batched_growing( true );
+        restarted.init( converged.partition() );
+        RA_UNIT_TEST( restarted.exec( 100, 1e-2f ) < numIterations,
+                      "Warm start does not converge faster." );
+    }
+};
+
+RA_TEST_CLASS( VariationalShapeApproximationTests );
+} // namespace RaTests
+
+#endif // RADIUM_VARIATIONALSHAPEAPPROXIMATIONTESTS_HPP_
@@ -0,0 +1,117 @@
+#ifndef RADIUM_VERTEXNORMALSTESTS_HPP_
+#define RADIUM_VERTEXNORMALSTESTS_HPP_
+
+#include <Core/Geometry/MeshPrimitives.hpp>
+#include <Core/Geometry/MeshUtils.hpp>
+#include <Core/Geometry/VertexNormals.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <set>
+
+namespace RaTests {
+
+class VertexNormalsTests : public Test {
+    using TriangleMesh = Ra::Core::Geometry::TriangleMesh;
+    using VertexNormals = Ra::Core::Geometry::VertexNormals;
+    using Vector3Array = Ra::Core::Container::Vector3Array;
+
+    bool areEqual( const Vector3Array& a, const Vector3Array& b ) {
+        bool equal = a.size() == b.size();
+        for ( uint i = 0; i < a.size() && equal; ++i )
+        {
+            equal = ( a[i] - b[i] ).norm() < 1e-5f;
+        }
+        return equal;
+    }
+
+    void run() override {
+        // On a sphere, all the weightings give about the radial direction.
+        TriangleMesh sphere = Ra::Core::Geometry::makeGeodesicSphere( 1.f, 3 );
+        std::vector<Ra::Core::Geometry::VertexIdx> duplicates;
+        Ra::Core::Geometry::removeDuplicates( sphere, duplicates );
+        for ( auto& v : sphere.m_vertices )
+        {
+            v.normalize();
+        }
+        VertexNormals normals( sphere.m_vertices.size(), sphere.m_triangles );
+        for ( auto weighting : {VertexNormals::WEIGHT_UNIFORM, VertexNormals::WEIGHT_ANGLE,
+                                VertexNormals::WEIGHT_AREA} )
+        {
+            normals.setWeighting( weighting );
+            Vector3Array n;
+            normals.compute( sphere.m_vertices, n );
+            bool radial = n.size() == sphere.m_vertices.size();
+            for ( uint i = 0; i < n.size() && radial; ++i )
+            {
+                radial = n[i].dot( sphere.m_vertices[i].normalized() ) > 0.99f;
+            }
+            RA_UNIT_TEST( radial, "Normals not radial." );
+        }
+
+        // Updating the moved vertices and their neighbours gives the full computation.
+        normals.setWeighting( VertexNormals::WEIGHT_ANGLE );
+        Vector3Array partial;
+        normals.compute( sphere.m_vertices, partial );
+        TriangleMesh bumped = sphere;
+        std::set<uint> moved;
+        for ( uint i = 0; i < bumped.m_vertices.size(); i += 7 )
+        {
+            bumped.m_vertices[i] *= 1.2f;
+            moved.insert( i );
+        }
+        std::set<uint> touched;
+        for ( const auto& t : bumped.m_triangles )
+        {
+            if ( moved.count( t[0] ) || moved.count( t[1] ) || moved.count( t[2] ) )
+            {
+                touched.insert( {t[0], t[1], t[2]} );
+            }
+        }
+        normals.compute( bumped.m_vertices, std::vector<uint>( touched.begin(), touched.end() ),
+                         partial );
+        Vector3Array full;
+        normals.compute( bumped.m_vertices, full );
+        RA_UNIT_TEST( areEqual( partial, full ), "Partial update differs." );
+
+        // Each triangle of the soup has its own vertices : with the duplicate table, they get
+        // the normals of the welded mesh.
+        TriangleMesh soup;
+        for ( const auto& t : sphere.m_triangles )
+        {
+            const uint first = soup.m_vertices.size();
+            for ( uint i = 0; i < 3; ++i )
+            {
+                soup.m_vertices.push_back( sphere.m_vertices[t[i]] );
+            }
+            soup.m_triangles.push_back(
+                Ra::Core::Geometry::Triangle( first, first + 1, first + 2 ) );
+        }
+        std::vector<Ra::Core::Geometry::VertexIdx> soupDuplicates;
+        Ra::Core::Geometry::findDuplicates( soup, soupDuplicates );
+        VertexNormals soupNormals;
+        const std::vector<Ra::Core::Container::Index> soupTable( soupDuplicates.begin(),
+                                                                 soupDuplicates.end() );
+        soupNormals.setTopology( soup.m_vertices.size(), soup.m_triangles, soupTable );
+        Vector3Array welded;
+        Vector3Array unwelded;
+        normals.setWeighting( VertexNormals::WEIGHT_UNIFORM );
+        normals.compute( sphere.m_vertices, welded );
+        soupNormals.compute( soup.m_vertices, unwelded );
+        bool sameNormals = true;
+        for ( uint t = 0; t < sphere.m_triangles.size() && sameNormals; ++t )
+        {
+            for ( uint i = 0; i < 3; ++i )
+            {
+                sameNormals = sameNormals &&
+                              ( welded[sphere.m_triangles[t][i]] - unwelded[3 * t + i] ).norm() <
+                                  1e-5f;
+            }
+        }
+        RA_UNIT_TEST( sameNormals, "Duplicated vertices do not share their normals." );
+    }
+};
+
+RA_TEST_CLASS( VertexNormalsTests );
+} // namespace RaTests
+
+#endif // RADIUM_VERTEXNORMALSTESTS_HPP_
@@ -0,0 +1,113 @@
+#ifndef RADIUM_RAYCASTPACKET_TESTS_HPP_
+#define RADIUM_RAYCASTPACKET_TESTS_HPP_
+
+#include <Core/Math/RayCast.hpp>
+#include <Core/Math/RayCastPacket.hpp>
+#include <Tests/CoreTests/Tests.hpp>
+
+#include <random>
+
+namespace RaTests {
+
+/// Compare the packet intersections to the scalar ones on random inputs.
+class RayCastPacketTests : public Test {
+    using Vector3 = Ra::Core::Math::Vector3;
+    using Ray = Ra::Core::Math::Ray;
+
+    /// Returns true if a lane agrees with the scalar result.
+    bool sameHit( uint mask, int i, Scalar packetHit, bool hit, Scalar t ) {
+        const bool packetHasHit = ( mask >> i ) & 1;
+        return packetHasHit == hit &&
+               ( !hit || std::abs( packetHit - t ) <= 1e-3f * std::max( Scalar( 1 ), t ) );
+    }
+
+    void run() override {
+        namespace RayCast = Ra::Core::Math::RayCast;
+        std::mt19937 gen( 11 );
+        std::uniform_real_distribution<Scalar> dis( -1.f, 1.f );
+        auto randomVector = [&]() { return Vector3( dis( gen ), dis( gen ), dis( gen ) ); };
+
+        bool trianglesOk = true;
+        bool aabbsOk = true;
+        bool raysOk = true;
+        uint numHits = 0;
+        for ( uint iter = 0; iter < 1000; ++iter )
+        {
+            // One ray against 8 triangles and 8 boxes, the last ones being padding.
+            const Ray ray( randomVector() * 2.f, randomVector() );
+            RayCast::TrianglePacket<8> triangles;
+            RayCast::AabbPacket<8> aabbs;
+            triangles.setDegenerate();
+            aabbs.setEmpty();
+            Vector3 v[6][3];
+            Ra::Core::Math::Aabb boxes[6];
+            for ( int i = 0; i < 6; ++i )
+            {
+                for ( int k = 0; k < 3; ++k )
+                {
+                    v[i][k] = randomVector();
+                }
+                triangles.set( i, v[i][0], v[i][1], v[i][2] );
+                boxes[i] = Ra::Core::Math::Aabb( v[i][0].cwiseMin( v[i][1] ),
+                                                 v[i][0].cwiseMax( v[i][1] ) );
+                aabbs.set( i, boxes[i] );
+            }
+            RayCast::Lanes<8> hits;
+            uint mask = RayCast::vsTriangles( ray, triangles, hits );
+            trianglesOk = trianglesOk && ( mask >> 6 ) == 0;
+            for ( int i = 0; i < 6; ++i )
+            {
+                std::vector<Scalar> t;
+                const bool hit = RayCast::vsTriangle( ray, v[i][0], v[i][1], v[i][2], t );
+                trianglesOk = trianglesOk && sameHit( mask, i, hits[i], hit, hit ? t[0] : 0 );
+                numHits += hit ? 1 : 0;
+            }
+            mask = RayCast::vsAabbs( ray, aabbs, hits );
+            aabbsOk = aabbsOk && ( mask >> 6 ) == 0;
+            for ( int i = 0; i < 6; ++i )
+            {
+                Scalar t;
+                Vector3 n;
+                const bool hit = RayCast::vsAabb( ray, boxes[i], t, n );
+                aabbsOk = aabbsOk && sameHit( mask, i, hits[i], hit, t );
+            }
+
+            // 4 rays against a triangle, a box and a plane.
+            RayCast::RayPacket<4> rays;
+            Ray rayArray[4];
+            for ( int i = 0; i < 4; ++i )
+            {
+                rayArray[i] = Ray( randomVector() * 2.f, randomVector() );
+                rays.set( i, rayArray[i] );
+            }
+            RayCast::Lanes<4> triangleHits, aabbHits, planeHits;
+            const uint triangleMask =
+                RayCast::vsTriangle( rays, v[0][0], v[0][1], v[0][2], triangleHits );
+            const uint aabbMask = RayCast::vsAabb( rays, boxes[0], aabbHits );
+            const Vector3 normal = v[1][0];
+            const uint planeMask = RayCast::vsPlane( rays, v[1][1], normal, planeHits );
+            for ( int i = 0; i < 4; ++i )
+            {
+                std::vector<Scalar> t;
+                bool hit = RayCast::vsTriangle( rayArray[i], v[0][0], v[0][1], v[0][2], t );
+                raysOk = raysOk && sameHit( triangleMask, i, triangleHits[i], hit, hit ? t[0] : 0 );
+                Scalar tAabb;
+                Vector3 n;
+                hit = RayCast::vsAabb( rayArray[i], boxes[0], tAabb, n );
+                raysOk = raysOk && sameHit( aabbMask, i, aabbHits[i], hit, tAabb );
+                t.clear();
+                hit = RayCast::vsPlane( rayArray[i], v[1][1], normal, t );
+                raysOk = raysOk && sameHit( planeMask, i, planeHits[i], hit, hit ? t[0] : 0 );
+            }
+        }
+        RA_UNIT_TEST( numHits > 0, "No triangle hit, the test is useless." );
+        RA_UNIT_TEST( trianglesOk, "Wrong ray versus triangles packets." );
+        RA_UNIT_TEST( aabbsOk, "Wrong ray versus boxes packets." );
+        RA_UNIT_TEST( raysOk, "Wrong ray packets." );
+    }
+};
+
+RA_TEST_CLASS( RayCastPacketTests );
+} // namespace RaTests
+
+#endif // RADIUM_RAYCASTPACKET_TESTS_HPP_
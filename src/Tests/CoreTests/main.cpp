@@ -5,7 +5,17 @@
 #include <Tests/CoreTests/Containers/ContainersTest.hpp>
 #include <Tests/CoreTests/Containers/IndexMapTest.hpp>
 #include <Tests/CoreTests/Distance/DistanceTests.hpp>
+#include <Tests/CoreTests/Geometry/DecimationTests.hpp>
+#include <Tests/CoreTests/Geometry/FactorizationCacheTests.hpp>
 #include <Tests/CoreTests/Geometry/GeometryTests.hpp>
+#include <Tests/CoreTests/Geometry/HalfEdgeTests.hpp>
+#include <Tests/CoreTests/Geometry/MeshDistanceTests.hpp>
+#include <Tests/CoreTests/Geometry/OperatorAssemblyTests.hpp>
+#include <Tests/CoreTests/Geometry/PointCloudProcessingTests.hpp>
+#include <Tests/CoreTests/Geometry/PointKdTreeTests.hpp>
+#include <Tests/CoreTests/Geometry/VariationalShapeApproximationTests.hpp>
+#include <Tests/CoreTests/Geometry/VertexNormalsTests.hpp>
+#include <Tests/CoreTests/RayCasts/RayCastPacketTest.hpp>
 #include <Tests/CoreTests/RayCasts/RayCastTest.hpp>
 #include <Tests/CoreTests/String/StringTest.hpp>
 #include <Tests/CoreTests/TopologicalMesh/ConvertTest.hpp>